@@ -77,12 +77,23 @@
 /*                         Structures and Enums                               */
 /* ========================================================================== */
 
-/* None */
+/** \brief Where an ADCINTx line reports the SOC that raised it */
+typedef struct
+{
+    uint32 regOffset;
+    /**< INTSOCSEL register holding the line */
+    uint32 mask;
+    /**< SOC field of the line */
+    uint32 shift;
+    /**< Shift of the SOC field */
+} Adc_IrqLineDescType;
 
 /* ========================================================================== */
 /*                 Internal Function Declarations                             */
 /* ========================================================================== */
 
+static void Adc_IrqDispatch(uint8 hwUnitId, uint16 intNum);
+
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -92,6 +103,17 @@
 extern VAR(Adc_HwSocObjType, ADC_VAR_CLEARED) Adc_HwSocGroupMapping[ADC_HW_UNIT_CNT];
 #define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "Adc_MemMap.h"
+
+#define ADC_START_SEC_CONST_32
+#include "Adc_MemMap.h"
+/** \brief Line descriptors indexed by ADC_INT_NUMBERx, same for all units */
+static const Adc_IrqLineDescType Adc_IrqLineDesc[4U] = {
+    {ADC_INTERRUPT_12_REGISTER_OFFSET, ADC_INTERRUPT_13_REGISTER_MASK, 0U},
+    {ADC_INTERRUPT_12_REGISTER_OFFSET, ADC_INTERRUPT_24_REGISTER_MASK, 8U},
+    {ADC_INTERRUPT_34_REGISTER_OFFSET, ADC_INTERRUPT_13_REGISTER_MASK, 0U},
+    {ADC_INTERRUPT_34_REGISTER_OFFSET, ADC_INTERRUPT_24_REGISTER_MASK, 8U}};
+#define ADC_STOP_SEC_CONST_32
+#include "Adc_MemMap.h"
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -109,20 +131,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit0(void)
 ISR(Adc_ADCINT1_IrqUnit0)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_0].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_0, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_0) */
 
@@ -135,20 +144,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit0(void)
 ISR(Adc_ADCINT2_IrqUnit0)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_0].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_0, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_0) */
 
@@ -161,20 +157,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit0(void)
 ISR(Adc_ADCINT3_IrqUnit0)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_0].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_0, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_0) */
 
@@ -187,20 +170,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit0(void)
 ISR(Adc_ADCINT4_IrqUnit0)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_0].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_0, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_0) */
 
@@ -214,20 +184,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit1(void)
 ISR(Adc_ADCINT1_IrqUnit1)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_1].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_1, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_1) */
 
@@ -240,20 +197,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit1(void)
 ISR(Adc_ADCINT2_IrqUnit1)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_1].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_1, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_1) */
 
@@ -266,20 +210,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit1(void)
 ISR(Adc_ADCINT3_IrqUnit1)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_1].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_1, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_1) */
 
@@ -292,20 +223,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit1(void)
 ISR(Adc_ADCINT4_IrqUnit1)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_1].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_1, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_1) */
 
@@ -319,20 +237,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit2(void)
 ISR(Adc_ADCINT1_IrqUnit2)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_2].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_2, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_2) */
 
@@ -345,20 +250,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit2(void)
 ISR(Adc_ADCINT2_IrqUnit2)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_2].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_2, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_2) */
 
@@ -371,20 +263,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit2(void)
 ISR(Adc_ADCINT3_IrqUnit2)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_2].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_2, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_2) */
 
@@ -397,20 +276,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit2(void)
 ISR(Adc_ADCINT4_IrqUnit2)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_2].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_2, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_2) */
 
@@ -424,20 +290,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit3(void)
 ISR(Adc_ADCINT1_IrqUnit3)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_3].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_3, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_3) */
 
@@ -450,20 +303,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit3(void)
 ISR(Adc_ADCINT2_IrqUnit3)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_3].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_3, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_3) */
 
@@ -476,20 +316,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit3(void)
 ISR(Adc_ADCINT3_IrqUnit3)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_3].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_3, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_3) */
 
@@ -502,20 +329,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit3(void)
 ISR(Adc_ADCINT4_IrqUnit3)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_3].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_3, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_3) */
 
@@ -529,20 +343,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit4(void)
 ISR(Adc_ADCINT1_IrqUnit4)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_4].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_4, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_4) */
 
@@ -555,20 +356,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit4(void)
 ISR(Adc_ADCINT2_IrqUnit4)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_4].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_4, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_4) */
 
@@ -581,20 +369,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit4(void)
 ISR(Adc_ADCINT3_IrqUnit4)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_4].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_4, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_4) */
 
@@ -607,20 +382,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit4(void)
 ISR(Adc_ADCINT4_IrqUnit4)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_4].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_4, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_4) */
 
@@ -634,20 +396,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit5(void)
 ISR(Adc_ADCINT1_IrqUnit5)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_5].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_5, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_5) */
 
@@ -660,20 +409,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit5(void)
 ISR(Adc_ADCINT2_IrqUnit5)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_5].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_5, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_5) */
 
@@ -686,20 +422,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit5(void)
 ISR(Adc_ADCINT3_IrqUnit5)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_5].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_5, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_5) */
 
@@ -712,20 +435,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit5(void)
 ISR(Adc_ADCINT4_IrqUnit5)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_5].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_5, ADC_INT_NUMBER4);
 }
 #endif /* #if defined (ADC_INSTANCE_5) */
 
@@ -739,20 +449,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT1_IrqUnit6(void)
 ISR(Adc_ADCINT1_IrqUnit6)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_6].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER1, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_6, ADC_INT_NUMBER1);
 }
 #endif /* #if defined (ADC_INSTANCE_6) */
 
@@ -765,20 +462,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT2_IrqUnit6(void)
 ISR(Adc_ADCINT2_IrqUnit6)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_6].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_12_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER2, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_6, ADC_INT_NUMBER2);
 }
 #endif /* #if defined (ADC_INSTANCE_6) */
 
@@ -791,20 +475,7 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT3_IrqUnit6(void)
 ISR(Adc_ADCINT3_IrqUnit6)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
-
-    /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_6].adcHwUnit;
-    if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
-    {
-        hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_13_REGISTER_MASK));
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER3, adcSocNumber);
-    }
+    Adc_IrqDispatch(ADC_HWUNIT_6, ADC_INT_NUMBER3);
 }
 #endif /* #if defined (ADC_INSTANCE_6) */
 
@@ -817,22 +488,31 @@ FUNC(void, ADC_ISR_CODE) Adc_ADCINT4_IrqUnit6(void)
 ISR(Adc_ADCINT4_IrqUnit6)
 #endif
 {
-    Adc_HwUnitObjType *hwUnitObj;
-    uint8              adcSocNumber;
-    uint8              hwUnitIdx;
-    uint32             intRegAddr;
+    Adc_IrqDispatch(ADC_HWUNIT_6, ADC_INT_NUMBER4);
+}
+#endif /* #if defined (ADC_INSTANCE_6) */
+
+/* Common body of all ADCINTx stubs: resolves the unit and the SOC that raised
+ * the line and hands over to the driver */
+static void Adc_IrqDispatch(uint8 hwUnitId, uint16 intNum)
+{
+    const Adc_IrqLineDescType *lineDesc = &Adc_IrqLineDesc[intNum];
+    Adc_HwUnitObjType         *hwUnitObj;
+    uint8                      adcSocNumber;
+    uint8                      hwUnitIdx;
 
     /* Check if, Index is invalid */
-    hwUnitIdx = Adc_HwSocGroupMapping[ADC_HWUNIT_6].adcHwUnit;
+    hwUnitIdx = Adc_HwSocGroupMapping[hwUnitId].adcHwUnit;
     if (hwUnitIdx < (uint8)ADC_MAX_HW_UNIT)
     {
         hwUnitObj    = &Adc_DrvObj.hwUnitObj[hwUnitIdx];
-        intRegAddr   = hwUnitObj->baseAddr | ADC_INTERRUPT_34_REGISTER_OFFSET;
-        adcSocNumber = (uint8)((HW_RD_REG16(intRegAddr) & ADC_INTERRUPT_24_REGISTER_MASK) >> 8U);
-        Adc_IrqTxRx(hwUnitObj, ADC_INT_NUMBER4, adcSocNumber);
+        adcSocNumber = (uint8)(((uint32)HW_RD_REG16(hwUnitObj->baseAddr | lineDesc->regOffset) & lineDesc->mask) >>
+                               lineDesc->shift);
+        Adc_IrqTxRx(hwUnitObj, intNum, adcSocNumber);
     }
+
+    return;
 }
-#endif /* #if defined (ADC_INSTANCE_6) */
 
 #define ADC_STOP_SEC_ISR_CODE
 #include "Adc_MemMap.h"
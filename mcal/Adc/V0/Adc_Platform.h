@@ -863,6 +863,34 @@ static inline FUNC(uint16, ADC_CODE) ADC_readResult(uint32 resultBase, uint32 so
                         ((uint32)socNumber * MCAL_ADC_RESULT_ADCRESULTx_STEP)));
 }
 
+/** \brief Reads the results of consecutive SOCs.
+ *
+ *
+ * The result registers of consecutive SOCs are adjacent, so the reads are
+ * issued back to back from one incrementing address with no per-SOC address
+ * calculation. Each register is still read with a 16-bit access.
+ *
+ * \param[in] resultBase - base address of the ADC results.
+ * \param[in] socNumber - first SOC to read.
+ * \param[in] numSoc - number of SOCs to read, socNumber + numSoc <= 16.
+ * \param[out] dstPtr - destination of numSoc results.
+ * \param[in] shift - left shift applied to each result, 0 for none.
+ * \return None
+ *
+ *****************************************************************************/
+static inline FUNC(void, ADC_CODE)
+    ADC_readResultBurst(uint32 resultBase, uint32 socNumber, uint32 numSoc, uint16 *dstPtr, uint32 shift)
+{
+    uint32 regAddr = resultBase + MCAL_CSL_ADC_RESULT_ADCRESULT0 + (socNumber * MCAL_ADC_RESULT_ADCRESULTx_STEP);
+    uint32 idx;
+
+    for (idx = 0U; idx < numSoc; idx++)
+    {
+        dstPtr[idx]  = (uint16)((uint32)HW_RD_REG16(regAddr) << shift);
+        regAddr     += MCAL_ADC_RESULT_ADCRESULTx_STEP;
+    }
+}
+
 /** \brief Reads the address of the conversion result register.
  *
  *
@@ -964,6 +992,77 @@ static inline FUNC(void, ADC_CODE) ADC_setupPPB(uint32 base, Adc_mcalPPBNumber_t
                                    ((uint16)socNumber & MCAL_CSL_ADC_ADCPPB1CONFIG_CONFIG_MASK)));
 }
 
+/** \brief Sets the calibration offset of a post-processing block.
+ *
+ *
+ * The offset is subtracted from the raw conversion result before it is
+ * written to the ADC result register of the SOC the PPB is tied to.
+ *
+ * \param[in] base - base address of the ADC.
+ * \param[in] ppbNumber - number of the post-processing block.
+ * \param[in] offset - 10-bit signed offset, -512 to 511.
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+static inline FUNC(void, ADC_CODE) ADC_setPPBCalibrationOffset(uint32 base, Adc_mcalPPBNumber_t ppbNumber, sint16 offset)
+{
+    uint32 ppbOffset;
+
+    ppbOffset = (MCAL_ADC_ADCPPBx_STEP * (uint32)ppbNumber) + MCAL_CSL_ADC_ADCPPB1OFFCAL;
+
+    HW_WR_REG16(base + ppbOffset, ((HW_RD_REG16(base + ppbOffset) & ~MCAL_CSL_ADC_ADCPPB1OFFCAL_OFFCAL_MASK) |
+                                   ((uint16)offset & MCAL_CSL_ADC_ADCPPB1OFFCAL_OFFCAL_MASK)));
+}
+
+/** \brief Sets the reference offset of a post-processing block.
+ *
+ *
+ * The reference is subtracted from the conversion result to produce the
+ * signed PPB result that the trip limits and zero-crossing detection use.
+ * With two's complement enabled the PPB result is reference - result.
+ *
+ * \param[in] base - base address of the ADC.
+ * \param[in] ppbNumber - number of the post-processing block.
+ * \param[in] offset - reference offset.
+ * \param[in] twosComplement - TRUE to invert the PPB result.
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+static inline FUNC(void, ADC_CODE)
+    ADC_setPPBReferenceOffset(uint32 base, Adc_mcalPPBNumber_t ppbNumber, uint16 offset, boolean twosComplement)
+{
+    uint32 ppbOffset;
+    uint16 config;
+
+    ppbOffset = (MCAL_ADC_ADCPPBx_STEP * (uint32)ppbNumber) + MCAL_CSL_ADC_ADCPPB1OFFREF;
+    HW_WR_REG16(base + ppbOffset, offset);
+
+    ppbOffset = (MCAL_ADC_ADCPPBx_STEP * (uint32)ppbNumber) + MCAL_CSL_ADC_ADCPPB1CONFIG;
+    config    = HW_RD_REG16(base + ppbOffset) & ~MCAL_CSL_ADC_ADCPPB1CONFIG_TWOSCOMPEN_MASK;
+    if (TRUE == twosComplement)
+    {
+        config |= MCAL_CSL_ADC_ADCPPB1CONFIG_TWOSCOMPEN_MASK;
+    }
+    HW_WR_REG16(base + ppbOffset, config);
+}
+
+/** \brief Reads the result of a post-processing block.
+ *
+ *
+ * \param[in] resultBase - base address of the ADC result registers.
+ * \param[in] ppbNumber - number of the post-processing block.
+ * \return sint32 Sign extended PPB result
+ * \retval PPB result
+ *
+ *****************************************************************************/
+static inline FUNC(sint32, ADC_CODE) ADC_readPPBResult(uint32 resultBase, Adc_mcalPPBNumber_t ppbNumber)
+{
+    return ((sint32)HW_RD_REG32(resultBase + MCAL_CSL_ADC_RESULT_ADCPPB1RESULT +
+                                (MCAL_ADC_RESULT_ADCPPBxRESULT_STEP * (uint32)ppbNumber)));
+}
+
 /** \brief Enables an ADC interrupt source.
  *
  *
@@ -87,6 +87,24 @@
      MCAL_CSL_ADC_ADCEVTSTAT_PPB2TRIPHI_MASK | MCAL_CSL_ADC_ADCEVTSTAT_PPB2TRIPLO_MASK | \
      MCAL_CSL_ADC_ADCEVTSTAT_PPB3TRIPHI_MASK | MCAL_CSL_ADC_ADCEVTSTAT_PPB3TRIPLO_MASK | \
      MCAL_CSL_ADC_ADCEVTSTAT_PPB4TRIPHI_MASK | MCAL_CSL_ADC_ADCEVTSTAT_PPB4TRIPLO_MASK)
+
+#if (STD_ON == ADC_PPB_API)
+/* ADCEVTSTAT/ADCEVTCLR hold TRIPHI/TRIPLO/ZERO of PPB n at bits 4n..4n+2 */
+#define ADC_PPB_EVT_SHIFT (4U)
+#define ADC_PPB_EVT_MASK  ((uint8)(ADC_PPB_EVT_TRIPHI | ADC_PPB_EVT_TRIPLO | ADC_PPB_EVT_ZERO))
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+/* PaRAM sets of the group DMA handler used for ping-pong - the active set
+ * (ping), the pong link set and a pristine copy of ping to reload from */
+#define ADC_DMA_PING_PARAM_IDX        (0U)
+#define ADC_DMA_PONG_PARAM_IDX        (1U)
+#define ADC_DMA_PING_RELOAD_PARAM_IDX (2U)
+/* PaRAM sets the group DMA handler must own for ping-pong */
+#define ADC_DMA_PING_PONG_NUM_PARAMS  (3U)
+/* Channel stride of the result buffer must fit the signed 16-bit DSTBIDX */
+#define ADC_DMA_PING_PONG_MAX_SAMPLES (16382U)
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -122,9 +140,18 @@ static void           Adc_procIsr_Internal(uint32 *convComplete, Adc_GroupObjTyp
 static Std_ReturnType Adc_checkAndSchedule_Internal(Adc_HwUnitObjType *hwUnitObj, Adc_GroupObjType *nextGroupObj);
 static void           Adc_copyConfig_Internal(const Adc_GroupConfigType *groupCfg);
 static boolean Adc_IrqTxRx_Internal(uint32 baseAddr, Adc_GroupObjType **groupObj, uint16 InterruptNum, uint8 adcSoc);
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+static void   Adc_streamPublish(Adc_GroupObjType *groupObj, uint32 numSets);
+static uint32 Adc_streamWindow(const Adc_GroupObjType *groupObj);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+#if (STD_ON == ADC_PPB_API)
+static void Adc_ppbConfigure(const Adc_GroupObjType *groupObj, uint32 baseAddr);
+static void Adc_ppbCheckEvents(const Adc_HwUnitObjType *hwUnitObj, const Adc_GroupObjType *groupObj);
+#endif /* #if (STD_ON == ADC_PPB_API) */
 static void    Adc_hwConfig_check_accessMode(const Adc_GroupObjType *groupObj, uint32 baseAddr, uint16 groupMask,
                                              uint16 adcLastSoc, const Adc_GroupConfigType *groupCfg);
 static void    Adc_copyConfig_ExplicitStopMode(Adc_GroupObjType *groupObj, const Adc_GroupConfigType *groupCfg);
+static void    Adc_copyConfig_PriorityRank(Adc_DriverObjType *drvObj);
 
 #if (STD_ON == ADC_DEV_ERROR_DETECT)
 static Std_ReturnType Adc_checkGroupCfgRangeParameters(const Adc_GroupConfigType *groupCfg);
@@ -138,6 +165,10 @@ static boolean        Adc_CheckPass(const Adc_GroupObjType *groupObjCurrent, con
 static void Adc_IrqDmaTxRx(void *groupId);
 static void AdcDma_FreeModuleChannelConfigured(uint32 dma_ch);
 #endif /* #if (STD_ON == ADC_DMA_MODE) */
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+static void AdcDma_PingPongConfigure(const Adc_GroupObjType *groupObj, uint32 srceaddr);
+static void Adc_pingPongIsr(Adc_GroupObjType *groupObj);
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -513,7 +544,7 @@ static Std_ReturnType Adc_startGroup_Internal(Adc_GroupObjType *groupObj, Adc_Hw
             curGroupObj->isPaused = (uint32)ADC_TRUE;
             curGroupObj->isQueued = (uint32)ADC_TRUE;
             Adc_utilsLinkNodePri(&hwUnitObj->groupList, &curGroupObj->nodeObj, curGroupObj,
-                                 curGroupObj->groupCfg.groupPriority, curGroupObj->isPaused);
+                                 curGroupObj->priorityRank, curGroupObj->isPaused);
         }
         /* TI_COVERAGE_GAP_STOP */
 
@@ -548,7 +579,8 @@ static Std_ReturnType Adc_startGroup_Internal(Adc_GroupObjType *groupObj, Adc_Hw
              * hardware queue */
             groupObj->groupStatus = ADC_BUSY;
             groupObj->isQueued    = (uint32)ADC_TRUE;
-            Adc_utilsLinkNodePri(&hwUnitObj->groupList, &groupObj->nodeObj, groupObj, effPriority, ADC_FALSE);
+            Adc_utilsLinkNodePri(&hwUnitObj->groupList, &groupObj->nodeObj, groupObj, groupObj->priorityRank,
+                                 ADC_FALSE);
         }
     }
     return (retVal);
@@ -842,6 +874,20 @@ static void Adc_IrqDmaTxRx(void *groupId)
     groupObj  = &Adc_DrvObj.groupObj[groupCount];
     hwUnitObj = groupObj->hwUnitObj;
 
+#if (STD_ON == ADC_PPB_API)
+    /* DMA groups have no per round ISR: dispatch the PPB events latched by the
+     * rounds of this transfer before the group end or half notification */
+    Adc_ppbCheckEvents(hwUnitObj, groupObj);
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
+#if (STD_ON == ADC_DMA_PING_PONG_API)
+    if (((uint32)ADC_TRUE) == groupObj->isPingPong)
+    {
+        /* Ping-pong groups keep converting - only hand over the filled half */
+        Adc_pingPongIsr(groupObj);
+    }
+    else
+#endif /* #if (STD_ON == ADC_DMA_PING_PONG_API) */
     /* TI_COVERAGE_GAP_START groupObj = &Adc_DrvObj.groupObj[groupCount] is always a non-zero
      address since it is the address-of a global array element. The else branch and the
      redundant inner NULL_PTR check can never be reached. */
@@ -936,6 +982,17 @@ void Adc_resetDrvObj(Adc_DriverObjType *drvObj)
         drvObj->groupObj[grpIdx].validSampleCount   = 0U;
         drvObj->groupObj[grpIdx].curCh              = 0U;
         drvObj->groupObj[grpIdx].resultBufPtr       = (const Adc_ValueGroupType *)NULL_PTR;
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+        drvObj->groupObj[grpIdx].streamWrIdx        = 0U;
+        drvObj->groupObj[grpIdx].streamRdIdx        = 0U;
+        drvObj->groupObj[grpIdx].streamOverrunCount = 0U;
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+        Adc_disablePingPongInternal(&drvObj->groupObj[grpIdx]);
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+#if (STD_ON == ADC_PPB_API)
+        drvObj->groupObj[grpIdx].ppbUsedMask = 0U;
+#endif /* #if (STD_ON == ADC_PPB_API) */
         for (chIdx = 0U; chIdx < ADC_NUM_CHANNEL; chIdx++)
         {
             drvObj->groupObj[grpIdx].chObj[chIdx].chResultBufPtr  = (Adc_ValueGroupType *)NULL_PTR;
@@ -1073,12 +1130,42 @@ void Adc_copyConfig(Adc_DriverObjType *drvObj, const Adc_ConfigType *cfgPtr)
             }
 #endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
         }
+
+        Adc_copyConfig_PriorityRank(drvObj);
     }
     /* TI_COVERAGE_GAP_STOP */
 
     return;
 }
 
+/* Compresses the 0..255 group priorities into ranks below maxGroup keeping
+ * their order, so a HW unit queue needs only one bucket per group */
+static void Adc_copyConfig_PriorityRank(Adc_DriverObjType *drvObj)
+{
+    uint32  priority, grpIdx;
+    uint8   rank = 0U;
+    boolean found;
+
+    for (priority = 0U; priority <= 0xFFU; priority++)
+    {
+        found = FALSE;
+        for (grpIdx = 0U; grpIdx < drvObj->maxGroup; grpIdx++)
+        {
+            if ((uint32)drvObj->groupObj[grpIdx].groupCfg.groupPriority == priority)
+            {
+                drvObj->groupObj[grpIdx].priorityRank = (Adc_GroupPriorityType)rank;
+                found                                 = TRUE;
+            }
+        }
+        if (TRUE == found)
+        {
+            rank++;
+        }
+    }
+
+    return;
+}
+
 static void Adc_copyConfig_ExplicitStopMode(Adc_GroupObjType *groupObj, const Adc_GroupConfigType *groupCfg)
 {
     groupObj->isExplicitStopMode = (uint32)ADC_TRUE;
@@ -1324,6 +1411,15 @@ static void Adc_scheduleGroup(Adc_GroupObjType *groupObj)
         groupObj->validSampleCount = 0U;
         groupObj->curCh            = 0U;
         tempResultBufPtr           = (Adc_ValueGroupType *)groupObj->resultBufPtr;
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+        /* Ring restarts at the first sample of the result buffer */
+        groupObj->streamWrIdx = 0U;
+        groupObj->streamRdIdx = 0U;
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+        /* DMA starts filling the ping half */
+        groupObj->pingPongHalf = 0U;
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
         /* TI_COVERAGE_GAP_START The MC/DC independence pairs for (numChannels == 0) and
          (numChannels > ADC_NUM_CHANNEL) are architecturally unreachable. groupCfg->numChannels
          is validated by Adc_checkGroupCfgRangeParameters() during Adc_Init, which rejects
@@ -1411,7 +1507,7 @@ static void Adc_checkAndSchedule(Adc_HwUnitObjType *hwUnitObj)
             nextGroupObj->groupStatus = ADC_BUSY;
             nextGroupObj->isQueued    = (uint32)ADC_TRUE;
             Adc_utilsLinkNodePri(&hwUnitObj->groupList, &nextGroupObj->nodeObj, nextGroupObj,
-                                 nextGroupObj->groupCfg.groupPriority, ADC_FALSE);
+                                 nextGroupObj->priorityRank, ADC_FALSE);
         }
     }
     return;
@@ -1465,46 +1561,28 @@ static void Adc_procIsr(Adc_HwUnitObjType *hwUnitObj, Adc_GroupObjType *groupObj
 {
     uint32              convComplete   = (uint32)ADC_FALSE;
     uint32              streamComplete = (uint32)ADC_FALSE;
-    uint16              data, numChannels, channnelPtr;
+    uint32              chIdx, numChannels, shiftResol;
     Adc_ChannelObjType *chObj;
-    uint32              socAssigned;
-    Adc_ValueGroupType *resultBufPtrCh;
-
-#if (ADC_ALIGN_LEFT == ADC_RESULT_ALIGNMENT)
-    uint16 data2, shiftResol;
-#endif /* #if (ADC_ALIGN_LEFT == ADC_RESULT_ALIGNMENT) */
+    Adc_ValueGroupType  burstBuf[ADC_NUM_CHANNEL];
 
-    socAssigned = (uint32)groupObj->socAssigned;
+    numChannels = groupObj->groupCfg.numChannels;
 
     /* Check the mode of Group. */
     if (groupObj->groupCfg.accessMode == ADC_ACCESS_MODE_SINGLE)
     {
-        /* Get Number of channels to be stored  */
-        numChannels    = (uint16)groupObj->groupCfg.numChannels;
-        channnelPtr    = 0;
-        resultBufPtrCh = (Adc_ValueGroupType *)groupObj->resultBufPtr;
-
-        while (numChannels > 0U)
-        {
-            /* Get the Data. */
-            data = (uint16)ADC_readResult(hwUnitObj->resultBaseAddr, (uint32)socAssigned);
-
 #if (ADC_ALIGN_LEFT == ADC_RESULT_ALIGNMENT)
-            shiftResol = (ADC_MAX_CHANNEL_VALUE_TYPE - groupObj->groupCfg.resolution);
-            data2      = (uint16)((uint32)data << (uint32)shiftResol);
-            data       = data2;
+        shiftResol = (uint32)ADC_MAX_CHANNEL_VALUE_TYPE - (uint32)groupObj->groupCfg.resolution;
+#else
+        shiftResol = 0U;
 #endif /* #if (ADC_ALIGN_LEFT == ADC_RESULT_ALIGNMENT) */
 
-            /* Get the Increment the Data ptr. */
-            socAssigned++;
-
-            /* Fill data to result buffer. */
-            resultBufPtrCh[channnelPtr] = data;
+        /* Group SOCs are consecutive - read them in one burst to the result buffer */
+        ADC_readResultBurst(hwUnitObj->resultBaseAddr, (uint32)groupObj->socAssigned, numChannels,
+                            (Adc_ValueGroupType *)groupObj->resultBufPtr, shiftResol);
 
-            /* Point to next channel. */
-            channnelPtr++;
-            numChannels--;
-        }
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+        Adc_streamPublish(groupObj, 1U);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
 
         /* Stop the conversion, if required. */
         convComplete = (uint32)ADC_TRUE;
@@ -1517,18 +1595,14 @@ static void Adc_procIsr(Adc_HwUnitObjType *hwUnitObj, Adc_GroupObjType *groupObj
     }
     else
     {
-        /* Get Number of Samples to be stored  */
-        numChannels     = (uint16)groupObj->groupCfg.numChannels;
+        /* Read all the samples in one burst before the buffer bookkeeping */
+        ADC_readResultBurst(hwUnitObj->resultBaseAddr, (uint32)groupObj->socAssigned, numChannels, &burstBuf[0U], 0U);
         groupObj->curCh = 0;
 
-        /* Read all the samples. */
-        while (numChannels > 0U)
+        for (chIdx = 0U; chIdx < numChannels; chIdx++)
         {
-            data = (uint16)ADC_readResult(hwUnitObj->resultBaseAddr, (uint32)socAssigned);
-            socAssigned++;
-
             chObj                   = &groupObj->chObj[groupObj->curCh];
-            *chObj->curResultBufPtr = data;
+            *chObj->curResultBufPtr = burstBuf[chIdx];
 
             /* Move to next buffer pointer for the channel */
             chObj->curNumSamples++;
@@ -1545,10 +1619,13 @@ static void Adc_procIsr(Adc_HwUnitObjType *hwUnitObj, Adc_GroupObjType *groupObj
             {
                 Adc_procIsr_Internal(&convComplete, groupObj, &streamComplete, chObj);
             }
-            numChannels--;
         }
     }
 
+#if (STD_ON == ADC_PPB_API)
+    Adc_ppbCheckEvents(hwUnitObj, groupObj);
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
     /* Set Group Status and Call group end notification */
     Adc_setGroupStatusPostIsr(hwUnitObj, groupObj, convComplete, streamComplete);
 
@@ -1568,6 +1645,9 @@ static void Adc_procIsr_Internal(uint32 *convComplete, Adc_GroupObjType *groupOb
          * generates */
         groupObj->validSampleCount = (uint32)groupObj->groupCfg.streamNumSamples;
     }
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+    Adc_streamPublish(groupObj, 1U);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
     /* Check if all streams are completed - check last channel pointer.
      * If it is at start then stream completed */
     *convComplete = (uint32)ADC_TRUE;
@@ -1801,6 +1881,10 @@ static void Adc_hwConfig(const Adc_GroupObjType *groupObj, uint32 baseAddr)
         adcSoc = socInc;
     }
 
+#if (STD_ON == ADC_PPB_API)
+    Adc_ppbConfigure(groupObj, baseAddr);
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
     /* Check the access mode. */
     switch (groupObj->groupCfg.groupDataAccessMode)
     {
@@ -1845,6 +1929,15 @@ static void Adc_hwConfig(const Adc_GroupObjType *groupObj, uint32 baseAddr)
              order not present in any test configuration. */
             if (ADC_TRUE == Cdd_Dma_GetInitStatus())
             {
+#if (STD_ON == ADC_DMA_PING_PONG_API)
+                if ((groupObj->groupCfg.groupDmaChannelId != 0xFFU) && (((uint32)ADC_TRUE) == groupObj->isPingPong))
+                {
+                    /* Pulse on every EOC without the CPU clearing the flag */
+                    ADC_enableContinuousMode(baseAddr, groupObj->groupInterruptSrc);
+                    AdcDma_PingPongConfigure(groupObj, dmaDataAddr);
+                }
+                else
+#endif /* #if (STD_ON == ADC_DMA_PING_PONG_API) */
                 if (groupObj->groupCfg.groupDmaChannelId != 0xFFU)
                 {
                     /* Configure ADC DMA Channel for each ADC channel.  */
@@ -1928,6 +2021,17 @@ static void Adc_hwStop(uint32 baseAddr, const Adc_GroupObjType *groupObj)
         /* Stop ADC in continuous mode. */
         ADC_disableContinuousMode(baseAddr, groupObj->groupInterruptSrc);
     }
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+    else if (((uint32)ADC_TRUE) == groupObj->isPingPong)
+    {
+        /* Ping-pong runs continuous mode for one-shot groups as well */
+        ADC_disableContinuousMode(baseAddr, groupObj->groupInterruptSrc);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
 
     for (ChnlId = 0U; ChnlId < groupCfg->numChannels; ChnlId++)
     {
@@ -1985,6 +2089,131 @@ boolean AdcDma_ModuleChannelConfigure(const uint16 *table, uint16 table_size, ui
 }
 #endif
 
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+/* Configures the group DMA channel to fill the two halves of the result
+ * buffer alternately. The handler owns ADC_DMA_PING_PONG_NUM_PARAMS PaRAM
+ * sets, checked when ping-pong is enabled. Every ADC event moves one sample of each channel
+ * (A = one result, B = channels, strided by the per-channel buffer length)
+ * and C counts the sets of one half. Ping links to pong, pong links to the
+ * reload copy of ping, which links back to pong, so the transfer never ends
+ * and only the completion of each half interrupts the CPU. */
+static void AdcDma_PingPongConfigure(const Adc_GroupObjType *groupObj, uint32 srceaddr)
+{
+    Cdd_Dma_ParamEntry  edmaParam;
+    uint32              dmaCh       = (uint32)groupObj->groupCfg.groupDmaChannelId;
+    uint32              numSamples  = (uint32)groupObj->groupCfg.streamNumSamples;
+    uint32              halfSamples = numSamples / 2U;
+    Adc_ValueGroupType *bufPtr      = (Adc_ValueGroupType *)groupObj->resultBufPtr;
+
+    edmaParam.srcPtr     = (void *)(srceaddr);
+    edmaParam.destPtr    = (void *)(bufPtr);
+    edmaParam.aCnt       = (uint16)sizeof(Adc_ValueGroupType);
+    edmaParam.bCnt       = (uint16)groupObj->groupCfg.numChannels;
+    edmaParam.cCnt       = (uint16)halfSamples;
+    edmaParam.bCntReload = 0;
+    edmaParam.srcBIdx    = (sint16)sizeof(Adc_ValueGroupType);
+    edmaParam.destBIdx   = (sint16)(numSamples * sizeof(Adc_ValueGroupType));
+    edmaParam.srcCIdx    = (sint16)0;
+    edmaParam.destCIdx   = (sint16)sizeof(Adc_ValueGroupType);
+    edmaParam.opt        = (CDD_EDMA_OPT_TCINTEN_MASK | CDD_EDMA_OPT_SYNCDIM_MASK);
+    Cdd_Dma_ParamSet(dmaCh, 0U, ADC_DMA_PING_PARAM_IDX, edmaParam);
+
+    Cdd_Dma_ReloadParamSet(dmaCh, ADC_DMA_PING_RELOAD_PARAM_IDX, ADC_DMA_PONG_PARAM_IDX, edmaParam);
+    edmaParam.destPtr = (void *)(bufPtr + halfSamples);
+    Cdd_Dma_ReloadParamSet(dmaCh, ADC_DMA_PONG_PARAM_IDX, ADC_DMA_PING_RELOAD_PARAM_IDX, edmaParam);
+    Cdd_Dma_LinkChannel(dmaCh, ADC_DMA_PING_PARAM_IDX, ADC_DMA_PONG_PARAM_IDX);
+
+    Cdd_Dma_EnableTransferRegion(dmaCh, CDD_EDMA_TRIG_MODE_EVENT);
+
+    return;
+}
+
+static void Adc_pingPongIsr(Adc_GroupObjType *groupObj)
+{
+    Adc_PingPongNotifyType notification;
+    Adc_ValueGroupType    *halfBufPtr  = (Adc_ValueGroupType *)groupObj->resultBufPtr;
+    uint32                 halfSamples = ((uint32)groupObj->groupCfg.streamNumSamples) / 2U;
+    uint32                 nextIdx;
+    uint32                 chIdx;
+
+    if (0U == groupObj->pingPongHalf)
+    {
+        notification           = groupObj->pingPongHalfNotification;
+        groupObj->pingPongHalf = 1U;
+        groupObj->groupStatus  = ADC_COMPLETED;
+        nextIdx                = halfSamples;
+    }
+    else
+    {
+        halfBufPtr            += halfSamples;
+        notification           = groupObj->pingPongFullNotification;
+        groupObj->pingPongHalf = 0U;
+        groupObj->groupStatus  = ADC_STREAM_COMPLETED;
+        nextIdx                = 0U;
+    }
+
+    /* Move the per channel write position past the completed half so that
+     * Adc_ReadGroup and Adc_GetStreamLastPointer see the latest sample */
+    for (chIdx = 0U; chIdx < groupObj->groupCfg.numChannels; chIdx++)
+    {
+        groupObj->chObj[chIdx].curResultBufPtr = groupObj->chObj[chIdx].chResultBufPtr + nextIdx;
+        groupObj->chObj[chIdx].curNumSamples   = (Adc_StreamNumSampleType)nextIdx;
+    }
+    groupObj->validSampleCount += halfSamples;
+    if (groupObj->validSampleCount > ((uint32)groupObj->groupCfg.streamNumSamples))
+    {
+        groupObj->validSampleCount = (uint32)groupObj->groupCfg.streamNumSamples;
+    }
+
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+    Adc_streamPublish(groupObj, halfSamples);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+
+    if ((Adc_PingPongNotifyType)NULL_PTR != notification)
+    {
+        notification(groupObj->groupCfg.groupId, halfBufPtr);
+    }
+
+    return;
+}
+
+Std_ReturnType Adc_enablePingPongInternal(Adc_GroupObjType *groupObj, Adc_PingPongNotifyType HalfNotification,
+                                          Adc_PingPongNotifyType FullNotification)
+{
+    Std_ReturnType retVal     = (Std_ReturnType)E_NOT_OK;
+    uint32         numSamples = (uint32)groupObj->groupCfg.streamNumSamples;
+
+    /* Needs a hardware triggered DMA group whose handler owns the ping, pong
+     * and reload PaRAM sets and a result buffer that splits into two equal halves */
+    if ((ADC_GROUP_DMA_ACCESS == groupObj->groupCfg.groupDataAccessMode) &&
+        (ADC_TRIGG_SRC_SW != groupObj->groupCfg.triggSrc) &&
+        (0xFFU != groupObj->groupCfg.groupDmaChannelId) &&
+        (Cdd_Dma_Config.CddDmaDriverHandler[groupObj->groupCfg.groupDmaChannelId]
+             ->edmaConfig.ownResource.channelGroup[0]
+             ->maxParam >= ADC_DMA_PING_PONG_NUM_PARAMS) &&
+        (numSamples >= 2U) && (0U == (numSamples & 1U)) && (numSamples <= ADC_DMA_PING_PONG_MAX_SAMPLES))
+    {
+        groupObj->pingPongHalfNotification = HalfNotification;
+        groupObj->pingPongFullNotification = FullNotification;
+        groupObj->pingPongHalf             = 0U;
+        groupObj->isPingPong               = (uint32)ADC_TRUE;
+        retVal                             = (Std_ReturnType)E_OK;
+    }
+
+    return (retVal);
+}
+
+void Adc_disablePingPongInternal(Adc_GroupObjType *groupObj)
+{
+    groupObj->isPingPong               = (uint32)ADC_FALSE;
+    groupObj->pingPongHalf             = 0U;
+    groupObj->pingPongHalfNotification = (Adc_PingPongNotifyType)NULL_PTR;
+    groupObj->pingPongFullNotification = (Adc_PingPongNotifyType)NULL_PTR;
+
+    return;
+}
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+
 #if (STD_ON == ADC_DEV_ERROR_DETECT)
 void Adc_reportDetError(uint8 apiId, uint8 errorId)
 {
@@ -2248,5 +2477,245 @@ Adc_StreamNumSampleType Adc_GetStreamLastPointerinternal(Adc_GroupType Group, Ad
     return (numSamples);
 }
 
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+/* Number of sets the consumer may hold: the ring less the sets the producer
+ * stores next (one set, or the half the DMA is filling in ping-pong mode),
+ * so that a resync never hands out a slot that is being overwritten. A
+ * single set buffer has no spare slot and is handed out whole. */
+static uint32 Adc_streamWindow(const Adc_GroupObjType *groupObj)
+{
+    uint32 numSamples = (uint32)groupObj->groupCfg.streamNumSamples;
+    uint32 nextSets   = 1U;
+    uint32 window     = numSamples;
+
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+    if (((uint32)ADC_TRUE) == groupObj->isPingPong)
+    {
+        nextSets = numSamples / 2U;
+    }
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+    if (numSamples > nextSets)
+    {
+        window = numSamples - nextSets;
+    }
+
+    return (window);
+}
+
+/* Producer side of the single-producer/single-consumer stream ring. Called
+ * from the conversion end ISR, the polling context or the DMA half buffer
+ * ISR once numSets complete sets are stored. Only streamWrIdx and
+ * streamOverrunCount are written here; streamRdIdx is owned by the consumer,
+ * so no lock is needed. */
+static void Adc_streamPublish(Adc_GroupObjType *groupObj, uint32 numSets)
+{
+    uint32 wrIdx    = groupObj->streamWrIdx;
+    uint32 inFlight = (wrIdx - groupObj->streamRdIdx) + numSets;
+    uint32 window   = Adc_streamWindow(groupObj);
+    uint32 lost;
+
+    /* Sets beyond the consumer window are lost if the consumer has not
+     * released them yet - the next store overwrites them */
+    if (inFlight > window)
+    {
+        lost = inFlight - window;
+        if (lost > numSets)
+        {
+            lost = numSets;
+        }
+        groupObj->streamOverrunCount += lost;
+    }
+
+    /* Publish after the samples are in the buffer */
+    groupObj->streamWrIdx = wrIdx + numSets;
+
+    return;
+}
+
+Adc_StreamNumSampleType Adc_streamAcquireInternal(Adc_GroupObjType *groupObj, Adc_ValueGroupType **PtrToSamplePtr)
+{
+    uint32                  wrIdx, rdIdx, avail, slot, numSamples, window;
+    Adc_StreamNumSampleType count = 0U;
+
+    numSamples = (uint32)groupObj->groupCfg.streamNumSamples;
+    window     = Adc_streamWindow(groupObj);
+    wrIdx      = groupObj->streamWrIdx;
+    rdIdx      = groupObj->streamRdIdx;
+    avail      = wrIdx - rdIdx;
+
+    if (avail > window)
+    {
+        /* Producer lapped the consumer - skip to the oldest set the producer
+         * does not store next. The loss is accounted in streamOverrunCount */
+        rdIdx                 = wrIdx - window;
+        groupObj->streamRdIdx = rdIdx;
+        avail                 = window;
+    }
+
+    if (avail > 0U)
+    {
+        /* Only return the part up to the buffer end, so that the samples of
+         * every channel are contiguous from the returned pointer */
+        slot = rdIdx % numSamples;
+        if (avail > (numSamples - slot))
+        {
+            avail = numSamples - slot;
+        }
+        *PtrToSamplePtr = groupObj->chObj[0U].chResultBufPtr + slot;
+        count           = (Adc_StreamNumSampleType)avail;
+    }
+    else
+    {
+        *PtrToSamplePtr = (Adc_ValueGroupType *)NULL_PTR;
+    }
+
+    return (count);
+}
+
+Std_ReturnType Adc_streamReleaseInternal(Adc_GroupObjType *groupObj, Adc_StreamNumSampleType Count)
+{
+    Std_ReturnType retVal = (Std_ReturnType)E_OK;
+    uint32         rdIdx  = groupObj->streamRdIdx;
+
+    if (((uint32)Count) > (groupObj->streamWrIdx - rdIdx))
+    {
+        /* Cannot release more than was published */
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        groupObj->streamRdIdx = rdIdx + (uint32)Count;
+    }
+
+    return (retVal);
+}
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+
+#if (STD_ON == ADC_PPB_API)
+/* Ties the PPBs owned by the group to the SOCs assigned at this start. A PPB
+ * can only follow one SOC, so the group started last owns it on the HW unit */
+static void Adc_ppbConfigure(const Adc_GroupObjType *groupObj, uint32 baseAddr)
+{
+    uint32                   ppbIdx;
+    uint16                   evtMask = 0U;
+    const Adc_PpbConfigType *ppbCfg;
+    Adc_mcalPPBNumber_t      ppbNum;
+
+    for (ppbIdx = 0U; ppbIdx < ADC_NUM_PPB; ppbIdx++)
+    {
+        if (0U != (groupObj->ppbUsedMask & (uint8)(1U << ppbIdx)))
+        {
+            ppbCfg = &groupObj->ppbCfg[ppbIdx];
+            ppbNum = (Adc_mcalPPBNumber_t)ppbIdx;
+
+            ADC_setupPPB(baseAddr, ppbNum, (uint16)(groupObj->socAssigned + groupObj->ppbChIdx[ppbIdx]));
+            ADC_setPPBCalibrationOffset(baseAddr, ppbNum, ppbCfg->calibrationOffset);
+            ADC_setPPBReferenceOffset(baseAddr, ppbNum, ppbCfg->referenceOffset, ppbCfg->twosComplement);
+            ADC_setPPBTripLimits(baseAddr, ppbNum, ppbCfg->tripHigh, ppbCfg->tripLow);
+
+            evtMask |= (uint16)((uint16)ADC_PPB_EVT_MASK << (ppbIdx * ADC_PPB_EVT_SHIFT));
+        }
+    }
+
+    if (0U != evtMask)
+    {
+        /* Drop events latched by a previous owner */
+        HW_WR_REG16((baseAddr + MCAL_CSL_ADC_ADCEVTCLR), evtMask);
+    }
+
+    return;
+}
+
+/* Dispatches PPB events latched during the last conversion round. The
+ * hardware does the compare, so this is one status read per round */
+static void Adc_ppbCheckEvents(const Adc_HwUnitObjType *hwUnitObj, const Adc_GroupObjType *groupObj)
+{
+    uint32                   ppbIdx;
+    uint16                   evtStat;
+    uint8                    events;
+    const Adc_PpbConfigType *ppbCfg;
+
+    if (0U != groupObj->ppbUsedMask)
+    {
+        evtStat = HW_RD_REG16(hwUnitObj->baseAddr + MCAL_CSL_ADC_ADCEVTSTAT);
+
+        for (ppbIdx = 0U; ppbIdx < ADC_NUM_PPB; ppbIdx++)
+        {
+            ppbCfg = &groupObj->ppbCfg[ppbIdx];
+            events = (uint8)((evtStat >> (ppbIdx * ADC_PPB_EVT_SHIFT)) & ADC_PPB_EVT_MASK);
+            events &= ppbCfg->eventMask;
+
+            if ((0U != (groupObj->ppbUsedMask & (uint8)(1U << ppbIdx))) && (0U != events))
+            {
+                HW_WR_REG16((hwUnitObj->baseAddr + MCAL_CSL_ADC_ADCEVTCLR),
+                            (uint16)((uint16)events << (ppbIdx * ADC_PPB_EVT_SHIFT)));
+
+                if ((Adc_PpbNotifyType)NULL_PTR != ppbCfg->notification)
+                {
+                    ppbCfg->notification(groupObj->groupCfg.groupId, groupObj->ppbChIdx[ppbIdx], events);
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+void Adc_setupPpbInternal(Adc_GroupObjType *groupObj, uint8 ChannelIdx, uint8 PpbNumber,
+                          const Adc_PpbConfigType *PpbCfgPtr)
+{
+    if ((const Adc_PpbConfigType *)NULL_PTR == PpbCfgPtr)
+    {
+        /* Release the PPB */
+        groupObj->ppbUsedMask &= (uint8)(~((uint8)(1U << PpbNumber)));
+    }
+    else
+    {
+        groupObj->ppbCfg[PpbNumber]   = *PpbCfgPtr;
+        groupObj->ppbChIdx[PpbNumber] = ChannelIdx;
+        groupObj->ppbUsedMask        |= (uint8)(1U << PpbNumber);
+    }
+
+    return;
+}
+
+sint32 Adc_readPpbResultInternal(const Adc_GroupObjType *groupObj, uint8 PpbNumber)
+{
+    return (ADC_readPPBResult(groupObj->hwUnitObj->resultBaseAddr, (Adc_mcalPPBNumber_t)PpbNumber));
+}
+
+/* Collapses each run of consecutive group channels that sample the same HW
+ * channel into its rounded mean. Returns the number of values written */
+uint8 Adc_averageOversampled(const Adc_GroupObjType *groupObj, Adc_ValueGroupType *DataBufferPtr,
+                             const Adc_ValueGroupType *SetPtr)
+{
+    uint32 chIdx, runStart, runLen, sum;
+    uint8  numValues = 0U;
+
+    runStart = 0U;
+    while (runStart < groupObj->groupCfg.numChannels)
+    {
+        sum    = (uint32)SetPtr[runStart];
+        runLen = 1U;
+        for (chIdx = runStart + 1U; chIdx < groupObj->groupCfg.numChannels; chIdx++)
+        {
+            if (groupObj->groupCfg.channelConfig[chIdx].hwChannelId !=
+                groupObj->groupCfg.channelConfig[runStart].hwChannelId)
+            {
+                break;
+            }
+            sum += (uint32)SetPtr[chIdx];
+            runLen++;
+        }
+
+        DataBufferPtr[numValues] = (Adc_ValueGroupType)((sum + (runLen / 2U)) / runLen);
+        numValues++;
+        runStart += runLen;
+    }
+
+    return (numValues);
+}
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
 #define ADC_STOP_SEC_CODE
 #include "Adc_MemMap.h"
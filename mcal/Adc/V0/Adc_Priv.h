@@ -147,6 +147,9 @@ typedef struct
 
     Adc_UtilsNode nodeObj;
     /**< Node object used for node memory to be used in link list */
+    Adc_GroupPriorityType priorityRank;
+    /**< Rank of groupPriority among the distinct priorities of the configured
+     *   groups, used as queue priority */
 
     uint32             validSampleCount;
     /**< Number of valid samples - incremented after conversion of all
@@ -160,6 +163,35 @@ typedef struct
     /**< Starting SOC Ptr assigned to group*/
     Adc_ChannelObjType chObj[ADC_NUM_CHANNEL];
     /**< Channel specific parameters */
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+    volatile uint32 streamWrIdx;
+    /**< Free running count of completed sample sets - written only by the
+     *   conversion end ISR/polling context (producer) */
+    volatile uint32 streamRdIdx;
+    /**< Free running count of released sample sets - written only by the
+     *   Adc_StreamRelease caller (consumer) */
+    volatile uint32 streamOverrunCount;
+    /**< Number of sample sets overwritten before they were released */
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+    uint32                 isPingPong;
+    /**< Flag to indicate whether the result buffer is filled by DMA as two
+     *   alternating halves */
+    uint32                 pingPongHalf;
+    /**< Half currently being filled by DMA - 0: ping, 1: pong */
+    Adc_PingPongNotifyType pingPongHalfNotification;
+    /**< Called when the ping (first) half is filled */
+    Adc_PingPongNotifyType pingPongFullNotification;
+    /**< Called when the pong (second) half is filled */
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+#if (STD_ON == ADC_PPB_API)
+    Adc_PpbConfigType ppbCfg[ADC_NUM_PPB];
+    /**< Post-processing block configuration owned by this group */
+    uint8             ppbChIdx[ADC_NUM_PPB];
+    /**< Group channel index each owned PPB is tied to */
+    uint8             ppbUsedMask;
+    /**< Bit n set - PPB n is owned by this group */
+#endif /* #if (STD_ON == ADC_PPB_API) */
 } Adc_GroupObjType;
 
 /**
@@ -255,6 +287,22 @@ void                    Adc_FillDataBufferPtr(Adc_ValueGroupType *DataBufferPtr,
 Adc_StreamNumSampleType Adc_GetStreamLastPointerinternal(Adc_GroupType Group, Adc_ValueGroupType **PtrToSamplePtr);
 Std_ReturnType          Adc_getStreamPtrCheckDetError(Adc_GroupType Group, Adc_ValueGroupType **PtrToSamplePtr);
 void                    Adc_checkChannelParams(const Adc_ChannelConfigType *chCfg);
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+Std_ReturnType Adc_enablePingPongInternal(Adc_GroupObjType *groupObj, Adc_PingPongNotifyType HalfNotification,
+                                          Adc_PingPongNotifyType FullNotification);
+void           Adc_disablePingPongInternal(Adc_GroupObjType *groupObj);
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+#if (STD_ON == ADC_PPB_API)
+void   Adc_setupPpbInternal(Adc_GroupObjType *groupObj, uint8 ChannelIdx, uint8 PpbNumber,
+                            const Adc_PpbConfigType *PpbCfgPtr);
+sint32 Adc_readPpbResultInternal(const Adc_GroupObjType *groupObj, uint8 PpbNumber);
+uint8  Adc_averageOversampled(const Adc_GroupObjType *groupObj, Adc_ValueGroupType *DataBufferPtr,
+                              const Adc_ValueGroupType *SetPtr);
+#endif /* #if (STD_ON == ADC_PPB_API) */
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+Adc_StreamNumSampleType Adc_streamAcquireInternal(Adc_GroupObjType *groupObj, Adc_ValueGroupType **PtrToSamplePtr);
+Std_ReturnType          Adc_streamReleaseInternal(Adc_GroupObjType *groupObj, Adc_StreamNumSampleType Count);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
 
 Std_ReturnType Adc_groupConversionDoneHandler(void);
 
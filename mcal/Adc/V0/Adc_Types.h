@@ -201,6 +201,58 @@ typedef P2FUNC(void, ADC_APPL_CODE, Adc_GroupEndNotifyType)(void);
 typedef Cdd_Edma_EventCallback Adc_DmaCallBackFunctionType;
 #endif
 
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+/** \brief Typedef for DMA ping-pong half/full buffer notification function
+ *  pointer. HalfBufPtr points to the first sample of the first channel of the
+ *  half that was just filled */
+typedef P2FUNC(void, ADC_APPL_CODE, Adc_PingPongNotifyType)(Adc_GroupType Group, Adc_ValueGroupType *HalfBufPtr);
+#endif
+
+#if (STD_ON == ADC_PPB_API)
+/** \brief Number of post-processing blocks per ADC HW unit */
+#define ADC_NUM_PPB (4U)
+
+/**
+ *  \name ADC PPB event flags
+ *  @{
+ */
+/** \brief PPB result above the high trip limit */
+#define ADC_PPB_EVT_TRIPHI ((uint8)0x01U)
+/** \brief PPB result below the low trip limit */
+#define ADC_PPB_EVT_TRIPLO ((uint8)0x02U)
+/** \brief PPB result changed sign (zero-crossing) */
+#define ADC_PPB_EVT_ZERO ((uint8)0x04U)
+/** @} */
+
+/** \brief Typedef for PPB event notification function pointer. EventMask is a
+ *  combination of ADC_PPB_EVT_* flags */
+typedef P2FUNC(void, ADC_APPL_CODE, Adc_PpbNotifyType)(Adc_GroupType Group, uint8 ChannelIdx, uint8 EventMask);
+
+/**
+ *  \brief ADC post-processing block configuration, applied at every start of
+ *  the group that owns it.
+ */
+typedef struct
+{
+    /** \brief Calibration offset subtracted from the raw result before it is
+     *   stored in the result register, -512 to 511 */
+    sint16            calibrationOffset;
+    /** \brief Reference subtracted from the result to give the PPB result */
+    uint16            referenceOffset;
+    /** \brief TRUE: PPB result is reference - result */
+    boolean           twosComplement;
+    /** \brief High trip limit on the PPB result (17-bit signed) */
+    sint32            tripHigh;
+    /** \brief Low trip limit on the PPB result (17-bit signed) */
+    sint32            tripLow;
+    /** \brief ADC_PPB_EVT_* flags reported through notification */
+    uint8             eventMask;
+    /** \brief Called from the group conversion end context on an event in
+     *   eventMask, may be NULL_PTR */
+    Adc_PpbNotifyType notification;
+} Adc_PpbConfigType;
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
 /** \brief Current status of the conversion of the requested ADC Channel group */
 
 /*
@@ -68,6 +68,11 @@
 #include "string.h"
 #include "Adc.h"
 #include "Adc_Priv.h"
+#if defined(__ARM_FEATURE_CLZ)
+/*LDRA_NOANALYSIS*/
+#include <arm_acle.h>
+/*LDRA_ANALYSIS*/
+#endif
 
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
@@ -85,10 +90,10 @@
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-static void    Adc_utilsLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node, void *data,
-                                      Adc_GroupPriorityType priority, uint32 isPaused);
-static void    Adc_utilsUnLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node);
-static boolean Adc_utilsFindLinkDoublePri(const Adc_UtilsLinkListObj *llobj, const Adc_UtilsNode *node);
+static void   Adc_utilsLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node, void *data,
+                                     Adc_GroupPriorityType priority, uint32 isPaused);
+static void   Adc_utilsUnLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node);
+static uint32 Adc_utilsFindMsb(uint32 value);
 
 /* ========================================================================== */
 /*                            Global Variables                                */
@@ -105,17 +110,26 @@ static boolean Adc_utilsFindLinkDoublePri(const Adc_UtilsLinkListObj *llobj, con
 
 void Adc_utilsInitLinkList(Adc_UtilsLinkListObj *llobj)
 {
+    uint32 idx;
+
     /* Initialize the variables */
-    llobj->headNode = (Adc_UtilsNode *)NULL_PTR;
-    llobj->tailNode = (Adc_UtilsNode *)NULL_PTR;
+    for (idx = 0U; idx < ADC_UTILS_NUM_PRI; idx++)
+    {
+        llobj->bucketHead[idx] = (Adc_UtilsNode *)NULL_PTR;
+        llobj->bucketTail[idx] = (Adc_UtilsNode *)NULL_PTR;
+    }
+    for (idx = 0U; idx < ADC_UTILS_PRI_MAP_WORDS; idx++)
+    {
+        llobj->priMap[idx] = 0U;
+    }
+    llobj->priMapSummary = 0U;
 
     return;
 }
 
 void Adc_utilsDeInitLinkList(Adc_UtilsLinkListObj *llobj)
 {
-    llobj->headNode = (Adc_UtilsNode *)NULL_PTR;
-    llobj->tailNode = (Adc_UtilsNode *)NULL_PTR;
+    Adc_utilsInitLinkList(llobj);
 
     return;
 }
@@ -141,13 +155,24 @@ void Adc_utilsInitNodeObject(Adc_UtilsNode *node)
     node->prev     = (Adc_UtilsNode *)NULL_PTR;
     node->data     = NULL_PTR;
     node->priority = 0U;
+    node->isLinked = FALSE;
 
     return;
 }
 
 Adc_UtilsNode *Adc_utilsGetHeadNode(const Adc_UtilsLinkListObj *llobj)
 {
-    return (llobj->headNode);
+    Adc_UtilsNode *headNode = (Adc_UtilsNode *)NULL_PTR;
+    uint32         wordIdx;
+
+    if (0U != llobj->priMapSummary)
+    {
+        /* Highest non-empty priority FIFO */
+        wordIdx  = Adc_utilsFindMsb(llobj->priMapSummary);
+        headNode = llobj->bucketHead[(wordIdx * 32U) + Adc_utilsFindMsb(llobj->priMap[wordIdx])];
+    }
+
+    return (headNode);
 }
 
 /**
@@ -159,99 +184,69 @@ Adc_UtilsNode *Adc_utilsGetHeadNode(const Adc_UtilsLinkListObj *llobj)
 static void Adc_utilsLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node, void *data,
                                    Adc_GroupPriorityType priority, uint32 isPaused)
 {
-    Adc_UtilsNode *curNode, *prevNode;
-    boolean        exitLoop = FALSE;
+    uint32 pri = (uint32)priority;
 
     node->data     = data;
     node->priority = priority;
+    node->isLinked = TRUE;
 
-    prevNode = (Adc_UtilsNode *)NULL_PTR;
-    /* Add to the list based on priority */
-    curNode = llobj->headNode;
-    while ((NULL_PTR != curNode) && (exitLoop == FALSE))
+    if ((uint32)ADC_TRUE == isPaused)
     {
-        /* Condition 1: Nodes with the same priority are added to the bottom
-         * of the existing nodes with same priority. So exit only if
-         * priority is high
-         * Condition 2: Nodes with the same priority are added to the top
-         * of the existing nodes with same priority. So exit if
-         * priority is high or same
-         */
-        if (((uint32)ADC_FALSE == isPaused) && (priority > curNode->priority))
-        {
-            exitLoop = TRUE;
-        }
-        else if (((uint32)ADC_TRUE == isPaused) && (priority >= curNode->priority))
+        /* Paused groups restart ahead of the groups with the same priority */
+        node->prev = (Adc_UtilsNode *)NULL_PTR;
+        node->next = llobj->bucketHead[pri];
+        if (NULL_PTR != node->next)
         {
-            exitLoop = TRUE;
+            node->next->prev = node;
         }
         else
         {
-            /* Move to next node */
-            prevNode = curNode;
-            curNode  = curNode->next;
+            llobj->bucketTail[pri] = node;
         }
-    }
-
-    /* Add the node between current and previous nodes */
-    node->next = curNode;
-    node->prev = prevNode;
-    if (NULL_PTR != prevNode)
-    {
-        prevNode->next = node;
+        llobj->bucketHead[pri] = node;
     }
     else
     {
-        /* Adding to the top of the list */
-        llobj->headNode = node;
+        /* New requests go behind the groups with the same priority */
+        node->next = (Adc_UtilsNode *)NULL_PTR;
+        node->prev = llobj->bucketTail[pri];
+        if (NULL_PTR != node->prev)
+        {
+            node->prev->next = node;
+        }
+        else
+        {
+            llobj->bucketHead[pri] = node;
+        }
+        llobj->bucketTail[pri] = node;
     }
 
-    if (NULL_PTR != curNode)
-    {
-        curNode->prev = node;
-    }
-    else
-    {
-        llobj->tailNode = node;
-    }
+    llobj->priMap[pri / 32U] |= ((uint32)1U << (pri % 32U));
+    llobj->priMapSummary     |= ((uint32)1U << (pri / 32U));
 
     return;
 }
 
-static boolean Adc_utilsFindLinkDoublePri(const Adc_UtilsLinkListObj *llobj, const Adc_UtilsNode *node)
-{
-    Adc_UtilsNode *curNode;
-    boolean        retVal = ADC_FALSE;
-
-    curNode = llobj->headNode;
-    while (NULL_PTR != curNode)
-    {
-        if (curNode == node)
-        {
-            retVal = ADC_TRUE;
-            break;
-        }
-        curNode = curNode->next;
-    }
-
-    return retVal;
-}
 /**
  *  Adc_utilsUnLinkDoublePri
  *  \brief Unlinks a node from a double link list.
  */
 static void Adc_utilsUnLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode *node)
 {
-    if (Adc_utilsFindLinkDoublePri(llobj, node) == ADC_FALSE)
+    uint32 pri;
+
+    if (FALSE == node->isLinked)
     {
         /* Node doesn't exist in the list */
     }
     else
     {
+        pri = (uint32)node->priority;
+
         if (NULL_PTR == node->prev)
         {
             /* Removing head node */
-            llobj->headNode = node->next;
+            llobj->bucketHead[pri] = node->next;
         }
         else
         {
@@ -265,16 +260,64 @@ static void Adc_utilsUnLinkDoublePri(Adc_UtilsLinkListObj *llobj, Adc_UtilsNode
         }
         else
         {
-            llobj->tailNode = node->prev;
+            llobj->bucketTail[pri] = node->prev;
+        }
+
+        if (NULL_PTR == llobj->bucketHead[pri])
+        {
+            llobj->priMap[pri / 32U] &= ~((uint32)1U << (pri % 32U));
+            if (0U == llobj->priMap[pri / 32U])
+            {
+                llobj->priMapSummary &= ~((uint32)1U << (pri / 32U));
+            }
         }
 
         /* Reset node memory */
-        node->next = (Adc_UtilsNode *)NULL_PTR;
-        node->prev = (Adc_UtilsNode *)NULL_PTR;
+        node->next     = (Adc_UtilsNode *)NULL_PTR;
+        node->prev     = (Adc_UtilsNode *)NULL_PTR;
+        node->isLinked = FALSE;
     }
 
     return;
 }
 
+/* Index of the most significant set bit, value must not be zero */
+static uint32 Adc_utilsFindMsb(uint32 value)
+{
+#if defined(__ARM_FEATURE_CLZ)
+    return (31U - (uint32)__clz(value));
+#else
+    uint32 msb = 0U;
+    uint32 rem = value;
+
+    if (0U != (rem & 0xFFFF0000U))
+    {
+        rem >>= 16U;
+        msb  += 16U;
+    }
+    if (0U != (rem & 0xFF00U))
+    {
+        rem >>= 8U;
+        msb  += 8U;
+    }
+    if (0U != (rem & 0xF0U))
+    {
+        rem >>= 4U;
+        msb  += 4U;
+    }
+    if (0U != (rem & 0xCU))
+    {
+        rem >>= 2U;
+        msb  += 2U;
+    }
+    if (0U != (rem & 0x2U))
+    {
+        msb += 1U;
+    }
+
+    return (msb);
+#endif /* #if defined(__ARM_FEATURE_CLZ) */
+}
+
 #define ADC_STOP_SEC_CODE
 #include "Adc_MemMap.h"
@@ -84,7 +84,11 @@ extern "C" {
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
-/* None */
+/** \brief Number of priority buckets of a list. Priorities are dense ranks of
+ *   the configured group priorities, so one bucket per group is enough */
+#define ADC_UTILS_NUM_PRI ((uint32)ADC_MAX_GROUP)
+/** \brief Number of 32-bit words of the priority bitmap */
+#define ADC_UTILS_PRI_MAP_WORDS ((ADC_UTILS_NUM_PRI + 31U) / 32U)
 
 /* ========================================================================== */
 /*                         Structure Declarations                             */
@@ -105,16 +109,25 @@ struct Adc_UtilsNode_t
     void                 *data;
     /** \brief Priority of the node. Used for priority based linked list. */
     Adc_GroupPriorityType priority;
+    /** \brief Node is in a list. */
+    boolean               isLinked;
 };
 
 /**  \brief Structure to the link list object information.
+ *   Nodes are kept in one FIFO per priority; a bit set in priMap marks a
+ *   non-empty FIFO and a bit set in priMapSummary a non-zero priMap word, so
+ *   insert, remove and highest priority lookup take constant time.
  */
 typedef struct
 {
-    /** \brief Head node reference pointer */
-    Adc_UtilsNode *headNode;
-    /** \brief Tail node reference pointer */
-    Adc_UtilsNode *tailNode;
+    /** \brief Head node of each priority FIFO */
+    Adc_UtilsNode *bucketHead[ADC_UTILS_NUM_PRI];
+    /** \brief Tail node of each priority FIFO */
+    Adc_UtilsNode *bucketTail[ADC_UTILS_NUM_PRI];
+    /** \brief Bit n - priority n FIFO is not empty */
+    uint32         priMap[ADC_UTILS_PRI_MAP_WORDS];
+    /** \brief Bit n - priMap[n] is not zero */
+    uint32         priMapSummary;
 } Adc_UtilsLinkListObj;
 
 /* ========================================================================== */
@@ -151,11 +164,11 @@ void Adc_utilsDeInitLinkList(Adc_UtilsLinkListObj *llobj);
  * \param[in] node Node object pointer used for linking.
  * \param[in] data Data pointer to add to node.
  * \param[in] priority Priority of the node used for priority based addition
- * of nodes. Priority is in ascending order of the value. So 0 is the lowest
- * priority and is added to the bottom of the node. Nodes with the same
- * priority are always added to the bottom of the existing nodes with same
- * priority. For non-priority based modes, this parameter is ignored and
- * could be set to 0.
+ * of nodes, less than ADC_UTILS_NUM_PRI. Priority is in ascending order of the
+ * value. So 0 is the lowest priority and is added to the bottom of the node.
+ * Nodes with the same priority are always added to the bottom of the existing
+ * nodes with same priority. For non-priority based modes, this parameter is
+ * ignored and could be set to 0.
  * \param[in] isPaused Flag to indiate if this group is paused mid way
  * and is queued back. This is required to put this group ahead of the
  * groups with the same priority as this group so that this group is given
@@ -306,6 +306,22 @@ extern "C" {
 #define ADC_SID_GET_READ_RESULT_BASE_ADDRESS ((uint8)0x17U)
 /** \brief Adc_SetInterruptContinuousMode() API Service ID */
 #define ADC_SID_SET_INTERRUPT_CONTINUOUS_MODE ((uint8)0x18U)
+/** \brief Adc_StreamAcquire() API Service ID */
+#define ADC_SID_STREAM_ACQUIRE ((uint8)0x19U)
+/** \brief Adc_StreamRelease() API Service ID */
+#define ADC_SID_STREAM_RELEASE ((uint8)0x1AU)
+/** \brief Adc_GetStreamOverrunCount() API Service ID */
+#define ADC_SID_GET_STREAM_OVERRUN_COUNT ((uint8)0x1BU)
+/** \brief Adc_EnablePingPong() API Service ID */
+#define ADC_SID_ENABLE_PING_PONG ((uint8)0x1CU)
+/** \brief Adc_DisablePingPong() API Service ID */
+#define ADC_SID_DISABLE_PING_PONG ((uint8)0x1DU)
+/** \brief Adc_SetupPpb() API Service ID */
+#define ADC_SID_SETUP_PPB ((uint8)0x1EU)
+/** \brief Adc_ReadPpbResult() API Service ID */
+#define ADC_SID_READ_PPB_RESULT ((uint8)0x1FU)
+/** \brief Adc_ReadGroupOversampled() API Service ID */
+#define ADC_SID_READ_GROUP_OVERSAMPLED ((uint8)0x21U)
 
 /**   @} */
 /* ========================================================================== */
@@ -759,6 +775,210 @@ FUNC(uint32, ADC_CODE) Adc_GetReadResultBaseAddress(VAR(Adc_GroupType, AUTOMATIC
  */
 FUNC(Std_ReturnType, ADC_CODE) Adc_SetInterruptContinuousMode(VAR(Adc_GroupType, AUTOMATIC) Group);
 
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+/**
+ * \brief Acquires the oldest unreleased sample sets of a streaming group.
+ *
+ * Lock-free consumer side of the group result buffer, used as a ring of
+ * streamNumSamples sample sets. The conversion end ISR (or the polling
+ * context) publishes each completed set; this service returns a pointer to
+ * the oldest set not yet released and the number of sets available
+ * contiguously from it (up to the end of the result buffer). Samples of
+ * channel k are at PtrToSamplePtr[k * streamNumSamples + i]. The driver
+ * never waits for the consumer: at most streamNumSamples - 1 sets (one half
+ * in ping-pong mode) are handed out, the slot(s) stored next are held back,
+ * and a set not released before the driver comes round to its slot again is
+ * overwritten, even while acquired. Overwritten sets are counted in
+ * Adc_GetStreamOverrunCount(); check it after processing the acquired sets
+ * to know whether they were intact.
+ *
+ * Only one consumer per group is supported, on the same core as the ADC
+ * ISR. Adc_ReadGroup and Adc_GetStreamLastPointer do not release sets.
+ *
+ * Service ID[hex] - 0x19
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant for different groups
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[out] PtrToSamplePtr Pointer to the first acquired sample of the first channel.
+ * \param[out] CountPtr Number of sample sets available from PtrToSamplePtr.
+ * \return Std_ReturnType. E_OK - sets available, E_NOT_OK - nothing available or DET error
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_StreamAcquire(Adc_GroupType Group, Adc_ValueGroupType **PtrToSamplePtr, Adc_StreamNumSampleType *CountPtr);
+
+/**
+ * \brief Releases sample sets acquired with Adc_StreamAcquire().
+ *
+ * Hands Count sets back to the driver so that they can be overwritten.
+ * Count may be less than the number acquired.
+ *
+ * Service ID[hex] - 0x1A
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant for different groups
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[in] Count Number of sample sets to release.
+ * \return Std_ReturnType. E_OK - released, E_NOT_OK - Count exceeds the published sets
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE) Adc_StreamRelease(Adc_GroupType Group, Adc_StreamNumSampleType Count);
+
+/**
+ * \brief Returns the number of sample sets the driver overwrote before
+ * they were released.
+ *
+ * The counter is cumulative since Adc_Init and is not reset on group start.
+ *
+ * Service ID[hex] - 0x1B
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \return uint32 Overrun count
+ *
+ *****************************************************************************/
+FUNC(uint32, ADC_CODE) Adc_GetStreamOverrunCount(Adc_GroupType Group);
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+/**
+ * \brief Switches a DMA group to continuous ping-pong capture.
+ *
+ * From the next group start the group DMA channel fills the result buffer as
+ * two halves of streamNumSamples/2 sets each, alternately and without end,
+ * using three linked PaRAM sets of the group DMA handler (the handler must own
+ * at least three PaRAM sets). The CPU is only interrupted when a half is
+ * full: HalfNotification is called for the first (ping) half and
+ * FullNotification for the second (pong) half, with a pointer to the first
+ * sample of the first channel of that half. The result buffer layout is the
+ * usual one - samples of channel k start at k * streamNumSamples. If the
+ * buffer is cacheable, invalidate the half before reading it.
+ * Group status is ADC_COMPLETED after the ping half and ADC_STREAM_COMPLETED
+ * after the pong half. The group runs until it is stopped. Adc_ReadGroup and
+ * Adc_GetStreamLastPointer return the last sample of the latest completed half.
+ *
+ * Service ID[hex] - 0x1C
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant for different groups
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[in] HalfNotification Called when the ping half is filled, may be NULL_PTR.
+ * \param[in] FullNotification Called when the pong half is filled, may be NULL_PTR.
+ * \return Std_ReturnType. E_OK - enabled, E_NOT_OK - group busy, not a DMA group,
+ *         software triggered group, DMA handler with fewer than three PaRAM sets
+ *         or streamNumSamples is odd
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_EnablePingPong(Adc_GroupType Group, Adc_PingPongNotifyType HalfNotification,
+                   Adc_PingPongNotifyType FullNotification);
+
+/**
+ * \brief Returns a group to the default single transfer DMA mode.
+ *
+ * Takes effect from the next group start.
+ *
+ * Service ID[hex] - 0x1D
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant for different groups
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \return Std_ReturnType. E_OK - disabled, E_NOT_OK - group busy
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE) Adc_DisablePingPong(Adc_GroupType Group);
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+
+#if (STD_ON == ADC_PPB_API)
+/**
+ * \brief Attaches a post-processing block (PPB) to one channel of a group.
+ *
+ * From the next group start the PPB follows the SOC of group channel
+ * ChannelIdx: the calibration offset is subtracted from the raw result (the
+ * corrected value is also what Adc_ReadGroup returns for that channel), the
+ * reference offset is subtracted to form the PPB result, and the PPB result is
+ * compared against the trip limits and checked for zero crossings. Events
+ * selected in eventMask are reported through notification once per conversion
+ * round, from the group conversion end context. For DMA access groups they are
+ * reported once per DMA completion (per half with ping-pong), so events of
+ * several rounds are merged into one notification.
+ * A PPB is a HW unit resource; the group started last on the unit owns it.
+ * Passing NULL_PTR for PpbCfgPtr releases the PPB from the group. Not
+ * available for groups using the limit check, which already use the PPBs.
+ *
+ * Service ID[hex] - 0x1E
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant for different groups
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[in] ChannelIdx Index of the channel inside the group.
+ * \param[in] PpbNumber PPB to use, 0 to ADC_NUM_PPB - 1.
+ * \param[in] PpbCfgPtr PPB configuration, copied by the driver, or NULL_PTR.
+ * \return Std_ReturnType. E_OK - configured, E_NOT_OK - group busy or invalid parameter
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_SetupPpb(Adc_GroupType Group, uint8 ChannelIdx, uint8 PpbNumber, const Adc_PpbConfigType *PpbCfgPtr);
+
+/**
+ * \brief Reads the latest offset corrected result of a PPB owned by the group.
+ *
+ * Service ID[hex] - 0x1F
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[in] PpbNumber PPB to read.
+ * \param[out] ResultPtr Sign extended PPB result.
+ * \return Std_ReturnType. E_OK - result read, E_NOT_OK - PPB not owned by the group
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadPpbResult(Adc_GroupType Group, uint8 PpbNumber, sint32 *ResultPtr);
+
+#if (STD_ON == ADC_READ_GROUP_API)
+/**
+ * \brief Reads the latest group results with oversampled channels averaged.
+ *
+ * Consecutive group channels configured with the same HW channel are treated
+ * as one oversampled channel: their results are replaced by a single rounded
+ * mean. DataBufferPtr receives one value per distinct run, in group order.
+ * The ADC has no hardware accumulator, so the oversampling ratio is bounded
+ * by the number of channels of a group. Status handling is that of
+ * Adc_ReadGroup.
+ *
+ * Service ID[hex] - 0x21
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Group Numeric ID of requested ADC channel group.
+ * \param[out] DataBufferPtr Averaged values, at most numChannels entries.
+ * \param[out] NumValuesPtr Number of values written.
+ * \return Std_ReturnType. E_OK - results read, E_NOT_OK - no results available
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_ReadGroupOversampled(Adc_GroupType Group, Adc_ValueGroupType *DataBufferPtr, uint8 *NumValuesPtr);
+#endif /* #if (STD_ON == ADC_READ_GROUP_API) */
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,309 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     Adc_PostProc.h
+ *
+ *  \brief    ADC result post-processing kernels
+ *  Fixed-point scaling, batch statistics and decimation on arrays of
+ *  Adc_ValueGroupType as returned by Adc_ReadGroup or placed in the group
+ *  result buffer. The kernels do not access the hardware and can be called
+ *  from any context. On targets with the ARM DSP extension (R5F) the inner
+ *  loops use the SIMD32 and saturation intrinsics, otherwise plain C.
+ *  A resolver pipeline (demodulation, atan2, tracking loop) processes the
+ *  sin/cos channels of a group batch by batch, e.g. per ping-pong half.
+ *
+ */
+
+#ifndef ADC_POSTPROC_H_
+#define ADC_POSTPROC_H_
+
+/**
+ * \addtogroup ADC Adc API GUIDE Header file
+ * @{
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+/*LDRA_NOANALYSIS*/
+#include "Std_Types.h"
+/*LDRA_ANALYSIS*/
+#include "Adc_Cfg.h"
+#include "Adc_Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (STD_ON == ADC_POST_PROC_API)
+/* ========================================================================== */
+/*                         Structures and Enums                               */
+/* ========================================================================== */
+
+/**
+ *  \brief Running statistics over a window of ADC samples. Initialize with
+ *   Adc_PostProcStatsInit, feed with Adc_PostProcStatsUpdate and read with
+ *   Adc_PostProcStatsGet. Do not modify the members directly.
+ */
+typedef struct
+{
+    /** \brief Number of samples accumulated */
+    uint32             count;
+    /** \brief Sum of the samples */
+    uint64             sum;
+    /** \brief Sum of the squared samples */
+    uint64             sumSq;
+    /** \brief Smallest sample */
+    Adc_ValueGroupType min;
+    /** \brief Largest sample */
+    Adc_ValueGroupType max;
+} Adc_PostProcAccType;
+
+/**
+ *  \brief Statistics of a window, rounded to the nearest integer.
+ */
+typedef struct
+{
+    /** \brief Smallest sample */
+    Adc_ValueGroupType min;
+    /** \brief Largest sample */
+    Adc_ValueGroupType max;
+    /** \brief Mean */
+    Adc_ValueGroupType mean;
+    /** \brief Root mean square */
+    Adc_ValueGroupType rms;
+} Adc_PostProcStatsType;
+
+/**
+ *  \brief Resolver pipeline configuration. Angles are unsigned Q32 fractions
+ *   of a revolution, 0x40000000 is 90 degrees.
+ */
+typedef struct
+{
+    /** \brief Excitation reference over one excitation period in Q15, one
+     *   entry per ADC sample, phase compensated for the resolver delay. Must
+     *   stay valid while the pipeline is used */
+    const sint16 *carrierPtr;
+    /** \brief ADC samples per excitation period, entries in carrierPtr */
+    uint32        samplesPerPeriod;
+    /** \brief ADC code of zero signal, subtracted before demodulation */
+    sint16        offset;
+    /** \brief Tracking loop proportional gain in Q15 */
+    sint16        kpQ15;
+    /** \brief Tracking loop integral gain in Q15 */
+    sint16        kiQ15;
+} Adc_PostProcResolverConfigType;
+
+/**
+ *  \brief Resolver pipeline state. Initialize with Adc_PostProcResolverInit.
+ *   angle and velocity are the tracking loop outputs and can be read between
+ *   calls to Adc_PostProcResolverProcess.
+ */
+typedef struct
+{
+    /** \brief Configuration */
+    const Adc_PostProcResolverConfigType *cfgPtr;
+    /** \brief Position inside the excitation period */
+    uint32                                phaseIdx;
+    /** \brief Partial demodulation sum of the sin channel */
+    sint64                                sinAcc;
+    /** \brief Partial demodulation sum of the cos channel */
+    sint64                                cosAcc;
+    /** \brief Angle measured by atan2 in the last period */
+    uint32                                measAngle;
+    /** \brief Tracked angle */
+    uint32                                angle;
+    /** \brief Tracked velocity, angle units per excitation period */
+    sint32                                velocity;
+} Adc_PostProcResolverType;
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+/**
+ * \brief Offset-corrects and scales samples with a Q15 gain.
+ *
+ * DstPtr[i] = sat16(((SrcPtr[i] - Offset) * GainQ15) >> (15 - Shift)), where
+ * Shift moves the result up to the wanted output format, e.g. Shift = 3 turns a
+ * 12-bit result into Q15 of the full scale. Samples must be below 0x8000,
+ * which holds for every ADC resolution of this device.
+ *
+ * \param[in] SrcPtr Samples.
+ * \param[out] DstPtr Scaled samples, may not alias SrcPtr.
+ * \param[in] NumSamples Number of samples.
+ * \param[in] Offset Value subtracted from each sample.
+ * \param[in] GainQ15 Gain in Q15, 0x7FFF is close to 1.0.
+ * \param[in] Shift Output shift, 0 to 15.
+ *
+ *****************************************************************************/
+void Adc_PostProcScaleQ15(const Adc_ValueGroupType *SrcPtr, sint16 *DstPtr, uint32 NumSamples, sint16 Offset,
+                          sint16 GainQ15, uint8 Shift);
+
+/**
+ * \brief Offset-corrects and scales samples with a Q31 gain.
+ *
+ * DstPtr[i] = sat32(((SrcPtr[i] - Offset) * GainQ31) >> (31 - Shift)).
+ *
+ * \param[in] SrcPtr Samples.
+ * \param[out] DstPtr Scaled samples.
+ * \param[in] NumSamples Number of samples.
+ * \param[in] Offset Value subtracted from each sample.
+ * \param[in] GainQ31 Gain in Q31.
+ * \param[in] Shift Output shift, 0 to 31.
+ *
+ *****************************************************************************/
+void Adc_PostProcScaleQ31(const Adc_ValueGroupType *SrcPtr, sint32 *DstPtr, uint32 NumSamples, sint32 Offset,
+                          sint32 GainQ31, uint8 Shift);
+
+/**
+ * \brief Starts a new statistics window.
+ *
+ * \param[out] AccPtr Accumulator.
+ *
+ *****************************************************************************/
+void Adc_PostProcStatsInit(Adc_PostProcAccType *AccPtr);
+
+/**
+ * \brief Adds samples to a statistics window.
+ *
+ * Can be called repeatedly, e.g. once per Adc_ReadGroup or per streamed
+ * buffer, to build a window longer than one call. Samples must be below 0x8000.
+ *
+ * \param[in,out] AccPtr Accumulator.
+ * \param[in] SrcPtr Samples.
+ * \param[in] NumSamples Number of samples.
+ *
+ *****************************************************************************/
+void Adc_PostProcStatsUpdate(Adc_PostProcAccType *AccPtr, const Adc_ValueGroupType *SrcPtr, uint32 NumSamples);
+
+/**
+ * \brief Returns min, max, mean and RMS of the window.
+ *
+ * \param[in] AccPtr Accumulator.
+ * \param[out] StatsPtr Statistics.
+ * \return Std_ReturnType. E_OK - statistics valid, E_NOT_OK - window is empty
+ *
+ *****************************************************************************/
+Std_ReturnType Adc_PostProcStatsGet(const Adc_PostProcAccType *AccPtr, Adc_PostProcStatsType *StatsPtr);
+
+/**
+ * \brief Boxcar decimation filter.
+ *
+ * Every Factor consecutive samples are replaced by their rounded mean.
+ * Trailing samples that do not fill a block are ignored. DstPtr may be equal
+ * to SrcPtr for in-place decimation.
+ *
+ * \param[in] SrcPtr Samples.
+ * \param[out] DstPtr Decimated samples, NumSamples / Factor entries.
+ * \param[in] NumSamples Number of samples.
+ * \param[in] Factor Decimation factor, at least 1.
+ * \return Number of samples written to DstPtr.
+ *
+ *****************************************************************************/
+uint32 Adc_PostProcDecimate(const Adc_ValueGroupType *SrcPtr, Adc_ValueGroupType *DstPtr, uint32 NumSamples,
+                            uint32 Factor);
+
+/**
+ * \brief Four-quadrant arc tangent by CORDIC.
+ *
+ * \param[in] Y Sine component.
+ * \param[in] X Cosine component.
+ * \return Angle of (X, Y) as unsigned Q32 fraction of a revolution, 0 for (0, 0).
+ *
+ *****************************************************************************/
+uint32 Adc_PostProcAtan2(sint32 Y, sint32 X);
+
+/**
+ * \brief Resets a resolver pipeline to angle 0 and velocity 0.
+ *
+ * \param[out] ObjPtr Pipeline state.
+ * \param[in] CfgPtr Configuration, referenced not copied.
+ *
+ *****************************************************************************/
+void Adc_PostProcResolverInit(Adc_PostProcResolverType *ObjPtr, const Adc_PostProcResolverConfigType *CfgPtr);
+
+/**
+ * \brief Runs a batch of resolver samples through the pipeline.
+ *
+ * Each completed excitation period is demodulated against the carrier, turned
+ * into a measured angle by Adc_PostProcAtan2 and fed to a type II tracking
+ * loop that updates angle and velocity. A period may span two batches. With
+ * ping-pong DMA, call this from the half notification with the sin and cos
+ * channel of the half, i.e. HalfPtr + k * streamNumSamples.
+ *
+ * \param[in,out] ObjPtr Pipeline state.
+ * \param[in] SinPtr Sin channel samples.
+ * \param[in] CosPtr Cos channel samples.
+ * \param[in] NumSamples Samples per channel.
+ * \param[out] AnglePtr Tracked angle after each completed period, may be NULL_PTR.
+ *  Needs room for NumSamples / samplesPerPeriod + 1 entries.
+ * \return Number of completed excitation periods.
+ *
+ *****************************************************************************/
+uint32 Adc_PostProcResolverProcess(Adc_PostProcResolverType *ObjPtr, const Adc_ValueGroupType *SinPtr,
+                                   const Adc_ValueGroupType *CosPtr, uint32 NumSamples, uint32 *AnglePtr);
+#endif /* #if (STD_ON == ADC_POST_PROC_API) */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* #ifndef ADC_POSTPROC_H_ */
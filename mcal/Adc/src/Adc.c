@@ -1100,5 +1100,397 @@ Adc_ReadTemperatureResult(Adc_GroupType Group, Adc_TempSensValueType *TempValues
 }
 #endif /* #if (STD_ON == ADC_READ_TEMPERATURE_API) */
 
+#if (STD_ON == ADC_STREAM_ACQUIRE_API)
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_StreamAcquire(Adc_GroupType Group, Adc_ValueGroupType **PtrToSamplePtr, Adc_StreamNumSampleType *CountPtr)
+{
+    Std_ReturnType          retVal = (Std_ReturnType)E_OK;
+    Adc_StreamNumSampleType count  = 0U;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_StreamAcquire */
+        Adc_reportDetError(ADC_SID_STREAM_ACQUIRE, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_STREAM_ACQUIRE, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if ((NULL_PTR == PtrToSamplePtr) || (NULL_PTR == CountPtr))
+    {
+        /* Report DET if output pointers are NULL */
+        Adc_reportDetError(ADC_SID_STREAM_ACQUIRE, ADC_E_PARAM_POINTER);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        /* No exclusive area - the ISR only writes the producer index */
+        count     = Adc_streamAcquireInternal(&Adc_DrvObj.groupObj[Group], PtrToSamplePtr);
+        *CountPtr = count;
+        if (0U == count)
+        {
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    return (retVal);
+}
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_StreamRelease(Adc_GroupType Group, Adc_StreamNumSampleType Count)
+{
+    Std_ReturnType retVal = (Std_ReturnType)E_OK;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_StreamRelease */
+        Adc_reportDetError(ADC_SID_STREAM_RELEASE, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_STREAM_RELEASE, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        retVal = Adc_streamReleaseInternal(&Adc_DrvObj.groupObj[Group], Count);
+    }
+
+    return (retVal);
+}
+
+FUNC(uint32, ADC_CODE) Adc_GetStreamOverrunCount(Adc_GroupType Group)
+{
+    uint32 overrunCount = 0U;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_GetStreamOverrunCount */
+        Adc_reportDetError(ADC_SID_GET_STREAM_OVERRUN_COUNT, ADC_E_UNINIT);
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_GET_STREAM_OVERRUN_COUNT, ADC_E_PARAM_GROUP);
+    }
+    else
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+    {
+        overrunCount = Adc_DrvObj.groupObj[Group].streamOverrunCount;
+    }
+
+    return (overrunCount);
+}
+#endif /* #if (STD_ON == ADC_STREAM_ACQUIRE_API) */
+
+#if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API))
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_EnablePingPong(Adc_GroupType Group, Adc_PingPongNotifyType HalfNotification,
+                   Adc_PingPongNotifyType FullNotification)
+{
+    Std_ReturnType    retVal = (Std_ReturnType)E_OK;
+    Adc_GroupObjType *groupObj;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_EnablePingPong */
+        Adc_reportDetError(ADC_SID_ENABLE_PING_PONG, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_ENABLE_PING_PONG, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        groupObj = &Adc_DrvObj.groupObj[Group];
+
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_0();
+
+        if (ADC_IDLE != groupObj->groupStatus)
+        {
+            /* Report DET if the group is converting */
+            Adc_reportDetRuntimeError(ADC_SID_ENABLE_PING_PONG, ADC_E_BUSY);
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            retVal = Adc_enablePingPongInternal(groupObj, HalfNotification, FullNotification);
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+            if (((Std_ReturnType)E_NOT_OK) == retVal)
+            {
+                /* Report DET if the group cannot be captured as ping-pong */
+                Adc_reportDetError(ADC_SID_ENABLE_PING_PONG, ADC_E_PARAM_GROUP);
+            }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+        }
+
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_0();
+    }
+
+    return (retVal);
+}
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_DisablePingPong(Adc_GroupType Group)
+{
+    Std_ReturnType    retVal = (Std_ReturnType)E_OK;
+    Adc_GroupObjType *groupObj;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_DisablePingPong */
+        Adc_reportDetError(ADC_SID_DISABLE_PING_PONG, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_DISABLE_PING_PONG, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        groupObj = &Adc_DrvObj.groupObj[Group];
+
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_0();
+
+        if (ADC_IDLE != groupObj->groupStatus)
+        {
+            /* Report DET if the group is converting */
+            Adc_reportDetRuntimeError(ADC_SID_DISABLE_PING_PONG, ADC_E_BUSY);
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            Adc_disablePingPongInternal(groupObj);
+        }
+
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_0();
+    }
+
+    return (retVal);
+}
+#endif /* #if ((STD_ON == ADC_DMA_MODE) && (STD_ON == ADC_DMA_PING_PONG_API)) */
+
+#if (STD_ON == ADC_PPB_API)
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_SetupPpb(Adc_GroupType Group, uint8 ChannelIdx, uint8 PpbNumber, const Adc_PpbConfigType *PpbCfgPtr)
+{
+    Std_ReturnType    retVal = (Std_ReturnType)E_OK;
+    Adc_GroupObjType *groupObj;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_SetupPpb */
+        Adc_reportDetError(ADC_SID_SETUP_PPB, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_SETUP_PPB, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if ((PpbNumber >= ADC_NUM_PPB) || (ChannelIdx >= Adc_DrvObj.groupObj[Group].groupCfg.numChannels))
+    {
+        /* Report DET if PPB or channel index is out of range */
+        Adc_reportDetError(ADC_SID_SETUP_PPB, ADC_E_PARAM_CONFIG);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+#if (STD_ON == ADC_ENABLE_LIMIT_CHECK)
+    else if (TRUE == Adc_DrvObj.groupObj[Group].groupCfg.grouplimitcheck)
+    {
+        /* Report DET if the PPBs are already used by the group limit check */
+        Adc_reportDetError(ADC_SID_SETUP_PPB, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+#endif /* #if (STD_ON == ADC_ENABLE_LIMIT_CHECK) */
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        groupObj = &Adc_DrvObj.groupObj[Group];
+
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_0();
+
+        if (ADC_IDLE != groupObj->groupStatus)
+        {
+            /* Report DET if the group is converting */
+            Adc_reportDetRuntimeError(ADC_SID_SETUP_PPB, ADC_E_BUSY);
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            Adc_setupPpbInternal(groupObj, ChannelIdx, PpbNumber, PpbCfgPtr);
+        }
+
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_0();
+    }
+
+    return (retVal);
+}
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadPpbResult(Adc_GroupType Group, uint8 PpbNumber, sint32 *ResultPtr)
+{
+    Std_ReturnType          retVal = (Std_ReturnType)E_OK;
+    const Adc_GroupObjType *groupObj;
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_ReadPpbResult */
+        Adc_reportDetError(ADC_SID_READ_PPB_RESULT, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_READ_PPB_RESULT, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (NULL_PTR == ResultPtr)
+    {
+        /* Report DET if result pointer is NULL */
+        Adc_reportDetError(ADC_SID_READ_PPB_RESULT, ADC_E_PARAM_POINTER);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (PpbNumber >= ADC_NUM_PPB)
+    {
+        /* Report DET if PPB index is out of range */
+        Adc_reportDetError(ADC_SID_READ_PPB_RESULT, ADC_E_PARAM_CONFIG);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        groupObj = &Adc_DrvObj.groupObj[Group];
+
+        if (0U == (groupObj->ppbUsedMask & (uint8)(1U << PpbNumber)))
+        {
+            /* PPB is not owned by this group */
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            *ResultPtr = Adc_readPpbResultInternal(groupObj, PpbNumber);
+        }
+    }
+
+    return (retVal);
+}
+
+#if (STD_ON == ADC_READ_GROUP_API)
+FUNC(Std_ReturnType, ADC_CODE)
+Adc_ReadGroupOversampled(Adc_GroupType Group, Adc_ValueGroupType *DataBufferPtr, uint8 *NumValuesPtr)
+{
+    Std_ReturnType     retVal = (Std_ReturnType)E_OK;
+    Adc_GroupObjType  *groupObj;
+    Adc_ValueGroupType setBuf[ADC_NUM_CHANNEL];
+
+#if (STD_ON == ADC_DEV_ERROR_DETECT)
+    if (((uint32)ADC_FALSE) == Adc_DrvIsInit)
+    {
+        /* Report DET if driver not initialised before calling Adc_ReadGroupOversampled */
+        Adc_reportDetError(ADC_SID_READ_GROUP_OVERSAMPLED, ADC_E_UNINIT);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if (Group >= Adc_DrvObj.maxGroup)
+    {
+        /* Report DET if group provided exceeds maximum groups*/
+        Adc_reportDetError(ADC_SID_READ_GROUP_OVERSAMPLED, ADC_E_PARAM_GROUP);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if ((NULL_PTR == DataBufferPtr) || (NULL_PTR == NumValuesPtr))
+    {
+        /* Report DET if databuffer or count pointer is NULL */
+        Adc_reportDetError(ADC_SID_READ_GROUP_OVERSAMPLED, ADC_E_PARAM_POINTER);
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+#endif /* #if (STD_ON == ADC_DEV_ERROR_DETECT) */
+
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        groupObj = &Adc_DrvObj.groupObj[Group];
+
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_0();
+
+        if (ADC_IDLE == groupObj->groupStatus)
+        {
+            /* Report DET if required group to read is idle */
+            Adc_reportDetRuntimeError(ADC_SID_READ_GROUP_OVERSAMPLED, ADC_E_IDLE);
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else if (ADC_BUSY == groupObj->groupStatus)
+        {
+            retVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            Adc_FillDataBufferPtr(&setBuf[0U], groupObj);
+        }
+
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_0();
+
+        if (((Std_ReturnType)E_OK) == retVal)
+        {
+            /* Averaging runs outside the critical section on the local copy */
+            *NumValuesPtr = Adc_averageOversampled(groupObj, DataBufferPtr, &setBuf[0U]);
+        }
+    }
+
+    return (retVal);
+}
+#endif /* #if (STD_ON == ADC_READ_GROUP_API) */
+#endif /* #if (STD_ON == ADC_PPB_API) */
+
 #define ADC_STOP_SEC_CODE
 #include "Adc_MemMap.h"
@@ -0,0 +1,517 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     Adc_PostProc.c
+ *
+ *  \brief    ADC result post-processing kernels
+ *  The kernels are pure functions on caller buffers and do no DET checks.
+ *  Loops are kept free of calls and aliasing so the compiler can unroll them;
+ *  where the compiler cannot find the packed forms by itself, the SIMD32
+ *  intrinsics are used on targets with the ARM DSP extension.
+ *
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+#include "Adc_PostProc.h"
+
+#if (STD_ON == ADC_POST_PROC_API)
+#if defined(__ARM_FEATURE_SIMD32) && defined(__ARM_FEATURE_SAT)
+/*LDRA_NOANALYSIS*/
+#include <arm_acle.h>
+#include "string.h"
+/*LDRA_ANALYSIS*/
+#define ADC_POSTPROC_USE_DSP (STD_ON)
+#else
+#define ADC_POSTPROC_USE_DSP (STD_OFF)
+#endif
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/* Two unsigned 16-bit ones, the second SMLALD operand for a packed sum */
+#define ADC_POSTPROC_PAIR_ONES (0x00010001U)
+
+/* CORDIC iterations, one angle bit each beyond the first */
+#define ADC_POSTPROC_CORDIC_ITER (20U)
+/* CORDIC input magnitude after normalization, leaves room for the 1.647 gain */
+#define ADC_POSTPROC_CORDIC_NORM (0x10000000U)
+/* Half a revolution in Q32 */
+#define ADC_POSTPROC_ANGLE_HALF (0x80000000U)
+
+/* ========================================================================== */
+/*                 Internal Function Declarations                             */
+/* ========================================================================== */
+
+static inline sint32 Adc_postProcSat16(sint32 value);
+static inline sint32 Adc_postProcSat32(sint64 value);
+static uint32        Adc_postProcSqrt(uint32 value);
+static void          Adc_postProcResolverTrack(Adc_PostProcResolverType *ObjPtr, sint64 sinAcc, sint64 cosAcc);
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+#define ADC_START_SEC_CONST_32
+#include "Adc_MemMap.h"
+
+/** \brief atan(2^-i) in Q32 fractions of a revolution */
+static const uint32 Adc_PostProcCordicAtanTbl[ADC_POSTPROC_CORDIC_ITER] = {
+    0x20000000U, 0x12E4051EU, 0x09FB385BU, 0x051111D4U, 0x028B0D43U, 0x0145D7E1U, 0x00A2F61EU,
+    0x00517C55U, 0x0028BE53U, 0x00145F2FU, 0x000A2F98U, 0x000517CCU, 0x00028BE6U, 0x000145F3U,
+    0x0000A2FAU, 0x0000517DU, 0x000028BEU, 0x0000145FU, 0x00000A30U, 0x00000518U};
+
+#define ADC_STOP_SEC_CONST_32
+#include "Adc_MemMap.h"
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+#define ADC_START_SEC_CODE
+#include "Adc_MemMap.h"
+
+void Adc_PostProcScaleQ15(const Adc_ValueGroupType *SrcPtr, sint16 *DstPtr, uint32 NumSamples, sint16 Offset,
+                          sint16 GainQ15, uint8 Shift)
+{
+    uint32 idx;
+    uint32 rShift = 15U - (uint32)Shift;
+    sint32 round  = 0;
+    sint32 diff;
+
+    if (rShift > 0U)
+    {
+        round = (sint32)1 << (rShift - 1U);
+    }
+
+    for (idx = 0U; idx < NumSamples; idx++)
+    {
+        diff        = Adc_postProcSat16((sint32)SrcPtr[idx] - (sint32)Offset);
+        DstPtr[idx] = (sint16)Adc_postProcSat16(((diff * (sint32)GainQ15) + round) >> rShift);
+    }
+
+    return;
+}
+
+void Adc_PostProcScaleQ31(const Adc_ValueGroupType *SrcPtr, sint32 *DstPtr, uint32 NumSamples, sint32 Offset,
+                          sint32 GainQ31, uint8 Shift)
+{
+    uint32 idx;
+    uint32 rShift = 31U - (uint32)Shift;
+    sint64 round  = 0;
+    sint32 diff;
+
+    if (rShift > 0U)
+    {
+        round = (sint64)1 << (rShift - 1U);
+    }
+
+    for (idx = 0U; idx < NumSamples; idx++)
+    {
+        /* With the difference saturated to 32 bits the product is a 32x32 to 64-bit
+         * multiply that cannot overflow, even after adding the rounding term */
+        diff        = Adc_postProcSat32((sint64)SrcPtr[idx] - (sint64)Offset);
+        DstPtr[idx] = Adc_postProcSat32((((sint64)diff * (sint64)GainQ31) + round) >> rShift);
+    }
+
+    return;
+}
+
+void Adc_PostProcStatsInit(Adc_PostProcAccType *AccPtr)
+{
+    AccPtr->count = 0U;
+    AccPtr->sum   = 0U;
+    AccPtr->sumSq = 0U;
+    AccPtr->min   = (Adc_ValueGroupType)0xFFFFU;
+    AccPtr->max   = (Adc_ValueGroupType)0U;
+
+    return;
+}
+
+void Adc_PostProcStatsUpdate(Adc_PostProcAccType *AccPtr, const Adc_ValueGroupType *SrcPtr, uint32 NumSamples)
+{
+    uint32             idx = 0U;
+    uint64             sum, sumSq;
+    Adc_ValueGroupType minVal, maxVal, sample;
+#if (STD_ON == ADC_POSTPROC_USE_DSP)
+    uint32 pair, numPairs, pairIdx;
+    sint64 pairSum = 0, pairSumSq = 0;
+#endif
+
+    sum    = AccPtr->sum;
+    sumSq  = AccPtr->sumSq;
+    minVal = AccPtr->min;
+    maxVal = AccPtr->max;
+
+#if (STD_ON == ADC_POSTPROC_USE_DSP)
+    /* Align to a word so two samples can be loaded at once */
+    if ((NumSamples > 0U) && (0U != (((uint32)SrcPtr) & 0x3U)))
+    {
+        sample = SrcPtr[0U];
+        sum   += (uint64)sample;
+        sumSq += (uint64)((uint32)sample * (uint32)sample);
+        minVal = (sample < minVal) ? sample : minVal;
+        maxVal = (sample > maxVal) ? sample : maxVal;
+        idx    = 1U;
+    }
+
+    /* SMLALD does two 16x16 multiply-accumulates into 64 bits in one instruction.
+     * The halves are read as signed, hence the below 0x8000 input requirement.
+     * The pair is copied with memcpy, which compiles to a single word load and
+     * does not access the samples through an incompatible pointer type */
+    numPairs = (NumSamples - idx) / 2U;
+    for (pairIdx = 0U; pairIdx < numPairs; pairIdx++)
+    {
+        (void)memcpy(&pair, &SrcPtr[idx + (pairIdx * 2U)], sizeof(pair));
+        pairSum   = __smlald((sint32)pair, (sint32)ADC_POSTPROC_PAIR_ONES, pairSum);
+        pairSumSq = __smlald((sint32)pair, (sint32)pair, pairSumSq);
+
+        sample = (Adc_ValueGroupType)(pair & 0xFFFFU);
+        minVal = (sample < minVal) ? sample : minVal;
+        maxVal = (sample > maxVal) ? sample : maxVal;
+        sample = (Adc_ValueGroupType)(pair >> 16U);
+        minVal = (sample < minVal) ? sample : minVal;
+        maxVal = (sample > maxVal) ? sample : maxVal;
+    }
+    sum   += (uint64)pairSum;
+    sumSq += (uint64)pairSumSq;
+    idx   += numPairs * 2U;
+#endif /* #if (STD_ON == ADC_POSTPROC_USE_DSP) */
+
+    for (; idx < NumSamples; idx++)
+    {
+        sample = SrcPtr[idx];
+        sum   += (uint64)sample;
+        sumSq += (uint64)((uint32)sample * (uint32)sample);
+        minVal = (sample < minVal) ? sample : minVal;
+        maxVal = (sample > maxVal) ? sample : maxVal;
+    }
+
+    AccPtr->count += NumSamples;
+    AccPtr->sum    = sum;
+    AccPtr->sumSq  = sumSq;
+    AccPtr->min    = minVal;
+    AccPtr->max    = maxVal;
+
+    return;
+}
+
+Std_ReturnType Adc_PostProcStatsGet(const Adc_PostProcAccType *AccPtr, Adc_PostProcStatsType *StatsPtr)
+{
+    Std_ReturnType retVal = (Std_ReturnType)E_NOT_OK;
+    uint64         half;
+
+    if (0U != AccPtr->count)
+    {
+        half           = (uint64)(AccPtr->count / 2U);
+        StatsPtr->min  = AccPtr->min;
+        StatsPtr->max  = AccPtr->max;
+        StatsPtr->mean = (Adc_ValueGroupType)((AccPtr->sum + half) / (uint64)AccPtr->count);
+        /* Mean square of 16-bit samples fits 32 bits */
+        StatsPtr->rms  = (Adc_ValueGroupType)Adc_postProcSqrt(
+            (uint32)((AccPtr->sumSq + half) / (uint64)AccPtr->count));
+        retVal         = (Std_ReturnType)E_OK;
+    }
+
+    return (retVal);
+}
+
+uint32 Adc_PostProcDecimate(const Adc_ValueGroupType *SrcPtr, Adc_ValueGroupType *DstPtr, uint32 NumSamples,
+                            uint32 Factor)
+{
+    uint32 numOut = 0U;
+    uint32 blkIdx, idx, sum, base;
+
+    if (Factor > 0U)
+    {
+        numOut = NumSamples / Factor;
+        base   = 0U;
+        for (blkIdx = 0U; blkIdx < numOut; blkIdx++)
+        {
+            sum = 0U;
+            for (idx = 0U; idx < Factor; idx++)
+            {
+                sum += (uint32)SrcPtr[base + idx];
+            }
+            /* Written behind the read position, so in-place is safe */
+            DstPtr[blkIdx] = (Adc_ValueGroupType)((sum + (Factor / 2U)) / Factor);
+            base          += Factor;
+        }
+    }
+
+    return (numOut);
+}
+
+uint32 Adc_PostProcAtan2(sint32 Y, sint32 X)
+{
+    uint32 absX, absY, mag, iter;
+    sint32 x, y, xTmp;
+    uint32 angle = 0U;
+
+    absX = (X < 0) ? ((uint32)0U - (uint32)X) : (uint32)X;
+    absY = (Y < 0) ? ((uint32)0U - (uint32)Y) : (uint32)Y;
+    mag  = absX | absY;
+
+    if (0U != mag)
+    {
+        /* Normalize so the small inputs of a weak signal keep full precision */
+        while (mag >= (ADC_POSTPROC_CORDIC_NORM << 1U))
+        {
+            absX >>= 1U;
+            absY >>= 1U;
+            mag  >>= 1U;
+        }
+        while (mag < ADC_POSTPROC_CORDIC_NORM)
+        {
+            absX <<= 1U;
+            absY <<= 1U;
+            mag  <<= 1U;
+        }
+
+        /* Vectoring in the first quadrant, y is driven to zero */
+        x = (sint32)absX;
+        y = (sint32)absY;
+        for (iter = 0U; iter < ADC_POSTPROC_CORDIC_ITER; iter++)
+        {
+            xTmp = x;
+            if (y >= 0)
+            {
+                x     += y >> iter;
+                y     -= xTmp >> iter;
+                angle += Adc_PostProcCordicAtanTbl[iter];
+            }
+            else
+            {
+                x     -= y >> iter;
+                y     += xTmp >> iter;
+                angle -= Adc_PostProcCordicAtanTbl[iter];
+            }
+        }
+
+        /* Map back to the quadrant of (X, Y) */
+        if (X < 0)
+        {
+            angle = (Y < 0) ? (ADC_POSTPROC_ANGLE_HALF + angle) : (ADC_POSTPROC_ANGLE_HALF - angle);
+        }
+        else if (Y < 0)
+        {
+            angle = (uint32)0U - angle;
+        }
+        else
+        {
+            /* No Actions Required. */
+        }
+    }
+
+    return (angle);
+}
+
+void Adc_PostProcResolverInit(Adc_PostProcResolverType *ObjPtr, const Adc_PostProcResolverConfigType *CfgPtr)
+{
+    ObjPtr->cfgPtr    = CfgPtr;
+    ObjPtr->phaseIdx  = 0U;
+    ObjPtr->sinAcc    = 0;
+    ObjPtr->cosAcc    = 0;
+    ObjPtr->measAngle = 0U;
+    ObjPtr->angle     = 0U;
+    ObjPtr->velocity  = 0;
+
+    return;
+}
+
+uint32 Adc_PostProcResolverProcess(Adc_PostProcResolverType *ObjPtr, const Adc_ValueGroupType *SinPtr,
+                                   const Adc_ValueGroupType *CosPtr, uint32 NumSamples, uint32 *AnglePtr)
+{
+    const Adc_PostProcResolverConfigType *cfgPtr = ObjPtr->cfgPtr;
+    uint32                                idx, phaseIdx;
+    uint32                                numPeriods = 0U;
+    sint32                                carrier;
+    sint64                                sinAcc, cosAcc;
+
+    phaseIdx = ObjPtr->phaseIdx;
+    sinAcc   = ObjPtr->sinAcc;
+    cosAcc   = ObjPtr->cosAcc;
+
+    for (idx = 0U; idx < NumSamples; idx++)
+    {
+        /* Synchronous demodulation: correlate with the excitation over a period */
+        carrier  = (sint32)cfgPtr->carrierPtr[phaseIdx];
+        sinAcc  += (sint64)(((sint32)SinPtr[idx] - (sint32)cfgPtr->offset) * carrier);
+        cosAcc  += (sint64)(((sint32)CosPtr[idx] - (sint32)cfgPtr->offset) * carrier);
+        phaseIdx++;
+
+        if (phaseIdx >= cfgPtr->samplesPerPeriod)
+        {
+            Adc_postProcResolverTrack(ObjPtr, sinAcc, cosAcc);
+            if (NULL_PTR != AnglePtr)
+            {
+                AnglePtr[numPeriods] = ObjPtr->angle;
+            }
+            numPeriods++;
+            phaseIdx = 0U;
+            sinAcc   = 0;
+            cosAcc   = 0;
+        }
+    }
+
+    ObjPtr->phaseIdx = phaseIdx;
+    ObjPtr->sinAcc   = sinAcc;
+    ObjPtr->cosAcc   = cosAcc;
+
+    return (numPeriods);
+}
+
+/* Type II tracking loop on the wrapped angle error, one step per period */
+static void Adc_postProcResolverTrack(Adc_PostProcResolverType *ObjPtr, sint64 sinAcc, sint64 cosAcc)
+{
+    sint32 err;
+
+    ObjPtr->measAngle = Adc_PostProcAtan2((sint32)(sinAcc >> 15U), (sint32)(cosAcc >> 15U));
+
+    /* Predict to this period, then correct. The modulo 2^32 difference is the
+     * shortest way round the circle */
+    ObjPtr->angle    += (uint32)ObjPtr->velocity;
+    err               = (sint32)(ObjPtr->measAngle - ObjPtr->angle);
+    ObjPtr->velocity += (sint32)(((sint64)err * (sint64)ObjPtr->cfgPtr->kiQ15) >> 15U);
+    ObjPtr->angle    += (uint32)(sint32)(((sint64)err * (sint64)ObjPtr->cfgPtr->kpQ15) >> 15U);
+
+    return;
+}
+
+static inline sint32 Adc_postProcSat16(sint32 value)
+{
+#if (STD_ON == ADC_POSTPROC_USE_DSP)
+    return (__ssat(value, 16U));
+#else
+    sint32 retVal = value;
+
+    if (retVal > (sint32)0x7FFF)
+    {
+        retVal = (sint32)0x7FFF;
+    }
+    else if (retVal < (sint32)(-0x8000))
+    {
+        retVal = (sint32)(-0x8000);
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+
+    return (retVal);
+#endif /* #if (STD_ON == ADC_POSTPROC_USE_DSP) */
+}
+
+static inline sint32 Adc_postProcSat32(sint64 value)
+{
+    sint64 retVal = value;
+
+    if (retVal > (sint64)0x7FFFFFFF)
+    {
+        retVal = (sint64)0x7FFFFFFF;
+    }
+    else if (retVal < -(sint64)0x80000000)
+    {
+        retVal = -(sint64)0x80000000;
+    }
+    else
+    {
+        /* No Actions Required. */
+    }
+
+    return ((sint32)retVal);
+}
+
+/* Rounded integer square root, one result bit per iteration */
+static uint32 Adc_postProcSqrt(uint32 value)
+{
+    uint32 rem  = value;
+    uint32 root = 0U;
+    uint32 bit  = (uint32)1U << 30U;
+
+    while (bit > rem)
+    {
+        bit >>= 2U;
+    }
+
+    while (bit != 0U)
+    {
+        if (rem >= (root + bit))
+        {
+            rem  -= root + bit;
+            root  = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+
+    /* Round up when value is past (root + 0.5)^2 */
+    if (rem > root)
+    {
+        root++;
+    }
+
+    return (root);
+}
+
+#define ADC_STOP_SEC_CODE
+#include "Adc_MemMap.h"
+#endif /* #if (STD_ON == ADC_POST_PROC_API) */
@@ -137,6 +137,8 @@ extern "C" {
 #define CDD_CMPSS_E_ILLEGAL_HW_ID ((uint8)0x02U)
 /** \brief API service called invalid configuration */
 #define CDD_CMPSS_E_INVALID_CONFIG ((uint8)0x03U)
+/** \brief Waveform API called in the wrong waveform state (already running or stopped) */
+#define CDD_CMPSS_E_WAVEFORM_STATE ((uint8)0x04U)
 /** @} */
 
 /**
@@ -220,6 +222,12 @@ extern "C" {
 #define CDD_CMPSS_SID_CONFIG_LATCH_ON_PWM_SYNC ((uint8)35U)
 /** \brief Cdd_Cmpss_ConfigRamp() API Service ID */
 #define CDD_CMPSS_SID_CONFIG_RAMP ((uint8)36U)
+/** \brief Cdd_Cmpss_WaveformStart() API Service ID */
+#define CDD_CMPSS_SID_WAVEFORM_START ((uint8)37U)
+/** \brief Cdd_Cmpss_WaveformSwapTable() API Service ID */
+#define CDD_CMPSS_SID_WAVEFORM_SWAP_TABLE ((uint8)38U)
+/** \brief Cdd_Cmpss_WaveformStop() API Service ID */
+#define CDD_CMPSS_SID_WAVEFORM_STOP ((uint8)39U)
 /** @} */
 
 /*
@@ -356,6 +364,24 @@ extern "C" {
 #define CDD_CMPSS_DACSRC_RAMP (0x0001U)
 /** @} */
 
+/**
+ *  \name CDD CMPSS waveform target
+ *
+ *  Shadow register streamed by Cdd_Cmpss_WaveformStart()
+ *  @{
+ */
+/** \brief High DAC shadow value (DACHVALS) */
+#define CDD_CMPSS_WAVEFORM_DAC_HIGH (0x0000U)
+/** \brief Low DAC shadow value (DACLVALS) */
+#define CDD_CMPSS_WAVEFORM_DAC_LOW (0x0001U)
+/** \brief Ramp maximum reference shadow value (RAMPMAXREFS) */
+#define CDD_CMPSS_WAVEFORM_RAMP_MAX (0x0002U)
+/** \brief Ramp decrement shadow value (RAMPDECVALS) */
+#define CDD_CMPSS_WAVEFORM_RAMP_DEC (0x0003U)
+/** \brief Number of waveform targets */
+#define CDD_CMPSS_WAVEFORM_TARGET_MAX (0x0004U)
+/** @} */
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -979,6 +1005,53 @@ void Cdd_Cmpss_ConfigLatchOnPWMSYNC(Cdd_Cmpss_HwUnitType HwUnitId, boolean HighE
  */
 void Cdd_Cmpss_ConfigRamp(Cdd_Cmpss_HwUnitType HwUnitId, const Cdd_Cmpss_RampConfigType *RampConfigPtr);
 
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+/**
+ * \brief Starts streaming a table of values to a CMPSS shadow register by EDMA.
+ *
+ * \param[in] HwUnitId HW ID. This param should be less than CDD_CMPSS_HW_UNIT_MAX
+ * \param[in] DmaHandleId Cdd_Dma handle whose event is routed from EPWMSYNCPER.
+ * \param[in] Target is the shadow register, one of \b CDD_CMPSS_WAVEFORM_xxx.
+ * \param[in] TablePtr Pointer to the table of register values. This should not be NULL.
+ * \param[in] NumEntries is the number of values in the table. This should not be 0.
+ *
+ * Every DMA event writes the next table value to the shadow register and the
+ * table restarts from its first entry after the last one, so one table period
+ * spans \e NumEntries PWM sync periods. The routing of EPWMSYNCPER to the DMA
+ * channel is part of the Cdd_Dma configuration and the handle needs at least
+ * three PaRAM sets, otherwise CDD_CMPSS_E_INVALID_CONFIG is reported. Configure the DAC with \b CDD_CMPSS_DACVAL_PWMSYNC so that
+ * each value is loaded on the following sync. The driver does no cache
+ * maintenance: the table must be visible to the DMA (non-cached, or written
+ * back by the caller before this call) and stay valid while it is streamed.
+ */
+void Cdd_Cmpss_WaveformStart(Cdd_Cmpss_HwUnitType HwUnitId, uint32 DmaHandleId, uint16 Target,
+                             const uint16 *TablePtr, uint16 NumEntries);
+
+/**
+ * \brief Replaces the streamed table at the next table boundary.
+ *
+ * \param[in] HwUnitId HW ID. This param should be less than CDD_CMPSS_HW_UNIT_MAX
+ * \param[in] TablePtr Pointer to the new table. This should not be NULL.
+ * \param[in] NumEntries is the number of values in the new table. This should not be 0.
+ *
+ * The new table is prepared in the spare reload PaRAM set and linked in with a
+ * single write, so the current table always completes and the new one starts
+ * from its first entry. The previous table must stay valid for one more table
+ * period. As for Cdd_Cmpss_WaveformStart, the new table must be visible to
+ * the DMA (non-cached, or written back by the caller) before this call.
+ */
+void Cdd_Cmpss_WaveformSwapTable(Cdd_Cmpss_HwUnitType HwUnitId, const uint16 *TablePtr, uint16 NumEntries);
+
+/**
+ * \brief Stops the waveform streaming of a CMPSS instance.
+ *
+ * \param[in] HwUnitId HW ID. This param should be less than CDD_CMPSS_HW_UNIT_MAX
+ *
+ * The shadow register keeps the last value written by the DMA.
+ */
+void Cdd_Cmpss_WaveformStop(Cdd_Cmpss_HwUnitType HwUnitId);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -73,6 +73,9 @@
 #define CDD_CMPSS_STOP_SEC_CODE
 #include "Cdd_Cmpss_MemMap.h"
 #include "cslr_cmpssa.h"
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+#include "Cdd_Dma.h"
+#endif
 
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
@@ -97,11 +100,33 @@
 #define CDD_CMPSS_LOCMP_CTL_M \
     (CSL_CMPSSA_COMPCTL_COMPLSOURCE_MASK | CSL_CMPSSA_COMPCTL_COMPLINV_MASK | CSL_CMPSSA_COMPCTL_ASYNCLEN_MASK)
 
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+/* PaRAM set 0 is the active set, sets 1 and 2 alternate as its reload set */
+#define CDD_CMPSS_WAVEFORM_PARAM_ACTIVE (0U)
+#define CDD_CMPSS_WAVEFORM_PARAM_RELOAD0 (1U)
+#define CDD_CMPSS_WAVEFORM_PARAM_RELOAD1 (2U)
+/* PaRAM sets the DMA handle must own */
+#define CDD_CMPSS_WAVEFORM_NUM_PARAMS (3U)
+#endif
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
 
-/* None */
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+/** \brief Waveform streaming state of a CMPSS instance */
+typedef struct
+{
+    /** \brief TRUE while the table is streamed */
+    boolean Running;
+    /** \brief Cdd_Dma handle streaming the table */
+    uint32  DmaHandleId;
+    /** \brief Address of the streamed shadow register */
+    uint32  TargetAddr;
+    /** \brief Reload PaRAM set not linked from the active set */
+    uint32  SpareParamIdx;
+} Cdd_Cmpss_WaveformObjType;
+#endif
 
 /* ========================================================================== */
 /*                          Function Declarations                             */
@@ -113,6 +138,14 @@ static Std_ReturnType Cdd_Cmpss_ConfigFilterHighParamCheck(Cdd_Cmpss_HwUnitType
 static Std_ReturnType Cdd_Cmpss_ConfigFilterLowParamCheck(Cdd_Cmpss_HwUnitType HwUnitId, uint16 SamplePrescale,
                                                           uint16 SampleWindow, uint16 Threshold);
 static Std_ReturnType Cdd_Cmpss_ConfigRampParamCheck(Cdd_Cmpss_HwUnitType HwUnitId, uint16 DelayVal, uint16 PwmSyncSrc);
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+static Std_ReturnType Cdd_Cmpss_WaveformParamCheck(Cdd_Cmpss_HwUnitType HwUnitId, uint8 ServiceId,
+                                                   const uint16 *TablePtr, uint16 NumEntries, boolean Running);
+#endif
+#endif
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+static void Cdd_Cmpss_WaveformParamEntry(const Cdd_Cmpss_WaveformObjType *WaveObj, const uint16 *TablePtr,
+                                         uint16 NumEntries, Cdd_Dma_ParamEntry *ParamEntry);
 #endif
 
 /* ========================================================================== */
@@ -123,9 +156,23 @@ static Std_ReturnType Cdd_Cmpss_ConfigRampParamCheck(Cdd_Cmpss_HwUnitType HwUnit
 #define CDD_CMPSS_START_SEC_CONST_UNSPECIFIED
 #include "Cdd_Cmpss_MemMap.h"
 static uint32 const CddCmpssBaseAddr[CDD_CMPSS_MAX] = {CDD_CMPSS_BASEADDR_ARRAY};
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+/** \brief Shadow register offsets indexed by CDD_CMPSS_WAVEFORM_xxx */
+static uint32 const CddCmpssWaveformRegOffset[CDD_CMPSS_WAVEFORM_TARGET_MAX] = {
+    CSL_CMPSSA_DACHVALS, CSL_CMPSSA_DACLVALS, CSL_CMPSSA_RAMPMAXREFS, CSL_CMPSSA_RAMPDECVALS};
+#endif
 #define CDD_CMPSS_STOP_SEC_CONST_UNSPECIFIED
 #include "Cdd_Cmpss_MemMap.h"
 
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+#define CDD_CMPSS_START_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Cmpss_MemMap.h"
+/** \brief Waveform state of each CMPSS instance */
+static Cdd_Cmpss_WaveformObjType Cdd_Cmpss_WaveformObj[CDD_CMPSS_MAX] = {{0}};
+#define CDD_CMPSS_STOP_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Cmpss_MemMap.h"
+#endif
+
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -1173,6 +1220,121 @@ void Cdd_Cmpss_ConfigRamp(Cdd_Cmpss_HwUnitType HwUnitId, const Cdd_Cmpss_RampCon
     return;
 }
 
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+void Cdd_Cmpss_WaveformStart(Cdd_Cmpss_HwUnitType HwUnitId, uint32 DmaHandleId, uint16 Target,
+                             const uint16 *TablePtr, uint16 NumEntries)
+{
+#if (STD_ON == CDD_CMPSS_DEV_ERROR_DETECT)
+    Std_ReturnType retVal;
+    retVal = Cdd_Cmpss_WaveformParamCheck(HwUnitId, CDD_CMPSS_SID_WAVEFORM_START, TablePtr, NumEntries, FALSE);
+    if ((retVal == E_OK) &&
+        ((Target >= CDD_CMPSS_WAVEFORM_TARGET_MAX) || (DmaHandleId >= (uint32)CDD_DMA_MAX_HANDLER) ||
+         (Cdd_Dma_Config.CddDmaDriverHandler[DmaHandleId]->edmaConfig.ownResource.channelGroup[0]->maxParam <
+          CDD_CMPSS_WAVEFORM_NUM_PARAMS)))
+    {
+        /* Unknown target, or a handle without the active and both reload sets */
+        (void)Det_ReportError(CDD_CMPSS_MODULE_ID, CDD_CMPSS_INSTANCE_ID, CDD_CMPSS_SID_WAVEFORM_START,
+                              CDD_CMPSS_E_INVALID_CONFIG);
+        retVal = E_NOT_OK;
+    }
+    if (retVal == E_OK)
+#endif
+    {
+        Cdd_Cmpss_WaveformObjType *waveObj = &Cdd_Cmpss_WaveformObj[HwUnitId];
+        Cdd_Dma_ParamEntry         paramEntry;
+
+        waveObj->DmaHandleId   = DmaHandleId;
+        waveObj->TargetAddr    = CddCmpssBaseAddr[HwUnitId] + CddCmpssWaveformRegOffset[Target];
+        waveObj->SpareParamIdx = CDD_CMPSS_WAVEFORM_PARAM_RELOAD1;
+
+        Cdd_Cmpss_WaveformParamEntry(waveObj, TablePtr, NumEntries, &paramEntry);
+        Cdd_Dma_ParamSet(DmaHandleId, 0U, CDD_CMPSS_WAVEFORM_PARAM_ACTIVE, paramEntry);
+
+        /* The reload copy linked to itself restarts the table forever */
+        Cdd_Dma_ReloadParamSet(DmaHandleId, CDD_CMPSS_WAVEFORM_PARAM_RELOAD0, CDD_CMPSS_WAVEFORM_PARAM_RELOAD0,
+                               paramEntry);
+        Cdd_Dma_LinkChannel(DmaHandleId, CDD_CMPSS_WAVEFORM_PARAM_ACTIVE, CDD_CMPSS_WAVEFORM_PARAM_RELOAD0);
+
+        waveObj->Running = TRUE;
+        (void)Cdd_Dma_EnableTransferRegion(DmaHandleId, CDD_EDMA_TRIG_MODE_EVENT);
+    }
+
+    return;
+}
+
+void Cdd_Cmpss_WaveformSwapTable(Cdd_Cmpss_HwUnitType HwUnitId, const uint16 *TablePtr, uint16 NumEntries)
+{
+#if (STD_ON == CDD_CMPSS_DEV_ERROR_DETECT)
+    Std_ReturnType retVal;
+    retVal = Cdd_Cmpss_WaveformParamCheck(HwUnitId, CDD_CMPSS_SID_WAVEFORM_SWAP_TABLE, TablePtr, NumEntries, TRUE);
+    if (retVal == E_OK)
+#endif
+    {
+        Cdd_Cmpss_WaveformObjType *waveObj = &Cdd_Cmpss_WaveformObj[HwUnitId];
+        Cdd_Dma_ParamEntry         paramEntry;
+        uint32                     spareIdx;
+
+        /* The spare set is not reachable from the active set, so it can be
+         * rewritten while the current table is still streaming */
+        spareIdx = waveObj->SpareParamIdx;
+        Cdd_Cmpss_WaveformParamEntry(waveObj, TablePtr, NumEntries, &paramEntry);
+        Cdd_Dma_ReloadParamSet(waveObj->DmaHandleId, spareIdx, spareIdx, paramEntry);
+
+        /* Retargeting the link of the active set is a single LINK word update:
+         * the current table always completes and the EDMA reloads the new one
+         * at the next wrap. The previously linked set becomes the spare. */
+        Cdd_Dma_LinkChannel(waveObj->DmaHandleId, CDD_CMPSS_WAVEFORM_PARAM_ACTIVE, spareIdx);
+        if (spareIdx == CDD_CMPSS_WAVEFORM_PARAM_RELOAD0)
+        {
+            waveObj->SpareParamIdx = CDD_CMPSS_WAVEFORM_PARAM_RELOAD1;
+        }
+        else
+        {
+            waveObj->SpareParamIdx = CDD_CMPSS_WAVEFORM_PARAM_RELOAD0;
+        }
+    }
+
+    return;
+}
+
+void Cdd_Cmpss_WaveformStop(Cdd_Cmpss_HwUnitType HwUnitId)
+{
+#if (STD_ON == CDD_CMPSS_DEV_ERROR_DETECT)
+    Std_ReturnType retVal;
+    retVal = Cdd_Cmpss_WaveformParamCheck(HwUnitId, CDD_CMPSS_SID_WAVEFORM_STOP, NULL_PTR, 1U, TRUE);
+    if (retVal == E_OK)
+#endif
+    {
+        Cdd_Cmpss_WaveformObjType *waveObj = &Cdd_Cmpss_WaveformObj[HwUnitId];
+
+        (void)Cdd_Dma_DisableTransferRegion(waveObj->DmaHandleId, CDD_EDMA_TRIG_MODE_EVENT);
+        waveObj->Running = FALSE;
+    }
+
+    return;
+}
+
+static void Cdd_Cmpss_WaveformParamEntry(const Cdd_Cmpss_WaveformObjType *WaveObj, const uint16 *TablePtr,
+                                         uint16 NumEntries, Cdd_Dma_ParamEntry *ParamEntry)
+{
+    /* A-synchronized: every sync event moves one 16-bit value to the fixed
+     * shadow register address and B counts the table entries */
+    ParamEntry->srcPtr     = (void *)TablePtr;
+    ParamEntry->destPtr    = (void *)WaveObj->TargetAddr;
+    ParamEntry->aCnt       = (uint16)sizeof(uint16);
+    ParamEntry->bCnt       = NumEntries;
+    ParamEntry->cCnt       = (uint16)1;
+    ParamEntry->bCntReload = 0;
+    ParamEntry->srcBIdx    = (sint16)sizeof(uint16);
+    ParamEntry->destBIdx   = (sint16)0;
+    ParamEntry->srcCIdx    = (sint16)0;
+    ParamEntry->destCIdx   = (sint16)0;
+    ParamEntry->opt        = 0U;
+
+    return;
+}
+#endif
+
 #if (STD_ON == CDD_CMPSS_DEV_ERROR_DETECT)
 static Std_ReturnType Cdd_Cmpss_ConfigFilterHighParamCheck(Cdd_Cmpss_HwUnitType HwUnitId, uint16 SamplePrescale,
                                                            uint16 SampleWindow, uint16 Threshold)
@@ -1290,6 +1452,42 @@ static Std_ReturnType Cdd_Cmpss_ConfigRampParamCheck(Cdd_Cmpss_HwUnitType HwUnit
 
     return retVal;
 }
+
+#if (STD_ON == CDD_CMPSS_WAVEFORM_DMA_API)
+static Std_ReturnType Cdd_Cmpss_WaveformParamCheck(Cdd_Cmpss_HwUnitType HwUnitId, uint8 ServiceId,
+                                                   const uint16 *TablePtr, uint16 NumEntries, boolean Running)
+{
+    Std_ReturnType retVal = E_OK;
+
+    if (HwUnitId >= CDD_CMPSS_MAX)
+    {
+        /* Report DET error if the specified hardware unit ID doesn't exist */
+        (void)Det_ReportError(CDD_CMPSS_MODULE_ID, CDD_CMPSS_INSTANCE_ID, ServiceId, CDD_CMPSS_E_ILLEGAL_HW_ID);
+        retVal = E_NOT_OK;
+    }
+    else if (Cdd_Cmpss_WaveformObj[HwUnitId].Running != Running)
+    {
+        (void)Det_ReportError(CDD_CMPSS_MODULE_ID, CDD_CMPSS_INSTANCE_ID, ServiceId, CDD_CMPSS_E_WAVEFORM_STATE);
+        retVal = E_NOT_OK;
+    }
+    else if ((ServiceId != CDD_CMPSS_SID_WAVEFORM_STOP) && (NULL_PTR == TablePtr))
+    {
+        (void)Det_ReportError(CDD_CMPSS_MODULE_ID, CDD_CMPSS_INSTANCE_ID, ServiceId, CDD_CMPSS_E_PARAM_POINTER);
+        retVal = E_NOT_OK;
+    }
+    else if (NumEntries == 0U)
+    {
+        (void)Det_ReportError(CDD_CMPSS_MODULE_ID, CDD_CMPSS_INSTANCE_ID, ServiceId, CDD_CMPSS_E_INVALID_CONFIG);
+        retVal = E_NOT_OK;
+    }
+    else
+    {
+        /* Parameters are valid */
+    }
+
+    return retVal;
+}
+#endif
 #endif
 
 #define CDD_CMPSS_STOP_SEC_CODE
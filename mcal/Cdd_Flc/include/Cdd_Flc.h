@@ -139,6 +139,10 @@ extern "C" {
 #define CDD_FLC_E_ILLEGAL_REGION_ID ((uint8)0x03U)
 /** \brief API service called with unaligned address */
 #define CDD_FLC_E_UNALIGNED_ADDRESS ((uint8)0x04U)
+/** \brief Overlay API called before Cdd_Flc_OverlayInit() */
+#define CDD_FLC_E_UNINIT ((uint8)0x05U)
+/** \brief Overlay API called with illegal overlay ID or an overlay larger than its slot */
+#define CDD_FLC_E_ILLEGAL_OVERLAY_ID ((uint8)0x06U)
 /** @} */
 
 /**
@@ -162,6 +166,18 @@ extern "C" {
 #define CDD_FLC_SID_GET_STATUS ((uint8)0x05U)
 /** \brief Cdd_Flc_ClearAllStatus() API Service ID */
 #define CDD_FLC_SID_CLEAR_ALL_STATUS ((uint8)0x06U)
+/** \brief Cdd_Flc_OverlayInit() API Service ID */
+#define CDD_FLC_SID_OVERLAY_INIT ((uint8)0x07U)
+/** \brief Cdd_Flc_OverlayLoad() API Service ID */
+#define CDD_FLC_SID_OVERLAY_LOAD ((uint8)0x08U)
+/** \brief Cdd_Flc_OverlayIsResident() API Service ID */
+#define CDD_FLC_SID_OVERLAY_IS_RESIDENT ((uint8)0x09U)
+/** \brief Cdd_Flc_OverlayGetStats() API Service ID */
+#define CDD_FLC_SID_OVERLAY_GET_STATS ((uint8)0x0AU)
+/** \brief Cdd_Flc_OverlayCallEnter() API Service ID */
+#define CDD_FLC_SID_OVERLAY_CALL_ENTER ((uint8)0x0BU)
+/** \brief Cdd_Flc_OverlayCallExit() API Service ID */
+#define CDD_FLC_SID_OVERLAY_CALL_EXIT ((uint8)0x0CU)
 /** @} */
 
 /** \brief Source and destination addresses should be aligned to this */
@@ -169,6 +185,28 @@ extern "C" {
 /** \brief Source and destination address alignment mask */
 #define CDD_FLC_ADDR_ALIGNMENT_MSK ((uint32)(CDD_FLC_ADDR_ALIGNMENT - 1U))
 
+#if (STD_ON == CDD_FLC_OVERLAY_API)
+/**
+ *  \brief Trampoline to call a function placed in an overlay.
+ *
+ *  Makes the overlay resident (loading it on a miss and waiting for the copy)
+ *  and keeps its slot from being evicted for the duration of the call, so
+ *  nested overlay calls cannot replace the code that is executing. The call
+ *  is skipped if every slot that fits the overlay is held by an executing
+ *  overlay. The function must be linked at the flash (source) address of the
+ *  overlay, the FLC redirects the accesses to the RAM slot.
+ */
+#define CDD_FLC_OVERLAY_CALL(OverlayId, Func, Args)          \
+    do                                                       \
+    {                                                        \
+        if (E_OK == Cdd_Flc_OverlayCallEnter((OverlayId)))   \
+        {                                                    \
+            Func Args;                                       \
+            Cdd_Flc_OverlayCallExit((OverlayId));            \
+        }                                                    \
+    } while (0)
+#endif
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -217,6 +255,58 @@ typedef struct Cdd_Flc_StatusTypeTag
     uint32  rdError;
 } Cdd_Flc_StatusType;
 
+#if (STD_ON == CDD_FLC_OVERLAY_API)
+/** \brief Overlay descriptor, typically filled from linker section start/end symbols */
+typedef struct Cdd_Flc_OverlayTypeTag
+{
+    /** \brief Flash start address of the overlay section. Should be aligned to 4KB boundary */
+    uint32 srcStartAddr;
+    /** \brief Flash end address (exclusive) of the overlay section. Should be aligned to 4KB boundary */
+    uint32 srcEndAddr;
+} Cdd_Flc_OverlayType;
+
+/** \brief RAM slot of the shared overlay window. Each slot is backed by one FLC region */
+typedef struct Cdd_Flc_OverlaySlotTypeTag
+{
+    /** \brief RAM start address of the slot. Should be aligned to 4KB boundary */
+    uint32           destStartAddr;
+    /** \brief Size of the slot in bytes. Should be a multiple of 4KB */
+    uint32           size;
+    /** \brief FLC region dedicated to this slot */
+    Cdd_Flc_RegionId regionId;
+} Cdd_Flc_OverlaySlotType;
+
+/** \brief Overlay manager configuration */
+typedef struct Cdd_Flc_OverlayConfigTypeTag
+{
+    /** \brief FLC HW unit used for all overlay slots */
+    Cdd_Flc_HwUnitType             hwUnitId;
+    /** \brief Overlay table, indexed by overlay ID */
+    const Cdd_Flc_OverlayType     *overlays;
+    /** \brief Number of entries in the overlay table */
+    uint32                         numOverlays;
+    /** \brief Slots of the shared RAM window */
+    const Cdd_Flc_OverlaySlotType *slots;
+    /** \brief Number of slots. This param should not exceed CDD_FLC_REGION_ID_MAX */
+    uint32                         numSlots;
+} Cdd_Flc_OverlayConfigType;
+
+/** \brief Overlay manager statistics */
+typedef struct Cdd_Flc_OverlayStatsTypeTag
+{
+    /** \brief Load requests served by an already resident overlay */
+    uint32 hitCount;
+    /** \brief Load requests which started a FLC copy */
+    uint32 loadCount;
+    /** \brief Loads which evicted another resident overlay */
+    uint32 evictCount;
+    /** \brief Load requests which had to wait for a copy to complete */
+    uint32 stallCount;
+    /** \brief Total PMU cycles spent waiting for copies to complete */
+    uint32 stallCycles;
+} Cdd_Flc_OverlayStatsType;
+#endif
+
 /* ========================================================================== */
 /*                          Function Declarations                             */
 /* ========================================================================== */
@@ -297,6 +387,77 @@ Cdd_Flc_GetStatus(VAR(Cdd_Flc_HwUnitType, AUTOMATIC) HwUnitId,
 FUNC(void, CDD_FLC_CODE)
 Cdd_Flc_ClearAllStatus(VAR(Cdd_Flc_HwUnitType, AUTOMATIC) HwUnitId);
 
+#if (STD_ON == CDD_FLC_OVERLAY_API)
+/**
+ * \brief Service to initialize the overlay manager
+ *
+ * \note The FLC regions used by the slots are disabled and owned by the overlay
+ *       manager afterwards. The configuration is referenced, not copied.
+ *
+ * \param[in] ConfigPtr Pointer to the overlay configuration. This should not be NULL.
+ *
+ * \return If the configuration is valid, returns E_OK else returns E_NOT_OK
+ */
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayInit(P2CONST(Cdd_Flc_OverlayConfigType, AUTOMATIC, CDD_FLC_DATA) ConfigPtr);
+
+/**
+ * \brief Service to make an overlay resident in the shared RAM window
+ *
+ * On a hit the overlay becomes the most recently used one. On a miss the least
+ * recently used slot large enough for the overlay is reprogrammed and the FLC
+ * copy is started. Slots of executing overlays (see Cdd_Flc_OverlayCallEnter)
+ * are never chosen. The slot update runs in FLC_EXCLUSIVE_AREA_0, a wait for
+ * the copy does not.
+ *
+ * \param[in] OverlayId Index of the overlay in the overlay table
+ * \param[in] WaitForCopy Set this to TRUE to return only once the copy is completed
+ *
+ * \return E_OK if the overlay is (being made) resident, E_NOT_OK otherwise
+ */
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayLoad(VAR(uint32, AUTOMATIC) OverlayId, VAR(boolean, AUTOMATIC) WaitForCopy);
+
+/**
+ * \brief Service to make an overlay resident and mark it as executing
+ *
+ * Same as Cdd_Flc_OverlayLoad() with WaitForCopy TRUE, and the slot is then
+ * held until the matching Cdd_Flc_OverlayCallExit(). Calls nest.
+ *
+ * \param[in] OverlayId Index of the overlay in the overlay table
+ *
+ * \return E_OK if the overlay is resident and held, E_NOT_OK otherwise
+ */
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayCallEnter(VAR(uint32, AUTOMATIC) OverlayId);
+
+/**
+ * \brief Service to end an overlay call started with Cdd_Flc_OverlayCallEnter()
+ *
+ * \param[in] OverlayId Index of the overlay in the overlay table
+ */
+FUNC(void, CDD_FLC_CODE)
+Cdd_Flc_OverlayCallExit(VAR(uint32, AUTOMATIC) OverlayId);
+
+/**
+ * \brief Service to check if an overlay is resident and its copy is completed
+ *
+ * \param[in] OverlayId Index of the overlay in the overlay table
+ *
+ * \return TRUE if the overlay can be executed from RAM. FALSE otherwise.
+ */
+FUNC(boolean, CDD_FLC_CODE)
+Cdd_Flc_OverlayIsResident(VAR(uint32, AUTOMATIC) OverlayId);
+
+/**
+ * \brief Service to get the overlay manager statistics
+ *
+ * \param[in] StatsPtr Pointer to where to store the statistics
+ */
+FUNC(void, CDD_FLC_CODE)
+Cdd_Flc_OverlayGetStats(P2VAR(Cdd_Flc_OverlayStatsType, AUTOMATIC, CDD_FLC_DATA) StatsPtr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,517 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     Cdd_Flc_Overlay.c
+ *
+ *  \brief    Demand driven code overlay manager built on top of the FLC regions.
+ *            Overlays are linked at their flash address and made resident in a
+ *            shared RAM window, one FLC region per RAM slot, with LRU replacement.
+ *
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include "Det.h"
+#include "Cdd_Flc.h"
+#include "SchM_Cdd_Flc.h"
+#include "sys_pmu.h"
+
+#if (STD_ON == CDD_FLC_OVERLAY_API)
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Marker for a slot without a resident overlay */
+#define CDD_FLC_OVERLAY_INVALID_ID ((uint32)0xFFFFFFFFU)
+
+/* ========================================================================== */
+/*                         Structures and Enums                               */
+/* ========================================================================== */
+
+/** \brief Run time state of a RAM slot */
+typedef struct
+{
+    /** \brief Overlay resident in the slot */
+    uint32 overlayId;
+    /** \brief Value of the use counter at the last access, used for LRU replacement */
+    uint32 lastUse;
+    /** \brief Overlay calls executing from the slot, the slot is not evicted while non zero */
+    uint32 activeCount;
+} Cdd_Flc_OverlaySlotStateType;
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static Std_ReturnType Cdd_Flc_OverlayLoadInternal(uint32 overlayId, boolean waitForCopy, boolean hold);
+static uint32 Cdd_Flc_OverlayFindSlot(uint32 overlayId);
+static uint32 Cdd_Flc_OverlaySelectVictim(uint32 overlaySize);
+static void   Cdd_Flc_OverlayWaitCopy(Cdd_Flc_RegionId regionId);
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+static Std_ReturnType Cdd_Flc_OverlayInitParamCheck(const Cdd_Flc_OverlayConfigType *configPtr);
+#endif
+
+/* ========================================================================== */
+/*                        Local Object Definitions                            */
+/* ========================================================================== */
+
+#define CDD_FLC_START_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Flc_MemMap.h"
+/** \brief Active overlay configuration */
+static const Cdd_Flc_OverlayConfigType *Cdd_Flc_OverlayCfgPtr = (const Cdd_Flc_OverlayConfigType *)NULL_PTR;
+/** \brief Slot state, one entry per FLC region */
+static Cdd_Flc_OverlaySlotStateType Cdd_Flc_OverlaySlotState[CDD_FLC_REGION_ID_MAX];
+/** \brief Monotonic use counter driving the LRU */
+static uint32 Cdd_Flc_OverlayUseCounter = 0U;
+/** \brief Overlay statistics */
+static Cdd_Flc_OverlayStatsType Cdd_Flc_OverlayStats = {0U, 0U, 0U, 0U, 0U};
+#define CDD_FLC_STOP_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Flc_MemMap.h"
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+#define CDD_FLC_START_SEC_CODE
+#include "Cdd_Flc_MemMap.h"
+
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayInit(P2CONST(Cdd_Flc_OverlayConfigType, AUTOMATIC, CDD_FLC_DATA) ConfigPtr)
+{
+    Std_ReturnType retVal = E_OK;
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    retVal = Cdd_Flc_OverlayInitParamCheck(ConfigPtr);
+    if (retVal == E_OK)
+#endif
+    {
+        for (uint32 slotIdx = 0U; slotIdx < ConfigPtr->numSlots; slotIdx++)
+        {
+            Cdd_Flc_DisableRegion(ConfigPtr->hwUnitId, ConfigPtr->slots[slotIdx].regionId);
+            Cdd_Flc_OverlaySlotState[slotIdx].overlayId   = CDD_FLC_OVERLAY_INVALID_ID;
+            Cdd_Flc_OverlaySlotState[slotIdx].lastUse     = 0U;
+            Cdd_Flc_OverlaySlotState[slotIdx].activeCount = 0U;
+        }
+        Cdd_Flc_OverlayUseCounter         = 0U;
+        Cdd_Flc_OverlayStats.hitCount     = 0U;
+        Cdd_Flc_OverlayStats.loadCount    = 0U;
+        Cdd_Flc_OverlayStats.evictCount   = 0U;
+        Cdd_Flc_OverlayStats.stallCount   = 0U;
+        Cdd_Flc_OverlayStats.stallCycles  = 0U;
+        Cdd_Flc_OverlayCfgPtr             = ConfigPtr;
+    }
+
+    return retVal;
+}
+
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayLoad(VAR(uint32, AUTOMATIC) OverlayId, VAR(boolean, AUTOMATIC) WaitForCopy)
+{
+    Std_ReturnType retVal = E_NOT_OK;
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    if (NULL_PTR == Cdd_Flc_OverlayCfgPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_LOAD, CDD_FLC_E_UNINIT);
+    }
+    else if (OverlayId >= Cdd_Flc_OverlayCfgPtr->numOverlays)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_LOAD,
+                              CDD_FLC_E_ILLEGAL_OVERLAY_ID);
+    }
+    else
+#endif
+    {
+        retVal = Cdd_Flc_OverlayLoadInternal(OverlayId, WaitForCopy, (boolean)FALSE);
+    }
+
+    return retVal;
+}
+
+FUNC(Std_ReturnType, CDD_FLC_CODE)
+Cdd_Flc_OverlayCallEnter(VAR(uint32, AUTOMATIC) OverlayId)
+{
+    Std_ReturnType retVal = E_NOT_OK;
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    if (NULL_PTR == Cdd_Flc_OverlayCfgPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_CALL_ENTER,
+                              CDD_FLC_E_UNINIT);
+    }
+    else if (OverlayId >= Cdd_Flc_OverlayCfgPtr->numOverlays)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_CALL_ENTER,
+                              CDD_FLC_E_ILLEGAL_OVERLAY_ID);
+    }
+    else
+#endif
+    {
+        retVal = Cdd_Flc_OverlayLoadInternal(OverlayId, (boolean)TRUE, (boolean)TRUE);
+    }
+
+    return retVal;
+}
+
+FUNC(void, CDD_FLC_CODE)
+Cdd_Flc_OverlayCallExit(VAR(uint32, AUTOMATIC) OverlayId)
+{
+    uint32 slotIdx = CDD_FLC_OVERLAY_INVALID_ID;
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    if (NULL_PTR == Cdd_Flc_OverlayCfgPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_CALL_EXIT,
+                              CDD_FLC_E_UNINIT);
+    }
+    else
+#endif
+    {
+        SchM_Enter_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+        slotIdx = Cdd_Flc_OverlayFindSlot(OverlayId);
+        if ((slotIdx != CDD_FLC_OVERLAY_INVALID_ID) && (Cdd_Flc_OverlaySlotState[slotIdx].activeCount > 0U))
+        {
+            Cdd_Flc_OverlaySlotState[slotIdx].activeCount--;
+        }
+        else
+        {
+            slotIdx = CDD_FLC_OVERLAY_INVALID_ID;
+        }
+        SchM_Exit_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+        if (slotIdx == CDD_FLC_OVERLAY_INVALID_ID)
+        {
+            /* No call of this overlay is executing */
+            (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_CALL_EXIT,
+                                  CDD_FLC_E_ILLEGAL_OVERLAY_ID);
+        }
+#endif
+    }
+
+    return;
+}
+
+FUNC(boolean, CDD_FLC_CODE)
+Cdd_Flc_OverlayIsResident(VAR(uint32, AUTOMATIC) OverlayId)
+{
+    boolean result = FALSE;
+    uint32  slotIdx;
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    if (NULL_PTR == Cdd_Flc_OverlayCfgPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_IS_RESIDENT,
+                              CDD_FLC_E_UNINIT);
+    }
+    else
+#endif
+    {
+        slotIdx = Cdd_Flc_OverlayFindSlot(OverlayId);
+        if (slotIdx != CDD_FLC_OVERLAY_INVALID_ID)
+        {
+            result = Cdd_Flc_IsRegionCopyDone(Cdd_Flc_OverlayCfgPtr->hwUnitId,
+                                              Cdd_Flc_OverlayCfgPtr->slots[slotIdx].regionId);
+        }
+    }
+
+    return result;
+}
+
+FUNC(void, CDD_FLC_CODE)
+Cdd_Flc_OverlayGetStats(P2VAR(Cdd_Flc_OverlayStatsType, AUTOMATIC, CDD_FLC_DATA) StatsPtr)
+{
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+    if (NULL_PTR == Cdd_Flc_OverlayCfgPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_GET_STATS,
+                              CDD_FLC_E_UNINIT);
+    }
+    else if (NULL_PTR == StatsPtr)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_GET_STATS,
+                              CDD_FLC_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        SchM_Enter_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+        *StatsPtr = Cdd_Flc_OverlayStats;
+        SchM_Exit_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+    }
+
+    return;
+}
+
+static Std_ReturnType Cdd_Flc_OverlayLoadInternal(uint32 overlayId, boolean waitForCopy, boolean hold)
+{
+    Std_ReturnType                   retVal = E_NOT_OK;
+    const Cdd_Flc_OverlayConfigType *cfg    = Cdd_Flc_OverlayCfgPtr;
+    const Cdd_Flc_OverlayType       *overlay;
+    const Cdd_Flc_OverlaySlotType   *slot;
+    Cdd_Flc_RegionConfigType         regionCfg;
+    uint32                           slotIdx;
+    boolean                          isEviction;
+
+    /* Slot selection, region reprogramming and slot bookkeeping form one
+     * update - a concurrent load must not pick the same victim */
+    SchM_Enter_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+    Cdd_Flc_OverlayUseCounter++;
+    slotIdx = Cdd_Flc_OverlayFindSlot(overlayId);
+    if (slotIdx != CDD_FLC_OVERLAY_INVALID_ID)
+    {
+        /* Hit - overlay already owns a slot */
+        Cdd_Flc_OverlayStats.hitCount++;
+        retVal = E_OK;
+    }
+    else
+    {
+        overlay = &cfg->overlays[overlayId];
+        slotIdx = Cdd_Flc_OverlaySelectVictim(overlay->srcEndAddr - overlay->srcStartAddr);
+        if (slotIdx != CDD_FLC_OVERLAY_INVALID_ID)
+        {
+            slot       = &cfg->slots[slotIdx];
+            isEviction = (Cdd_Flc_OverlaySlotState[slotIdx].overlayId != CDD_FLC_OVERLAY_INVALID_ID);
+            /* Reprogram the region of the victim slot and start the copy */
+            regionCfg.srcStartAddr  = overlay->srcStartAddr;
+            regionCfg.srcEndAddr    = overlay->srcEndAddr;
+            regionCfg.destStartAddr = slot->destStartAddr;
+            Cdd_Flc_DisableRegion(cfg->hwUnitId, slot->regionId);
+            retVal = Cdd_Flc_ConfigureRegion(cfg->hwUnitId, slot->regionId, &regionCfg);
+            if (retVal == E_OK)
+            {
+                Cdd_Flc_EnableRegion(cfg->hwUnitId, slot->regionId, (boolean)FALSE);
+                Cdd_Flc_OverlaySlotState[slotIdx].overlayId = overlayId;
+                Cdd_Flc_OverlayStats.loadCount++;
+                if (isEviction == TRUE)
+                {
+                    Cdd_Flc_OverlayStats.evictCount++;
+                }
+            }
+            else
+            {
+                Cdd_Flc_OverlaySlotState[slotIdx].overlayId = CDD_FLC_OVERLAY_INVALID_ID;
+            }
+        }
+    }
+
+    if (retVal == E_OK)
+    {
+        Cdd_Flc_OverlaySlotState[slotIdx].lastUse = Cdd_Flc_OverlayUseCounter;
+        if (hold == TRUE)
+        {
+            /* Held before the wait so that no other load evicts it meanwhile */
+            Cdd_Flc_OverlaySlotState[slotIdx].activeCount++;
+        }
+    }
+    SchM_Exit_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+
+    if ((retVal == E_OK) && (waitForCopy == TRUE))
+    {
+        Cdd_Flc_OverlayWaitCopy(cfg->slots[slotIdx].regionId);
+    }
+
+    return retVal;
+}
+
+static uint32 Cdd_Flc_OverlayFindSlot(uint32 overlayId)
+{
+    uint32 slotIdx = CDD_FLC_OVERLAY_INVALID_ID;
+
+    for (uint32 idx = 0U; idx < Cdd_Flc_OverlayCfgPtr->numSlots; idx++)
+    {
+        if (Cdd_Flc_OverlaySlotState[idx].overlayId == overlayId)
+        {
+            slotIdx = idx;
+            break;
+        }
+    }
+
+    return slotIdx;
+}
+
+static uint32 Cdd_Flc_OverlaySelectVictim(uint32 overlaySize)
+{
+    uint32 slotIdx = CDD_FLC_OVERLAY_INVALID_ID;
+    uint32 age, maxAge = 0U;
+
+    /* Pick the least recently used slot which can hold the overlay and has
+     * no call executing from it. An empty slot has lastUse 0 and therefore
+     * the largest age */
+    for (uint32 idx = 0U; idx < Cdd_Flc_OverlayCfgPtr->numSlots; idx++)
+    {
+        if ((Cdd_Flc_OverlayCfgPtr->slots[idx].size >= overlaySize) &&
+            (Cdd_Flc_OverlaySlotState[idx].activeCount == 0U))
+        {
+            age = Cdd_Flc_OverlayUseCounter - Cdd_Flc_OverlaySlotState[idx].lastUse;
+            if ((slotIdx == CDD_FLC_OVERLAY_INVALID_ID) || (age > maxAge))
+            {
+                slotIdx = idx;
+                maxAge  = age;
+            }
+        }
+    }
+
+    return slotIdx;
+}
+
+static void Cdd_Flc_OverlayWaitCopy(Cdd_Flc_RegionId regionId)
+{
+    uint32 startCycles = 0U;
+    uint32 endCycles   = 0U;
+
+    if (Cdd_Flc_IsRegionCopyDone(Cdd_Flc_OverlayCfgPtr->hwUnitId, regionId) == FALSE)
+    {
+        Mcal_GetCycleCounterValue(&startCycles);
+        while (Cdd_Flc_IsRegionCopyDone(Cdd_Flc_OverlayCfgPtr->hwUnitId, regionId) == FALSE)
+        {
+            /* Wait for the FLC copy to complete */
+        }
+        Mcal_GetCycleCounterValue(&endCycles);
+        SchM_Enter_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+        Cdd_Flc_OverlayStats.stallCount++;
+        Cdd_Flc_OverlayStats.stallCycles += (endCycles - startCycles);
+        SchM_Exit_Cdd_Flc_FLC_EXCLUSIVE_AREA_0();
+    }
+
+    return;
+}
+
+#if (STD_ON == CDD_FLC_DEV_ERROR_DETECT)
+static Std_ReturnType Cdd_Flc_OverlayInitParamCheck(const Cdd_Flc_OverlayConfigType *configPtr)
+{
+    Std_ReturnType retVal      = E_OK;
+    uint32         maxSlotSize = 0U;
+
+    if ((NULL_PTR == configPtr) || (NULL_PTR == configPtr->overlays) || (NULL_PTR == configPtr->slots))
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                              CDD_FLC_E_PARAM_POINTER);
+        retVal = E_NOT_OK;
+    }
+    else if (configPtr->hwUnitId >= CDD_FLC_RL2_MAX)
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                              CDD_FLC_E_ILLEGAL_HW_ID);
+        retVal = E_NOT_OK;
+    }
+    else if ((configPtr->numSlots == 0U) || (configPtr->numSlots > (uint32)CDD_FLC_REGION_ID_MAX))
+    {
+        (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                              CDD_FLC_E_ILLEGAL_REGION_ID);
+        retVal = E_NOT_OK;
+    }
+    else
+    {
+        for (uint32 idx = 0U; idx < configPtr->numSlots; idx++)
+        {
+            if (configPtr->slots[idx].regionId >= CDD_FLC_REGION_ID_MAX)
+            {
+                (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                                      CDD_FLC_E_ILLEGAL_REGION_ID);
+                retVal = E_NOT_OK;
+            }
+            else if (((configPtr->slots[idx].destStartAddr & CDD_FLC_ADDR_ALIGNMENT_MSK) != 0U) ||
+                     ((configPtr->slots[idx].size & CDD_FLC_ADDR_ALIGNMENT_MSK) != 0U))
+            {
+                (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                                      CDD_FLC_E_UNALIGNED_ADDRESS);
+                retVal = E_NOT_OK;
+            }
+            else
+            {
+                /* Slot is valid */
+                if (configPtr->slots[idx].size > maxSlotSize)
+                {
+                    maxSlotSize = configPtr->slots[idx].size;
+                }
+            }
+        }
+        for (uint32 idx = 0U; idx < configPtr->numOverlays; idx++)
+        {
+            if (((configPtr->overlays[idx].srcStartAddr & CDD_FLC_ADDR_ALIGNMENT_MSK) != 0U) ||
+                ((configPtr->overlays[idx].srcEndAddr & CDD_FLC_ADDR_ALIGNMENT_MSK) != 0U))
+            {
+                (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                                      CDD_FLC_E_UNALIGNED_ADDRESS);
+                retVal = E_NOT_OK;
+            }
+            else if ((configPtr->overlays[idx].srcEndAddr <= configPtr->overlays[idx].srcStartAddr) ||
+                     ((configPtr->overlays[idx].srcEndAddr - configPtr->overlays[idx].srcStartAddr) > maxSlotSize))
+            {
+                /* Empty overlay or no slot large enough to hold it */
+                (void)Det_ReportError(CDD_FLC_MODULE_ID, CDD_FLC_INSTANCE_ID, CDD_FLC_SID_OVERLAY_INIT,
+                                      CDD_FLC_E_ILLEGAL_OVERLAY_ID);
+                retVal = E_NOT_OK;
+            }
+            else
+            {
+                /* Overlay is valid */
+            }
+        }
+    }
+
+    return retVal;
+}
+#endif
+
+#define CDD_FLC_STOP_SEC_CODE
+#include "Cdd_Flc_MemMap.h"
+
+#endif /* #if (STD_ON == CDD_FLC_OVERLAY_API) */
@@ -2,5 +2,5 @@ include $(mcal_PATH)/Cdd_Flc/inc.mk
 
 ifeq ($(SOC), $(filter $(SOC), am263px am261))
   SRCDIR += $(mcal_PATH)/Cdd_Flc/src
-  SRCS_COMMON += Cdd_Flc.c
+  SRCS_COMMON += Cdd_Flc.c Cdd_Flc_Overlay.c
 endif
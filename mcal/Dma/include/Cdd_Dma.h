@@ -130,6 +130,9 @@ extern "C" {
 /** \brief Category 2 ISR type */
 #define CDD_DMA_ISR_CAT2 (0x02U)
 /** @} */
+/** \brief linkIndex of Cdd_Dma_ReloadParamSet() for a reload param set without a link */
+#define CDD_DMA_RELOAD_NO_LINK (0xFFFFFFFFU)
+
 /**
  *  \name CDD DMA API Service ID
  *  @{
@@ -161,6 +164,12 @@ extern "C" {
 #define CDD_DMA_DISABLETRANSFERREGION_SERVICE_ID 0x0CU
 /** \brief  API Service ID for Register Read Back */
 #define CDD_DMA_REGISTER_READBACK_SERVICE_ID 0x0DU
+/** \brief  API Service ID for Get Statistics */
+#define CDD_DMA_GETSTATISTICS_SERVICE_ID 0x0EU
+/** \brief  API Service ID for Reset Statistics */
+#define CDD_DMA_RESETSTATISTICS_SERVICE_ID 0x0FU
+/** \brief  API Service ID for Reload Param Set */
+#define CDD_DMA_RELOADPARAMSET_SERVICE_ID 0x10U
 /** @} */
 
 /**
@@ -329,6 +338,32 @@ void Cdd_Dma_ParamSet(uint32 handleId, uint32 channelIdx, uint32 paramIndex, Cdd
  *****************************************************************************/
 void Cdd_Dma_LinkChannel(uint32 handleId, uint32 paramIndex0, uint32 paramIndex1);
 
+/** \brief Service for CDD_DMA Reload Param Setting.
+ * Function to write a link (reload) param set of channel 0 of a handle and link it to
+ * another param set. Only the first param set gets the handle TCC from Cdd_Dma_ParamSet,
+ * so the OPT of the written set is copied from param set 0 (paramEntry.opt is ignored)
+ * and the set completes like the first one. Param set 0 must be written first.
+ * Unlike Cdd_Dma_ParamSet the handle may be in progress, so only param index 0 (the active
+ * set) is rejected. The caller must ensure the rewritten set is not currently linked from
+ * the active set; the new set is picked up with Cdd_Dma_LinkChannel.
+ *
+ * Service ID[hex]   : 0x10
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non-Reentrant
+ *
+ * \param[in] handleId - Cdd_Dma handle is passed for which we want to set the param set value
+ * \param[in] paramIndex - Index of the reload param for which we want to set the param values
+ * \param[in] linkIndex - Index of the param the reload param links to (paramIndex for a self
+ *                        linked set), CDD_DMA_RELOAD_NO_LINK to end the transfer after it
+ * \param[in] paramEntry - Structure which contains the required paramSet fields
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+void Cdd_Dma_ReloadParamSet(uint32 handleId, uint32 paramIndex, uint32 linkIndex, Cdd_Dma_ParamEntry paramEntry);
+
 /** \brief Service for CDD_DMA Chaining Channels
  * Function to Chain multiple channel and can be used in transmission only with one trigger
  *
@@ -453,6 +488,48 @@ boolean Cdd_Dma_DisableTransferRegion(uint32 handleId, uint32 trigMode);
  *****************************************************************************/
 Std_ReturnType Cdd_Dma_RegisterReadback(uint32 handleId, Cdd_Dma_RegisterReadbackType *RegPtr);
 
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+/** \brief This function returns a snapshot of the transfer statistics of a handle: bytes
+ *transferred, transfer count, submit-to-completion cycles, event queue watermark and missed
+ *events. Cycle values are taken from the PMU cycle counter, which must be enabled by the
+ *application. Latency is only measured for transfers started by Cdd_Dma_EnableTransferRegion;
+ *completions of linked or event triggered transfers count bytes and transfers only. Missed
+ *events are counted as rising edges of the EMR bit, which the driver does not clear.
+ *
+ * Service ID[hex]   : 0x0E
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[in] handleId - Cdd_Dma handle for which the statistics are read
+ * \param[out] StatsPtr - Pointer to where to store the statistics. If this pointer is
+ *NULL_PTR, then the API will return E_NOT_OK.
+ * \return Std_ReturnType
+ * \retval E_OK: Statistics have been copied
+ * \retval E_NOT_OK: Statistics could not be read
+ *
+ *****************************************************************************/
+Std_ReturnType Cdd_Dma_GetStatistics(uint32 handleId, Cdd_Dma_StatisticsType *StatsPtr);
+
+/** \brief This function clears the transfer statistics of a handle. The hardware queue
+ *watermark is not cleared as the event queue may be shared with other handles.
+ *
+ * Service ID[hex]   : 0x0F
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[in] handleId - Cdd_Dma handle for which the statistics are cleared
+ * \return Std_ReturnType
+ * \retval E_OK: Statistics have been cleared
+ * \retval E_NOT_OK: Statistics could not be cleared
+ *
+ *****************************************************************************/
+Std_ReturnType Cdd_Dma_ResetStatistics(uint32 handleId);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
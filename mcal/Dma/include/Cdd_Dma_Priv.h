@@ -479,8 +479,41 @@ typedef struct
 {
     /* Revision Id  */
     uint32 revisionId;
+    /* Event queue status (QSTATn), one entry per event queue */
+    uint32 qStat[CDD_EDMA_NUM_EVQUE];
+    /* Channel controller status (CCSTAT) */
+    uint32 ccStat;
+    /* Event missed register for channels 0-31 (EMR) */
+    uint32 eventMissed;
+    /* Event missed register for channels 32-63 (EMRH) */
+    uint32 eventMissedHigh;
 } Cdd_Dma_RegisterReadbackType;
 
+typedef struct
+{
+    /* Total number of bytes moved by the handle since init or last reset */
+    uint64 bytesTransferred;
+    /* Accumulated submit-to-completion time in PMU cycles */
+    uint64 totalLatencyCycles;
+    /* Number of completed transfers */
+    uint32 transferCount;
+    /* Number of completed transfers started by a submit, over which the latency figures are
+     * taken. Completions of linked or event triggered transfers are not included. */
+    uint32 latencyCount;
+    /* Submit-to-completion time of the last completed transfer in PMU cycles */
+    uint32 lastLatencyCycles;
+    /* Smallest submit-to-completion time seen in PMU cycles */
+    uint32 minLatencyCycles;
+    /* Largest submit-to-completion time seen in PMU cycles */
+    uint32 maxLatencyCycles;
+    /* Watermark (QSTATn.WM) of the event queue the handle is mapped to */
+    uint32 queueWatermark;
+    /* Number of times the missed event (EMR) bit of the first channel of the handle was seen
+     * newly set when sampled at completion or snapshot. The bit is not cleared by the
+     * statistics, so this counts edges of the bit, not lost events. */
+    uint32 missedEventCount;
+} Cdd_Dma_StatisticsType;
+
 typedef struct
 {
     /* Baseaddress of the dDma instance used */
@@ -1666,6 +1699,45 @@ void Cdd_Dma_CbkUnregister(uint32 handleId);
  */
 void Cdd_Dma_ReadBack(Cdd_Dma_RegisterReadbackType *RegRbPtr, uint32 baseAddr);
 
+/**
+ * \brief   This API records the submit timestamp of a transfer for the handle.
+ *
+ * \param   handleId    Cdd_Dma handle which has just been triggered
+ */
+void Cdd_Dma_StatsRecordSubmit(uint32 handleId);
+
+/**
+ * \brief   This API accounts a completed transfer for the handle: bytes,
+ *          submit-to-completion cycles, queue watermark and missed events.
+ *
+ * \param   handleId    Cdd_Dma handle whose transfer has completed
+ */
+void Cdd_Dma_StatsRecordCompletion(uint32 handleId);
+
+/**
+ * \brief   This API records the number of bytes moved by one transfer of the
+ *          handle, as programmed in its first PaRAM set.
+ *
+ * \param   handleId    Cdd_Dma handle
+ * \param   paramEntry  PaRAM set programmed for the first channel of the handle
+ */
+void Cdd_Dma_StatsSetTransferSize(uint32 handleId, const CDD_EDMACCEDMACCPaRAMEntry *paramEntry);
+
+/**
+ * \brief   This API copies the statistics of the handle into StatsPtr.
+ *
+ * \param   handleId    Cdd_Dma handle
+ * \param   StatsPtr    Pointer to where the snapshot is stored
+ */
+void Cdd_Dma_StatsSnapshot(uint32 handleId, Cdd_Dma_StatisticsType *StatsPtr);
+
+/**
+ * \brief   This API clears the statistics of the handle.
+ *
+ * \param   handleId    Cdd_Dma handle
+ */
+void Cdd_Dma_StatsReset(uint32 handleId);
+
 #ifdef __cplusplus
 }
 #endif
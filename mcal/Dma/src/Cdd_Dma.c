@@ -108,6 +108,8 @@ uint32 Cdd_Dma_ChainingTcc[CDD_EDMA_NUM_DMACH][CDD_EDMA_NUM_DMACH] = {{0}};
 
 static void           Cdd_Dma_ParamSet_ConfigValues(uint32 handleId, uint32 channelIdx, uint32 paramIndex,
                                                     Cdd_Dma_ParamEntry paramEntry);
+static void           Cdd_Dma_ReloadParamSet_ConfigValues(uint32 handleId, uint32 paramIndex, uint32 linkIndex,
+                                                          Cdd_Dma_ParamEntry paramEntry);
 static Std_ReturnType Cdd_Edma_lld_intrRegister(uint32 handleId, void *appdata, Cdd_Edma_EventCallback callback);
 static boolean        Cdd_Edma_lld_transferRegion(uint32 handleId, uint32 trigMode);
 #if (STD_ON == CDD_DMA_DEV_ERROR_DETECT)
@@ -154,6 +156,12 @@ void Cdd_Dma_Init(Cdd_Dma_ConfigType *ConfigPtr)
         Cdd_Dma_TrigXbar();
         Cdd_Dma_Xbar();
         CDD_EDMA_lld_init(Cdd_Dma_HandlerList);
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+        for (uint32 i = 0; i < (uint32)CDD_DMA_MAX_HANDLER; i++)
+        {
+            Cdd_Dma_StatsReset(i);
+        }
+#endif
         Cdd_Dma_InitDone = TRUE;
     }
     else
@@ -297,6 +305,46 @@ void Cdd_Dma_ParamSet(uint32 handleId, uint32 channelIdx, uint32 paramIndex, Cdd
 #endif
 }
 
+void Cdd_Dma_ReloadParamSet(uint32 handleId, uint32 paramIndex, uint32 linkIndex, Cdd_Dma_ParamEntry paramEntry)
+{
+#if (STD_ON == CDD_DMA_DEV_ERROR_DETECT)
+    uint32 maxParamCheck = 0U;
+    if (FALSE == Cdd_Dma_InitDone)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_RELOADPARAMSET_SERVICE_ID, CDD_DMA_E_UNINIT);
+    }
+    else if (handleId >= (uint32)CDD_DMA_MAX_HANDLER)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_RELOADPARAMSET_SERVICE_ID, CDD_DMA_E_PARAM_VALUE);
+    }
+    else
+    {
+        maxParamCheck = Cdd_Dma_HandlerList->CddDmaDriverHandler[handleId]->edmaConfig.ownResource.channelGroup[0U]
+                            ->maxParam;
+        if ((paramIndex == 0U) || (maxParamCheck <= paramIndex) ||
+            ((linkIndex != CDD_DMA_RELOAD_NO_LINK) && (maxParamCheck <= linkIndex)))
+        {
+            Cdd_Dma_ReportDetError(CDD_DMA_RELOADPARAMSET_SERVICE_ID, CDD_DMA_E_PARAM_VALUE);
+        }
+        else
+        {
+            Cdd_Dma_ReloadParamSet_ConfigValues(handleId, paramIndex, linkIndex, paramEntry);
+        }
+    }
+#else
+    /* DET_OFF: runtime bound check before using handleId as index */
+    if ((handleId < (uint32)CDD_DMA_MAX_HANDLER) && (paramIndex != 0U))
+    {
+        Cdd_Dma_ReloadParamSet_ConfigValues(handleId, paramIndex, linkIndex, paramEntry);
+    }
+    else
+    {
+        Det_ReportRuntimeError(CDD_DMA_MODULE_ID, CDD_DMA_INSTANCE_ID, CDD_DMA_RELOADPARAMSET_SERVICE_ID,
+                               CDD_DMA_E_PARAM_VALUE);
+    }
+#endif
+}
+
 /*
  *Design:MCAL-19830,MCAL-19831,MCAL-19832,MCAL-19700,MCAL-18938,MCAL-22650
  */
@@ -448,6 +496,9 @@ boolean Cdd_Dma_GetStatus(uint32 handleId)
         retval = (boolean)CDD_EDMA_lld_readIntrStatusRegion(baseAddr, region, tcc);
         if (retval == TRUE)
         {
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+            Cdd_Dma_StatsRecordCompletion(handleId);
+#endif
             Cdd_Dma_handleAlreadyInUse[handleId] = 0;
             CDD_EDMA_lld_clrIntrRegion(baseAddr, region, tcc);
         }
@@ -598,6 +649,32 @@ static void Cdd_Dma_ParamSet_ConfigValues(uint32 handleId, uint32 channelIdx, ui
         /*Do Nothing*/
     }
     CDD_EDMA_lld_setPaRAM(baseAddr, param, &edmaParam);
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+    if ((channelIdx == 0U) && (paramIndex == 0U))
+    {
+        Cdd_Dma_StatsSetTransferSize(handleId, &edmaParam);
+    }
+#endif
+}
+
+static void Cdd_Dma_ReloadParamSet_ConfigValues(uint32 handleId, uint32 paramIndex, uint32 linkIndex,
+                                                Cdd_Dma_ParamEntry paramEntry)
+{
+    Cdd_Dma_Handler           *hEdma = Cdd_Dma_HandlerList->CddDmaDriverHandler[handleId];
+    Cdd_Dma_ChannelGroup      *chCfg = hEdma->edmaConfig.ownResource.channelGroup[0U];
+    CDD_EDMACCEDMACCPaRAMEntry firstParam;
+
+    /* Only the first PaRAM set gets the handler TCC from Cdd_Dma_ParamSet -
+     * copy its OPT so that the link sets complete on the same code */
+    CDD_EDMA_lld_getPaRAM(hEdma->baseAddr, chCfg->paramGroup[0U]->paramId, &firstParam);
+    paramEntry.opt = firstParam.opt;
+    Cdd_Dma_ParamSet_ConfigValues(handleId, 0U, paramIndex, paramEntry);
+
+    if (linkIndex != CDD_DMA_RELOAD_NO_LINK)
+    {
+        CDD_EDMA_lld_linkChannel(hEdma->baseAddr, chCfg->paramGroup[paramIndex]->paramId,
+                                 chCfg->paramGroup[linkIndex]->paramId);
+    }
 }
 
 #if (STD_ON == CDD_DMA_DEV_ERROR_DETECT)
@@ -658,6 +735,10 @@ static boolean Cdd_Edma_lld_transferRegion(uint32 handleId, uint32 trigMode)
         region                               = hEdmaInit.regionId;
         channel                              = hEdmaInit.ownResource.channelGroup[0]->channelId;
         Cdd_Dma_handleAlreadyInUse[handleId] = 1;
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+        /* Timestamp before the trigger so that a fast completion never precedes the submit */
+        Cdd_Dma_StatsRecordSubmit(handleId);
+#endif
         exitCondition = (boolean)CDD_EDMA_lld_enableTransferRegion(baseAddr, region, channel, trigMode);
         if (exitCondition == FALSE)
         {
@@ -746,6 +827,58 @@ Std_ReturnType Cdd_Dma_RegisterReadback(uint32 handleId, Cdd_Dma_RegisterReadbac
 }
 #endif
 
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+Std_ReturnType Cdd_Dma_GetStatistics(uint32 handleId, Cdd_Dma_StatisticsType *StatsPtr)
+{
+    Std_ReturnType retVal = ((Std_ReturnType)E_NOT_OK);
+#if (STD_ON == CDD_DMA_DEV_ERROR_DETECT)
+    if (FALSE == Cdd_Dma_InitDone)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_GETSTATISTICS_SERVICE_ID, CDD_DMA_E_UNINIT);
+    }
+    else if (handleId >= (uint32)CDD_DMA_MAX_HANDLER)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_GETSTATISTICS_SERVICE_ID, CDD_DMA_E_PARAM_VALUE);
+    }
+    else if (StatsPtr == NULL_PTR)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_GETSTATISTICS_SERVICE_ID, CDD_DMA_E_PARAM_POINTER);
+    }
+    else
+#else
+    if ((handleId < (uint32)CDD_DMA_MAX_HANDLER) && (StatsPtr != NULL_PTR))
+#endif
+    {
+        Cdd_Dma_StatsSnapshot(handleId, StatsPtr);
+        retVal = ((Std_ReturnType)E_OK);
+    }
+    return retVal;
+}
+
+Std_ReturnType Cdd_Dma_ResetStatistics(uint32 handleId)
+{
+    Std_ReturnType retVal = ((Std_ReturnType)E_NOT_OK);
+#if (STD_ON == CDD_DMA_DEV_ERROR_DETECT)
+    if (FALSE == Cdd_Dma_InitDone)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_RESETSTATISTICS_SERVICE_ID, CDD_DMA_E_UNINIT);
+    }
+    else if (handleId >= (uint32)CDD_DMA_MAX_HANDLER)
+    {
+        Cdd_Dma_ReportDetError(CDD_DMA_RESETSTATISTICS_SERVICE_ID, CDD_DMA_E_PARAM_VALUE);
+    }
+    else
+#else
+    if (handleId < (uint32)CDD_DMA_MAX_HANDLER)
+#endif
+    {
+        Cdd_Dma_StatsReset(handleId);
+        retVal = ((Std_ReturnType)E_OK);
+    }
+    return retVal;
+}
+#endif
+
 #define CDD_DMA_STOP_SEC_CODE
 #include "Cdd_Dma_MemMap.h"
 /*********************************************************************************************************************
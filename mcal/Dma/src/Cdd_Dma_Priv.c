@@ -68,6 +68,9 @@
 #include "Cdd_Dma_Priv.h"
 #include "Cdd_Dma.h"
 #include "Mcal_Libs_Utils.h"
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+#include "sys_pmu.h"
+#endif
 
 /* ========================================================================== */
 /*                        Static Function Declaration                         */
@@ -79,6 +82,9 @@ static void   CDD_EDMA_lld_initializeCheckChannel(uint32 channel, uint32 baseAdd
 static void   CDD_EDMA_lld_initializeCheckTcc(uint32 tcc, uint32 baseAddr, uint32 regionId);
 static void   CDD_EDMA_TransferCompletion_MasterIsr_loop(uint8 i);
 static void   Cdd_Edma_lld_chainingConfig(Cdd_Dma_Handler *hEdma, uint32 handleId);
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+static void Cdd_Dma_StatsUpdateHwCounters(uint32 handleId);
+#endif
 /* ========================================================================== */
 /*                        Local Type Declaration                         */
 /* ========================================================================== */
@@ -103,6 +109,33 @@ Cdd_Edma_EventCallback Cdd_Dma_CallBackList[CDD_EDMA_NUM_DMACH];
 #define CDD_DMA_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "Cdd_Dma_MemMap.h"
 
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+#define CDD_DMA_START_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Dma_MemMap.h"
+/* Per handler transfer statistics */
+static Cdd_Dma_StatisticsType Cdd_Dma_Stats[CDD_DMA_MAX_HANDLER] = {{0}};
+#define CDD_DMA_STOP_SEC_VAR_INIT_UNSPECIFIED
+#include "Cdd_Dma_MemMap.h"
+
+#define CDD_DMA_START_SEC_VAR_INIT_32
+#include "Cdd_Dma_MemMap.h"
+/* PMU cycle count captured when the last transfer of the handle was triggered */
+static uint32 Cdd_Dma_StatsSubmitCycles[CDD_DMA_MAX_HANDLER] = {0};
+/* Bytes moved by one transfer of the handle (ACNT * BCNT * CCNT of its first PaRAM set) */
+static uint32 Cdd_Dma_StatsXferBytes[CDD_DMA_MAX_HANDLER] = {0};
+#define CDD_DMA_STOP_SEC_VAR_INIT_32
+#include "Cdd_Dma_MemMap.h"
+
+#define CDD_DMA_START_SEC_VAR_INIT_8
+#include "Cdd_Dma_MemMap.h"
+/* EMR bit of the first channel of the handle as seen by the last sample */
+static boolean Cdd_Dma_StatsMissedSeen[CDD_DMA_MAX_HANDLER] = {FALSE};
+/* TRUE from a software submit until the completion it started has been accounted */
+static boolean Cdd_Dma_StatsSubmitPending[CDD_DMA_MAX_HANDLER] = {FALSE};
+#define CDD_DMA_STOP_SEC_VAR_INIT_8
+#include "Cdd_Dma_MemMap.h"
+#endif
+
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -976,6 +1009,118 @@ static void Cdd_Edma_lld_chainingConfig(Cdd_Dma_Handler *hEdma, uint32 handleId)
     }
 }
 
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+void Cdd_Dma_StatsSetTransferSize(uint32 handleId, const CDD_EDMACCEDMACCPaRAMEntry *paramEntry)
+{
+    Cdd_Dma_StatsXferBytes[handleId] =
+        (uint32)paramEntry->aCnt * (uint32)paramEntry->bCnt * (uint32)paramEntry->cCnt;
+}
+
+void Cdd_Dma_StatsRecordSubmit(uint32 handleId)
+{
+    uint32 cycles = 0U;
+    Mcal_GetCycleCounterValue(&cycles);
+    Cdd_Dma_StatsSubmitCycles[handleId]  = cycles;
+    Cdd_Dma_StatsSubmitPending[handleId] = TRUE;
+}
+
+void Cdd_Dma_StatsRecordCompletion(uint32 handleId)
+{
+    Cdd_Dma_StatisticsType *stats  = &Cdd_Dma_Stats[handleId];
+    uint32                  cycles = 0U;
+    uint32                  latency;
+
+    Mcal_GetCycleCounterValue(&cycles);
+    /* Unsigned subtraction handles a single wrap of the 32-bit cycle counter */
+    latency = cycles - Cdd_Dma_StatsSubmitCycles[handleId];
+
+    SchM_Enter_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+    stats->bytesTransferred += (uint64)Cdd_Dma_StatsXferBytes[handleId];
+    /* Completions of linked or event triggered transfers that were not started by a submit
+     * have no start time and are left out of the latency figures */
+    if (Cdd_Dma_StatsSubmitPending[handleId] == TRUE)
+    {
+        Cdd_Dma_StatsSubmitPending[handleId] = FALSE;
+        stats->totalLatencyCycles           += (uint64)latency;
+        stats->lastLatencyCycles             = latency;
+        if ((stats->latencyCount == 0U) || (latency < stats->minLatencyCycles))
+        {
+            stats->minLatencyCycles = latency;
+        }
+        if (latency > stats->maxLatencyCycles)
+        {
+            stats->maxLatencyCycles = latency;
+        }
+        stats->latencyCount++;
+    }
+    stats->transferCount++;
+    Cdd_Dma_StatsUpdateHwCounters(handleId);
+    SchM_Exit_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+}
+
+void Cdd_Dma_StatsSnapshot(uint32 handleId, Cdd_Dma_StatisticsType *StatsPtr)
+{
+    SchM_Enter_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+    Cdd_Dma_StatsUpdateHwCounters(handleId);
+    *StatsPtr = Cdd_Dma_Stats[handleId];
+    SchM_Exit_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+}
+
+void Cdd_Dma_StatsReset(uint32 handleId)
+{
+    SchM_Enter_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+    (void)memset(&Cdd_Dma_Stats[handleId], 0, sizeof(Cdd_Dma_StatisticsType));
+    /* Restart edge detection so that a bit still set is counted again after the reset */
+    Cdd_Dma_StatsMissedSeen[handleId] = FALSE;
+    SchM_Exit_Cdd_Dma_DMA_EXCLUSIVE_AREA_0();
+}
+
+/* Samples the event queue watermark and accounts a missed event of the first channel of the
+ * handle. EMR is only read: clearing it is left to the owner of the channel, so the count is the
+ * number of rising edges of the bit between samples, not the number of events lost. Must be called with the exclusive area held. */
+static void Cdd_Dma_StatsUpdateHwCounters(uint32 handleId)
+{
+    Cdd_Dma_Handler *hEdma;
+    uint32           baseAddr, chNum, queNum, regVal, watermark;
+    boolean          missed = FALSE;
+
+    hEdma = Cdd_Dma_HandlerList->CddDmaDriverHandler[handleId];
+    if (hEdma != NULL_PTR)
+    {
+        baseAddr = hEdma->baseAddr;
+        queNum   = hEdma->edmaConfig.queNum;
+        chNum    = hEdma->edmaConfig.ownResource.channelGroup[0]->channelId;
+        if (queNum < CDD_EDMA_NUM_EVQUE)
+        {
+            regVal    = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_QSTATN(queNum));
+            watermark = (regVal & CDD_EDMA_TPCC_QSTATN_WM_MASK) >> CDD_EDMA_TPCC_QSTATN_WM_SHIFT;
+            if (watermark > Cdd_Dma_Stats[handleId].queueWatermark)
+            {
+                Cdd_Dma_Stats[handleId].queueWatermark = watermark;
+            }
+        }
+        if (chNum < 32U)
+        {
+            missed = (boolean)((HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_EMR) & ((uint32)0x01U << chNum)) != 0U);
+        }
+        else if (chNum < CDD_EDMA_NUM_DMACH)
+        {
+            missed =
+                (boolean)((HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_EMRH) & ((uint32)0x01U << (chNum - 32U))) != 0U);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        if ((missed == TRUE) && (Cdd_Dma_StatsMissedSeen[handleId] == FALSE))
+        {
+            Cdd_Dma_Stats[handleId].missedEventCount++;
+        }
+        Cdd_Dma_StatsMissedSeen[handleId] = missed;
+    }
+}
+#endif
+
 #define CDD_DMA_STOP_SEC_CODE
 #include "Cdd_Dma_MemMap.h"
 
@@ -1014,12 +1159,18 @@ static void CDD_EDMA_TransferCompletion_MasterIsr_loop(uint8 i)
             {
                 CDD_EDMA_lld_clrIntrRegion(baseAddr, regionId, tccNum);
                 intrLow &= ~(1U << tccNum);
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+                Cdd_Dma_StatsRecordCompletion((uint32)i);
+#endif
                 Cdd_Dma_CallBackList[tccNum](Cdd_Dma_AppDataList[tccNum]);
             }
             if ((tccNum >= 32U) && (tccNum < (uint32)CDD_EDMA_NUM_TCC) && ((intrHigh & (1U << (tccNum - 32U))) != 0U))
             {
                 CDD_EDMA_lld_clrIntrRegion(baseAddr, regionId, tccNum);
                 intrHigh &= ~(1U << (tccNum - 32U));
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+                Cdd_Dma_StatsRecordCompletion((uint32)i);
+#endif
                 Cdd_Dma_CallBackList[tccNum](Cdd_Dma_AppDataList[tccNum]);
             }
         }
@@ -1031,12 +1182,18 @@ static void CDD_EDMA_TransferCompletion_MasterIsr_loop(uint8 i)
             {
                 CDD_EDMA_lld_clrIntrRegion(baseAddr, regionId, tccNum);
                 intrLow &= ~(1U << tccNum);
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+                Cdd_Dma_StatsRecordCompletion((uint32)i);
+#endif
                 Cdd_Dma_CallBackList[tccNum](Cdd_Dma_AppDataList[tccNum]);
             }
             if ((tccNum >= 32U) && (tccNum < (uint32)CDD_EDMA_NUM_TCC) && ((intrHigh & (1U << (tccNum - 32U))) != 0U))
             {
                 CDD_EDMA_lld_clrIntrRegion(baseAddr, regionId, tccNum);
                 intrHigh &= ~(1U << (tccNum - 32U));
+#if (STD_ON == CDD_DMA_STATISTICS_API)
+                Cdd_Dma_StatsRecordCompletion((uint32)i);
+#endif
                 Cdd_Dma_CallBackList[tccNum](Cdd_Dma_AppDataList[tccNum]);
             }
         }
@@ -1052,6 +1209,13 @@ void Cdd_Dma_ReadBack(Cdd_Dma_RegisterReadbackType *RegRbPtr, uint32 baseAddr)
 {
     (void)memset(RegRbPtr, 0, sizeof(Cdd_Dma_RegisterReadbackType));
     RegRbPtr->revisionId = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_PID);
+    for (uint32 queNum = 0U; queNum < CDD_EDMA_NUM_EVQUE; queNum++)
+    {
+        RegRbPtr->qStat[queNum] = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_QSTATN(queNum));
+    }
+    RegRbPtr->ccStat          = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_CCSTAT);
+    RegRbPtr->eventMissed     = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_EMR);
+    RegRbPtr->eventMissedHigh = HW_RD_REG32(baseAddr + CDD_EDMA_TPCC_EMRH);
 }
 
 #define CDD_DMA_STOP_SEC_ISR_CODE
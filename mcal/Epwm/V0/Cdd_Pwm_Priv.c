@@ -251,6 +251,15 @@ void Cdd_Epwm_DeInitialize(uint32 epwmbaseadrr)
     EPWM_setOneShotSyncOutTrigger(epwmbaseadrr, EPWM_OSHT_SYNC_OUT_TRIG_SYNC);
     EPWM_forceSyncPulse(epwmbaseadrr);
 
+    /* Global Load */
+    EPWM_disableGlobalLoad(epwmbaseadrr);
+    EPWM_disableGlobalLoadOneShotMode(epwmbaseadrr);
+    EPWM_setGlobalLoadTrigger(epwmbaseadrr, EPWM_GL_LOAD_PULSE_CNTR_ZERO);
+    EPWM_setGlobalLoadEventPrescale(epwmbaseadrr, 0U);
+    EPWM_disableGlobalLoadRegisters(epwmbaseadrr, EPWM_GL_REGISTER_DBRED_DBREDHR);
+    EPWM_disableGlobalLoadRegisters(epwmbaseadrr, EPWM_GL_REGISTER_DBFED_DBFEDHR);
+    EPWM_setupEPWMLinks(epwmbaseadrr, CDD_PWM_EPWM_INSTANCE(epwmbaseadrr), EPWM_LINK_GLDCTL2);
+
     /* Counter Compare */
     EPWM_setCounterCompareValue(epwmbaseadrr, EPWM_COUNTER_COMPARE_A, 0);
     EPWM_disableGlobalLoadRegisters(epwmbaseadrr, EPWM_GL_REGISTER_CMPA_CMPAHR);
@@ -2776,6 +2785,89 @@ Cdd_Pwm_HrSfoCalibration_Private(Cdd_Pwm_channelParametertype ChannelParameter)
 }
 #endif /* #if (STD_ON == CDD_PWM_HR_SFO_CAL_API) */
 
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+void Cdd_Pwm_GlobalLoadReset(void)
+{
+    uint32 chIdx;
+
+    Cdd_Pwm_GlobalLoadGroup.masterBaseAddr = 0U;
+    Cdd_Pwm_GlobalLoadGroup.numChannels    = 0U;
+    Cdd_Pwm_GlobalLoadGroup.updateOpen     = FALSE;
+    for (chIdx = 0U; chIdx < CDD_PWM_MAX_NUM_CHANNELS; chIdx++)
+    {
+        Cdd_Pwm_GlobalLoadGroup.member[chIdx] = FALSE;
+    }
+}
+
+void Cdd_Pwm_GlobalLoadSetup_Private(const Cdd_Pwm_ChannelType *Channels, uint8 NumChannels,
+                                     EPWM_GlobalLoadTrigger Trigger)
+{
+    uint32           idx;
+    uint32           baseAddr;
+    EPWM_CurrentLink masterLink;
+
+    Cdd_Pwm_GlobalLoadReset();
+    Cdd_Pwm_GlobalLoadGroup.masterBaseAddr = Cdd_Pwm_ChObj[Channels[0]].baseaddr;
+    masterLink                             = CDD_PWM_EPWM_INSTANCE(Cdd_Pwm_GlobalLoadGroup.masterBaseAddr);
+
+    for (idx = 0U; idx < NumChannels; idx++)
+    {
+        baseAddr = Cdd_Pwm_ChObj[Channels[idx]].baseaddr;
+
+        /* All staged registers must go through their shadow */
+        EPWM_setPeriodLoadMode(baseAddr, EPWM_PERIOD_SHADOW_LOAD);
+        EPWM_setCounterCompareShadowLoadMode(baseAddr, EPWM_COUNTER_COMPARE_A, EPWM_COMP_LOAD_ON_CNTR_ZERO);
+        EPWM_setCounterCompareShadowLoadMode(baseAddr, EPWM_COUNTER_COMPARE_B, EPWM_COMP_LOAD_ON_CNTR_ZERO);
+        EPWM_setRisingEdgeDelayCountShadowLoadMode(baseAddr, EPWM_RED_LOAD_ON_CNTR_ZERO);
+        EPWM_setFallingEdgeDelayCountShadowLoadMode(baseAddr, EPWM_FED_LOAD_ON_CNTR_ZERO);
+
+        /* Shadow to active copy only on a one shot global load pulse */
+        EPWM_enableGlobalLoadRegisters(baseAddr, CDD_PWM_GL_UPDATE_REGISTERS);
+        EPWM_setGlobalLoadTrigger(baseAddr, Trigger);
+        EPWM_setGlobalLoadEventPrescale(baseAddr, 1U);
+        EPWM_enableGlobalLoadOneShotMode(baseAddr);
+        EPWM_enableGlobalLoad(baseAddr);
+
+        /* A write to GLDCTL2 of the master is mirrored to this channel */
+        EPWM_setupEPWMLinks(baseAddr, masterLink, EPWM_LINK_GLDCTL2);
+
+        Cdd_Pwm_GlobalLoadGroup.member[Channels[idx]] = TRUE;
+    }
+    Cdd_Pwm_GlobalLoadGroup.numChannels = NumChannels;
+}
+
+void Cdd_Pwm_GlobalLoadStage_Private(const Cdd_Pwm_GlobalLoadStageType *Stage)
+{
+    uint32 baseAddr = Cdd_Pwm_ChObj[Stage->ChannelNumber].baseaddr;
+    uint16 mask     = Stage->UpdateMask;
+
+    if ((mask & CDD_PWM_GL_UPDATE_PERIOD) != 0U)
+    {
+        EPWM_setTimeBasePeriod(baseAddr, Stage->Period);
+    }
+    if ((mask & CDD_PWM_GL_UPDATE_CMPA) != 0U)
+    {
+        EPWM_setCounterCompareValue(baseAddr, EPWM_COUNTER_COMPARE_A, Stage->CmpA);
+    }
+    if ((mask & CDD_PWM_GL_UPDATE_CMPB) != 0U)
+    {
+        EPWM_setCounterCompareValue(baseAddr, EPWM_COUNTER_COMPARE_B, Stage->CmpB);
+    }
+    if ((mask & CDD_PWM_GL_UPDATE_PHASE) != 0U)
+    {
+        EPWM_setPhaseShift(baseAddr, Stage->Phase);
+    }
+    if ((mask & CDD_PWM_GL_UPDATE_RED) != 0U)
+    {
+        EPWM_setRisingEdgeDelayCount(baseAddr, Stage->RisingEdgeDelay);
+    }
+    if ((mask & CDD_PWM_GL_UPDATE_FED) != 0U)
+    {
+        EPWM_setFallingEdgeDelayCount(baseAddr, Stage->FallingEdgeDelay);
+    }
+}
+#endif /*#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)*/
+
 #define CDD_PWM_STOP_SEC_CODE
 #include "Cdd_Pwm_MemMap.h"
 
@@ -94,13 +94,40 @@ extern "C" {
 
 /** \brief Max Duty Cycle. */
 #define CDD_PWM_CFG_DUTYCYCLE_MAX (CDD_PWM_DUTYCYCLE_MAX)
+
+/** \brief EPWM instance number (EPWMxLINK value) of an EPWM base address of any
+ *  of the CONTROLSS groups, instances are 4KB apart */
+#define CDD_PWM_EPWM_INSTANCE(baseAddr) ((EPWM_CurrentLink)(((baseAddr) >> 12U) & 0x1FU))
+
+/** \brief Registers loaded by the global load update */
+#define CDD_PWM_GL_UPDATE_REGISTERS                                                                      \
+    ((uint16)(EPWM_GL_REGISTER_TBPRD_TBPRDHR | EPWM_GL_REGISTER_CMPA_CMPAHR | EPWM_GL_REGISTER_CMPB_CMPBHR | \
+              EPWM_GL_REGISTER_DBRED_DBREDHR | EPWM_GL_REGISTER_DBFED_DBFEDHR))
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
 
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+/** \brief State of the global load channel group */
+typedef struct Cdd_Pwm_GlobalLoadGroupType_s
+{
+    uint32  masterBaseAddr;
+    /**< Base address of the EPWM all GLDCTL2 writes are linked to */
+    uint8   numChannels;
+    /**< Number of channels in the group, 0 if no group is set up */
+    boolean updateOpen;
+    /**< TRUE between Cdd_Pwm_GlobalLoadBegin and Cdd_Pwm_GlobalLoadCommit */
+    boolean member[CDD_PWM_MAX_NUM_CHANNELS];
+    /**< TRUE for every channel of the group */
+} Cdd_Pwm_GlobalLoadGroupType;
+#endif /*#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)*/
+
 /* ========================================================================== */
 /*                         GLOBAL VARIABLES                                   */
 /* ========================================================================== */
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+extern VAR(Cdd_Pwm_GlobalLoadGroupType, CDD_PWM_VAR_NO_INIT) Cdd_Pwm_GlobalLoadGroup;
+#endif
 
 /* ========================================================================== */
 /*                          Function Declarations                             */
@@ -220,6 +247,13 @@ void Cdd_Pwm_InitSfoCalStatus(void);
 #endif /* #if (STD_ON == CDD_PWM_HR_SFO_STATUS_API) */
 
 void Cdd_Pwm_HighResPwm(Cdd_Pwm_ChannelType ChannelNumber);
+
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+void Cdd_Pwm_GlobalLoadReset(void);
+void Cdd_Pwm_GlobalLoadSetup_Private(const Cdd_Pwm_ChannelType *Channels, uint8 NumChannels,
+                                     EPWM_GlobalLoadTrigger Trigger);
+void Cdd_Pwm_GlobalLoadStage_Private(const Cdd_Pwm_GlobalLoadStageType *Stage);
+#endif /*#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)*/
 #ifdef __cplusplus
 }
 #endif
@@ -1608,6 +1608,40 @@ typedef struct Cdd_Pwm_channelParametertype_s
     /*!<   PWM Channel Output . */
 } Cdd_Pwm_channelParametertype;
 
+/** \brief Stage the time base period (TBPRD) */
+#define CDD_PWM_GL_UPDATE_PERIOD ((uint16)0x01U)
+/** \brief Stage counter compare A (CMPA) */
+#define CDD_PWM_GL_UPDATE_CMPA ((uint16)0x02U)
+/** \brief Stage counter compare B (CMPB) */
+#define CDD_PWM_GL_UPDATE_CMPB ((uint16)0x04U)
+/** \brief Stage the phase shift (TBPHS) */
+#define CDD_PWM_GL_UPDATE_PHASE ((uint16)0x08U)
+/** \brief Stage the rising edge delay (DBRED) */
+#define CDD_PWM_GL_UPDATE_RED ((uint16)0x10U)
+/** \brief Stage the falling edge delay (DBFED) */
+#define CDD_PWM_GL_UPDATE_FED ((uint16)0x20U)
+
+/*!< Values of one channel staged for a synchronized global load update. */
+typedef struct Cdd_Pwm_GlobalLoadStageType_s
+{
+    Cdd_Pwm_ChannelType ChannelNumber;
+    /*!<   PWM Channel Number.  */
+    uint16              UpdateMask;
+    /*!<   Fields to be staged, OR of CDD_PWM_GL_UPDATE_xxx.  */
+    uint16              Period;
+    /*!<   Time base period count.  */
+    uint16              CmpA;
+    /*!<   Counter compare A count.  */
+    uint16              CmpB;
+    /*!<   Counter compare B count.  */
+    uint16              Phase;
+    /*!<   Phase shift count.  */
+    uint16              RisingEdgeDelay;
+    /*!<   Dead band rising edge delay count.  */
+    uint16              FallingEdgeDelay;
+    /*!<   Dead band falling edge delay count.  */
+} Cdd_Pwm_GlobalLoadStageType;
+
 /*!<   Timer Base of Structure.  */
 /*
  *Design: MCAL-23850
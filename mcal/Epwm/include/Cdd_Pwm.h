@@ -313,6 +313,14 @@ extern "C" {
 #define CDD_PWM_SID_SET_XMINMAP_REG_VALUE ((uint8)(0x32U))
 /** \brief CDD_PWM driver service ID to set the CMP shadow reg value in runtime */
 #define CDD_PWM_SID_SET_CMP_SHADOW_REG_VALUE ((uint8)(0x33U))
+/** \brief CDD_PWM driver service ID to set up the global load channel group */
+#define CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP ((uint8)(0x34U))
+/** \brief CDD_PWM driver service ID to open a global load update */
+#define CDD_PWM_SID_GLOBAL_LOAD_BEGIN ((uint8)(0x35U))
+/** \brief CDD_PWM driver service ID to stage the shadow values of one channel */
+#define CDD_PWM_SID_GLOBAL_LOAD_STAGE ((uint8)(0x36U))
+/** \brief CDD_PWM driver service ID to commit a global load update */
+#define CDD_PWM_SID_GLOBAL_LOAD_COMMIT ((uint8)(0x37U))
 
 /**   @} */
 
@@ -1075,6 +1083,92 @@ Cdd_Pwm_SetXMinMaxRegValue(Cdd_Pwm_ChannelType Channel, EPWM_XMinMaxReg XminmaxR
 FUNC(void, CDD_PWM_CODE)
 Cdd_Pwm_SetCmpShadowRegValue(Cdd_Pwm_ChannelType Channel, EPWM_XCompareReg CmpReg, uint16 CmpValue);
 
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+/*========================================================================================================*/
+/** \brief  Function to set up a group of channels for synchronized updates.
+ *
+ *
+ * Cdd_Pwm_GlobalLoadGroupSetup switches TBPRD, CMPA, CMPB, DBRED and DBFED of
+ * every channel in the group to one shot global shadow load on the given
+ * trigger and links GLDCTL2 of all channels to the first channel of the group.
+ * Must be called once before Cdd_Pwm_GlobalLoadBegin and not while an update
+ * is open.
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Non-Reentrant
+ *
+ * \param[in] Channels - Array of channels, the first one is the group master
+ * \param[in] NumChannels - Number of channels in the array
+ * \param[in] Trigger - Global load pulse source. Refer \e loadTrigger parameter
+ *
+ * \return Std_ReturnType
+ * \retval E_OK - Operation successful
+ * \retval E_NOT_OK - Operation failed
+ *
+ *********************************************************************************************************/
+FUNC(Std_ReturnType, CDD_PWM_CODE)
+Cdd_Pwm_GlobalLoadGroupSetup(P2CONST(Cdd_Pwm_ChannelType, AUTOMATIC, CDD_PWM_APPL_DATA) Channels, uint8 NumChannels,
+                             EPWM_GlobalLoadTrigger Trigger);
+
+/*========================================================================================================*/
+/** \brief  Function to open a synchronized update of the channel group.
+ *
+ *
+ * Cdd_Pwm_GlobalLoadBegin opens an update. Values staged afterwards stay in
+ * the shadow registers until Cdd_Pwm_GlobalLoadCommit is called.
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Non-Reentrant
+ *
+ * \return Std_ReturnType
+ * \retval E_OK - Operation successful
+ * \retval E_NOT_OK - No group set up or an update is already open
+ *
+ *********************************************************************************************************/
+FUNC(Std_ReturnType, CDD_PWM_CODE) Cdd_Pwm_GlobalLoadBegin(void);
+
+/*========================================================================================================*/
+/** \brief  Function to stage the new values of one channel of the group.
+ *
+ *
+ * Cdd_Pwm_GlobalLoadStage writes the fields selected by UpdateMask straight
+ * into the shadow registers of the channel. The phase value is applied by the
+ * next sync input of the channel.
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Non-Reentrant
+ *
+ * \param[in] Stage - Channel and values to be staged
+ *
+ * \return void
+ *
+ *********************************************************************************************************/
+FUNC(void, CDD_PWM_CODE)
+Cdd_Pwm_GlobalLoadStage(P2CONST(Cdd_Pwm_GlobalLoadStageType, AUTOMATIC, CDD_PWM_APPL_DATA) Stage);
+
+/*========================================================================================================*/
+/** \brief  Function to commit the staged values of the channel group.
+ *
+ *
+ * Cdd_Pwm_GlobalLoadCommit arms the one shot global load of the group master.
+ * Through the GLDCTL2 link every channel of the group copies its shadow
+ * registers to the active registers on the same global load event.
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Non-Reentrant
+ *
+ * \return Std_ReturnType
+ * \retval E_OK - Operation successful
+ * \retval E_NOT_OK - No update is open
+ *
+ *********************************************************************************************************/
+FUNC(Std_ReturnType, CDD_PWM_CODE) Cdd_Pwm_GlobalLoadCommit(void);
+#endif /*#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)*/
+
 #if (STD_ON == CDD_PWM_TRIP_ZONE)
 /*===============================================================================================*/
 /** \brief  Function enables the trip event.
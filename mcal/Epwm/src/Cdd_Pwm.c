@@ -136,6 +136,10 @@ VAR(uint32, CDD_PWM_VAR_NO_INIT) Cdd_Pwm_ChannelSfoStatus[CDD_PWM_MAX_NUM_CHANNE
 #include "Cdd_Pwm_MemMap.h"
 /** \brief CDD_PWM driver object. */
 VAR(Cdd_Pwm_ChObjType, CDD_PWM_VAR_NO_INIT) Cdd_Pwm_ChObj[CDD_PWM_HW_MAX_NUM_CHANNELS];
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+/** \brief CDD_PWM global load channel group. */
+VAR(Cdd_Pwm_GlobalLoadGroupType, CDD_PWM_VAR_NO_INIT) Cdd_Pwm_GlobalLoadGroup;
+#endif
 #define CDD_PWM_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "Cdd_Pwm_MemMap.h"
 
@@ -212,6 +216,9 @@ Cdd_Pwm_Init(P2CONST(Cdd_Pwm_ConfigType, AUTOMATIC, CDD_PWM_PBCFG) ConfigPtr)
 #endif /*(STD_ON == CDD_PWM_DEV_ERROR_DETECT) */
     {
         Cdd_Pwm_InitIsr(CfgPtr);
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+        Cdd_Pwm_GlobalLoadReset();
+#endif
         Cdd_Pwm_DrvStatus = CDD_PWM_STATUS_INIT;
     }
     return;
@@ -295,6 +302,9 @@ FUNC(void, CDD_PWM_CODE) Cdd_Pwm_DeInit(void)
             }
         }
 
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+        Cdd_Pwm_GlobalLoadReset();
+#endif
         /* Set driver status  to uninitialized */
         Cdd_Pwm_DrvStatus = CDD_PWM_STATUS_UNINIT;
     }
@@ -1104,6 +1114,148 @@ Cdd_Pwm_SetCmpShadowRegValue(Cdd_Pwm_ChannelType Channel, EPWM_XCompareReg CmpRe
     return;
 }
 
+#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)
+FUNC(Std_ReturnType, CDD_PWM_CODE)
+Cdd_Pwm_GlobalLoadGroupSetup(P2CONST(Cdd_Pwm_ChannelType, AUTOMATIC, CDD_PWM_APPL_DATA) Channels, uint8 NumChannels,
+                             EPWM_GlobalLoadTrigger Trigger)
+{
+    Std_ReturnType returnValue = E_OK;
+
+#if (STD_ON == CDD_PWM_DEV_ERROR_DETECT)
+    uint32 idx;
+
+    if (E_OK != Cdd_Pwm_Validate_Init(CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP))
+    {
+        returnValue = E_NOT_OK;
+    }
+    else if (NULL_PTR == Channels)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP, CDD_PWM_E_PARAM_POINTER);
+        returnValue = E_NOT_OK;
+    }
+    else if ((0U == NumChannels) || (NumChannels > CDD_PWM_MAX_NUM_CHANNELS))
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP, CDD_PWM_E_PARAM_CHANNEL);
+        returnValue = E_NOT_OK;
+    }
+    else if (TRUE == Cdd_Pwm_GlobalLoadGroup.updateOpen)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP, CDD_PWM_E_BUSY);
+        returnValue = E_NOT_OK;
+    }
+    else
+    {
+        for (idx = 0U; idx < NumChannels; idx++)
+        {
+            if (Channels[idx] >= CDD_PWM_MAX_NUM_CHANNELS)
+            {
+                (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_GROUP_SETUP, CDD_PWM_E_PARAM_INVALID_CHANNEL);
+                returnValue = E_NOT_OK;
+                break;
+            }
+        }
+    }
+#endif /* (STD_ON == CDD_PWM_DEV_ERROR_DETECT) */
+
+    if (E_OK == returnValue)
+    {
+        /* Enter Critical Section. */
+        SchM_Enter_Cdd_Pwm_PWM_EXCLUSIVE_AREA_0();
+
+        Cdd_Pwm_GlobalLoadSetup_Private(Channels, NumChannels, Trigger);
+
+        /* Exit Critical Section. */
+        SchM_Exit_Cdd_Pwm_PWM_EXCLUSIVE_AREA_0();
+    }
+
+    return (returnValue);
+}
+
+FUNC(Std_ReturnType, CDD_PWM_CODE) Cdd_Pwm_GlobalLoadBegin(void)
+{
+    Std_ReturnType returnValue = E_OK;
+
+#if (STD_ON == CDD_PWM_DEV_ERROR_DETECT)
+    if (E_OK != Cdd_Pwm_Validate_Init(CDD_PWM_SID_GLOBAL_LOAD_BEGIN))
+    {
+        returnValue = E_NOT_OK;
+    }
+    else if (0U == Cdd_Pwm_GlobalLoadGroup.numChannels)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_BEGIN, CDD_PWM_E_PARAM_INVALID_STATE);
+        returnValue = E_NOT_OK;
+    }
+    else if (TRUE == Cdd_Pwm_GlobalLoadGroup.updateOpen)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_BEGIN, CDD_PWM_E_BUSY);
+        returnValue = E_NOT_OK;
+    }
+    else
+#endif /* (STD_ON == CDD_PWM_DEV_ERROR_DETECT) */
+    {
+        Cdd_Pwm_GlobalLoadGroup.updateOpen = TRUE;
+    }
+
+    return (returnValue);
+}
+
+FUNC(void, CDD_PWM_CODE)
+Cdd_Pwm_GlobalLoadStage(P2CONST(Cdd_Pwm_GlobalLoadStageType, AUTOMATIC, CDD_PWM_APPL_DATA) Stage)
+{
+#if (STD_ON == CDD_PWM_DEV_ERROR_DETECT)
+    if (E_OK != Cdd_Pwm_Validate_Init(CDD_PWM_SID_GLOBAL_LOAD_STAGE))
+    {
+        /* Do nothing */
+    }
+    else if (NULL_PTR == Stage)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_STAGE, CDD_PWM_E_PARAM_POINTER);
+    }
+    else if (TRUE != Cdd_Pwm_GlobalLoadGroup.updateOpen)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_STAGE, CDD_PWM_E_PARAM_INVALID_STATE);
+    }
+    else if ((Stage->ChannelNumber >= CDD_PWM_MAX_NUM_CHANNELS) ||
+             (TRUE != Cdd_Pwm_GlobalLoadGroup.member[Stage->ChannelNumber]))
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_STAGE, CDD_PWM_E_PARAM_INVALID_CHANNEL);
+    }
+    else
+#endif /* (STD_ON == CDD_PWM_DEV_ERROR_DETECT) */
+    {
+        /* Shadow registers only, nothing reaches the outputs before the commit */
+        Cdd_Pwm_GlobalLoadStage_Private(Stage);
+    }
+
+    return;
+}
+
+FUNC(Std_ReturnType, CDD_PWM_CODE) Cdd_Pwm_GlobalLoadCommit(void)
+{
+    Std_ReturnType returnValue = E_OK;
+
+#if (STD_ON == CDD_PWM_DEV_ERROR_DETECT)
+    if (E_OK != Cdd_Pwm_Validate_Init(CDD_PWM_SID_GLOBAL_LOAD_COMMIT))
+    {
+        returnValue = E_NOT_OK;
+    }
+    else if (TRUE != Cdd_Pwm_GlobalLoadGroup.updateOpen)
+    {
+        (void)Cdd_Pwm_reportDetError(CDD_PWM_SID_GLOBAL_LOAD_COMMIT, CDD_PWM_E_PARAM_INVALID_STATE);
+        returnValue = E_NOT_OK;
+    }
+    else
+#endif /* (STD_ON == CDD_PWM_DEV_ERROR_DETECT) */
+    {
+        /* One write, mirrored to GLDCTL2 of every linked channel */
+        EPWM_setGlobalLoadOneShotLatch(Cdd_Pwm_GlobalLoadGroup.masterBaseAddr);
+        Cdd_Pwm_GlobalLoadGroup.updateOpen = FALSE;
+    }
+
+    return (returnValue);
+}
+#endif /*#if (STD_ON == CDD_PWM_GLOBAL_LOAD_UPDATE_API)*/
+
 /*===============================================================================================*/
 /*
  *Design: MCAL-23424, MCAL-23425
@@ -0,0 +1,261 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2022 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     Gpt_Monotonic.c
+ *
+ *  \brief    64-bit monotonic time base on one GPT channel
+ *
+ *  The free running counter of the channel's counter block gives the lower
+ *  32 bits. The channel runs in continuous mode with a period of half the
+ *  counter range and its ISR folds the counter into a 64-bit base. Readers
+ *  add the counter distance from the base, which is below 2^32 as long as
+ *  the ISR is not delayed by more than half a counter period. The base is
+ *  published with a sequence count, readers retry instead of locking.
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include "Std_Types.h"
+#include "Gpt.h"
+#include "Gpt_Irq.h"
+#include "Gpt_Priv.h"
+#include "SchM_Gpt.h"
+
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Base update period, half the counter range */
+#define GPT_MONOTONIC_PERIOD (0x80000000U)
+/** \brief Nanoseconds per second */
+#define GPT_MONOTONIC_NS_PER_S (1000000000U)
+/** \brief Microseconds per second */
+#define GPT_MONOTONIC_US_PER_S (1000000U)
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+extern VAR(Gpt_ChannelStateType, GPT_DATA) Gpt_ChannelState[GPT_RTI_MAX];
+extern P2CONST(Gpt_ConfigType, GPT_DATA, GPT_PBCFG) Gpt_Config_pt;
+extern VAR(uint16, GPT_DATA) Gpt_ChConfig_map[GPT_RTI_MAX];
+extern VAR(uint32, GPT_DATA) Gpt_ChStartTime_map[GPT_RTI_MAX];
+
+#define GPT_START_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Gpt_MemMap.h"
+/** \brief Monotonic time base object */
+static VAR(Gpt_MonotonicObjType, GPT_VAR_CLEARED) Gpt_MonotonicObj;
+#define GPT_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Gpt_MemMap.h"
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static void   Gpt_MonotonicSetScale(Gpt_MonotonicScaleType *scale, uint32 unitsPerSec, uint32 tickHz);
+static uint64 Gpt_MonotonicScale(const Gpt_MonotonicScaleType *scale, uint64 ticks);
+
+/* ========================================================================== */
+/*                          Function Definitions                             */
+/* ========================================================================== */
+
+#define GPT_START_SEC_CODE
+/*LDRA_INSPECTED 338 S : MISRAC_2012_R.20.1
+ * "Reason - Required to comply with AUTOSAR memmap spec " */
+#include "Gpt_MemMap.h"
+
+void Gpt_MonotonicInit(void)
+{
+    uint32 Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_MONOTONIC_CHANNEL);
+    uint32 prescale = Gpt_Config_pt->ChannelConfig_pt[Gpt_ChConfig_map[GPT_MONOTONIC_CHANNEL]].GptChannelTickFrequency;
+    uint32 tickHz;
+
+    /* Gpt_RTI_StartTimer programs a zero prescaler as 1 */
+    if (prescale == 0U)
+    {
+        prescale = 1U;
+    }
+    tickHz = GPT_MONOTONIC_CLOCK_HZ / (prescale + 1U);
+
+    /* Conversion factors are computed once, the hot path only multiplies */
+    Gpt_MonotonicObj.TickHz = tickHz;
+    Gpt_MonotonicSetScale(&Gpt_MonotonicObj.NsScale, GPT_MONOTONIC_NS_PER_S, tickHz);
+    Gpt_MonotonicSetScale(&Gpt_MonotonicObj.UsScale, GPT_MONOTONIC_US_PER_S, tickHz);
+
+    Gpt_IsrIndex[GPT_MONOTONIC_CHANNEL] = GPT_CH_ISR_MODE_MONOTONIC;
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    Gpt_RTI_StartTimer((rtiBASE_t *)Gpt_rtiChAddr, GPT_MONOTONIC_CHANNEL, prescale, GPT_CH_MODE_CONTINUOUS,
+                       GPT_MONOTONIC_PERIOD);
+
+    Gpt_MonotonicObj.Seq         = 0U;
+    Gpt_MonotonicObj.BaseTicks   = 0U;
+    Gpt_MonotonicObj.BaseCounter = Gpt_ChStartTime_map[GPT_MONOTONIC_CHANNEL];
+
+    Gpt_RTI_EnableNotification((rtiBASE_t *)Gpt_rtiChAddr, GPT_MONOTONIC_CHANNEL);
+    /* Running - Gpt_StartTimer() on the time base channel reports GPT_E_BUSY */
+    Gpt_ChannelState[GPT_MONOTONIC_CHANNEL] = GPT_RUNNING;
+}
+
+void Gpt_MonotonicDeInit(void)
+{
+    uint32 Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_MONOTONIC_CHANNEL);
+
+    Gpt_ChannelState[GPT_MONOTONIC_CHANNEL] = GPT_STOPPED;
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    Gpt_RTI_DisableNotification((rtiBASE_t *)Gpt_rtiChAddr, GPT_MONOTONIC_CHANNEL);
+    Gpt_RTI_StopTimer((rtiBASE_t *)Gpt_rtiChAddr, GPT_MONOTONIC_CHANNEL);
+}
+
+uint64 Gpt_MonotonicGetTicks(void)
+{
+    Gpt_ValueType UpdCompare = 0U;
+    Gpt_ValueType Compare    = 0U;
+    uint32        Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_MONOTONIC_CHANNEL);
+    uint32        seqStart, seqEnd, baseCounter, counter;
+    uint64        baseTicks;
+
+    /* Retry when the ISR published a new base in between, an odd count is an
+     * update in progress */
+    do
+    {
+        seqStart    = Gpt_MonotonicObj.Seq;
+        baseTicks   = Gpt_MonotonicObj.BaseTicks;
+        baseCounter = Gpt_MonotonicObj.BaseCounter;
+        /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+         * "Reason - Cast for register address " */
+        counter = Gpt_GetCounter_Values((rtiBASE_t *)Gpt_rtiChAddr, GPT_MONOTONIC_CHANNEL, &UpdCompare, &Compare);
+        seqEnd  = Gpt_MonotonicObj.Seq;
+    } while ((seqStart != seqEnd) || ((seqStart & 1U) != 0U));
+
+    return (baseTicks + (uint64)(counter - baseCounter));
+}
+
+uint64 Gpt_MonotonicToNs(uint64 ticks)
+{
+    return Gpt_MonotonicScale(&Gpt_MonotonicObj.NsScale, ticks);
+}
+
+uint64 Gpt_MonotonicToUs(uint64 ticks)
+{
+    return Gpt_MonotonicScale(&Gpt_MonotonicObj.UsScale, ticks);
+}
+
+/* 32.32 fixed point units per tick, split in integer and fraction words */
+static void Gpt_MonotonicSetScale(Gpt_MonotonicScaleType *scale, uint32 unitsPerSec, uint32 tickHz)
+{
+    uint64 factor = ((uint64)unitsPerSec << 32U) / tickHz;
+
+    scale->Int  = (uint32)(factor >> 32U);
+    scale->Frac = (uint32)factor;
+}
+
+/* ticks * (Int + Frac / 2^32) without a 128-bit product */
+static uint64 Gpt_MonotonicScale(const Gpt_MonotonicScaleType *scale, uint64 ticks)
+{
+    uint32 ticksHi = (uint32)(ticks >> 32U);
+    uint32 ticksLo = (uint32)ticks;
+
+    return ((ticks * scale->Int) + ((uint64)ticksHi * scale->Frac) + (((uint64)ticksLo * scale->Frac) >> 32U));
+}
+
+#define GPT_STOP_SEC_CODE
+#include "Gpt_MemMap.h"
+
+#define GPT_START_SEC_ISR_CODE
+/*LDRA_INSPECTED 338 S : MISRAC_2012_R.20.1
+ * "Reason - Required to comply with AUTOSAR memmap spec " */
+#include "Gpt_MemMap.h"
+
+/***************************************************************************************************************
+    Function name:  Gpt_MonotonicIsr
+ ***************************************************************************************************************/
+/*  \Description: Compare interrupt of the time base channel, every half counter period. Folds the
+ *                counter distance into the 64-bit base and publishes it to the readers.
+ *  \param[in]:  ChannelID
+ *  \return:     None
+ *  \context:    Called by ISR.
+ *****************************************************************************************************************/
+FUNC(void, GPT_CODE) Gpt_MonotonicIsr(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType UpdCompare    = 0U;
+    Gpt_ValueType Compare       = 0U;
+    uint32        Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(Channel);
+    uint32        counter;
+
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    Gpt_RTINotifyContIsr((rtiBASE_t *)Gpt_rtiChAddr, Channel);
+
+    /* Readers preempting the update would spin on the odd count - block them */
+    SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+    Gpt_MonotonicObj.Seq++;
+    counter = Gpt_GetCounter_Values((rtiBASE_t *)Gpt_rtiChAddr, Channel, &UpdCompare, &Compare);
+    Gpt_MonotonicObj.BaseTicks += (uint64)(counter - Gpt_MonotonicObj.BaseCounter);
+    Gpt_MonotonicObj.BaseCounter = counter;
+    Gpt_MonotonicObj.Seq++;
+    SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+}
+
+#define GPT_STOP_SEC_ISR_CODE
+#include "Gpt_MemMap.h"
+
+#endif /* #if (STD_ON == GPT_MONOTONIC_TIME_API) */
@@ -86,6 +86,21 @@ CONST(Gpt_IsrRefType, GPT_CONST)
 Gpt_IsrNotifyFunctions[CHANNEL_MODES] = {
     Gpt_NotifContIsr,
     Gpt_NotifSingleIsr,
+#if ((STD_ON == GPT_TIMER_WHEEL_API) || (STD_ON == GPT_MONOTONIC_TIME_API))
+    /* Wakeup modes are not supported and use the normal mode ISRs */
+    Gpt_NotifContIsr,
+    Gpt_NotifSingleIsr,
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+    Gpt_WheelIsr,
+#else
+    Gpt_NotifContIsr,
+#endif
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+    Gpt_MonotonicIsr,
+#else
+    Gpt_NotifContIsr,
+#endif
+#endif
 };
 #define GPT_STOP_SEC_CONST_32
 /*LDRA_INSPECTED 338 S : MISRAC_2012_R.20.1
@@ -86,10 +86,87 @@ extern "C" {
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+/** \brief Number of timer wheel levels */
+#define GPT_WHEEL_LEVELS (4U)
+/** \brief Number of slots per timer wheel level */
+#define GPT_WHEEL_SLOTS (32U)
+/** \brief End of a timer wheel slot list */
+#define GPT_WHEEL_TIMER_INVALID ((Gpt_WheelTimerType)0xFFFFU)
+#endif
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+/** \brief Logical timer of the timer wheel */
+typedef struct
+{
+    /** \brief Expiry callback */
+    Gpt_WheelNotifyType Notification;
+    /** \brief Absolute expiry in wheel time units */
+    uint32              Expiry;
+    /** \brief Next timer in the slot list */
+    Gpt_WheelTimerType  Next;
+    /** \brief Previous timer in the slot list */
+    Gpt_WheelTimerType  Prev;
+    /** \brief Slot index, level * GPT_WHEEL_SLOTS + slot */
+    uint8               Slot;
+    /** \brief TRUE while the timer is queued */
+    boolean             IsActive;
+} Gpt_WheelTimerObjType;
+
+/** \brief Timer wheel object */
+typedef struct
+{
+    /** \brief Logical timers */
+    Gpt_WheelTimerObjType Timer[GPT_TIMER_WHEEL_NUM_TIMERS];
+    /** \brief Head of each slot list */
+    Gpt_WheelTimerType    SlotHead[GPT_WHEEL_LEVELS * GPT_WHEEL_SLOTS];
+    /** \brief Occupied slots of each level */
+    uint32                SlotBitmap[GPT_WHEEL_LEVELS];
+    /** \brief Wheel time in units of GPT_TIMER_WHEEL_RESOLUTION */
+    uint32                Now;
+    /** \brief Channel free running counter matching Now */
+    uint32                NowTicks;
+    /** \brief Number of queued timers */
+    uint32                ActiveCount;
+    /** \brief TRUE while the channel runs for the wheel */
+    boolean               IsRunning;
+    /** \brief TRUE while the ISR processes expiries */
+    boolean               InIsr;
+} Gpt_WheelObjType;
+#endif
+
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+/** \brief 32.32 fixed point conversion factor */
+typedef struct
+{
+    /** \brief Integer part */
+    uint32 Int;
+    /** \brief Fraction in units of 2^-32 */
+    uint32 Frac;
+} Gpt_MonotonicScaleType;
+
+/** \brief Monotonic time base object */
+typedef struct
+{
+    /** \brief Odd while the ISR updates the base */
+    volatile uint32        Seq;
+    /** \brief 64-bit time at BaseCounter */
+    volatile uint64        BaseTicks;
+    /** \brief Free running counter at the last base update */
+    volatile uint32        BaseCounter;
+    /** \brief Counter frequency in Hz */
+    uint32                 TickHz;
+    /** \brief Ticks to nanoseconds */
+    Gpt_MonotonicScaleType NsScale;
+    /** \brief Ticks to microseconds */
+    Gpt_MonotonicScaleType UsScale;
+} Gpt_MonotonicObjType;
+#endif
+
 /* ========================================================================== */
 /*                          Function Declarations                             */
 /* ========================================================================== */
@@ -119,6 +196,24 @@ void Gpt_RegReadBack(const rtiBASE_t *rtireg, GptConfigReg *GptRegConf);
 
 uint32 Mod_Difference(uint32 valueA, uint32 valueB);
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+void Gpt_WheelInit(void);
+Std_ReturnType Gpt_WheelStart(Gpt_WheelTimerType timer, Gpt_ValueType value, Gpt_WheelNotifyType notifyFn);
+void Gpt_WheelStop(Gpt_WheelTimerType timer);
+/** \brief Timer wheel channel ISR */
+FUNC(void, GPT_CODE) Gpt_WheelIsr(Gpt_ChannelType Channel);
+#endif
+
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+void   Gpt_MonotonicInit(void);
+void   Gpt_MonotonicDeInit(void);
+uint64 Gpt_MonotonicGetTicks(void);
+uint64 Gpt_MonotonicToNs(uint64 ticks);
+uint64 Gpt_MonotonicToUs(uint64 ticks);
+/** \brief Monotonic time base channel ISR */
+FUNC(void, GPT_CODE) Gpt_MonotonicIsr(Gpt_ChannelType Channel);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
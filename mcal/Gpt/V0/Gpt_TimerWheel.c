@@ -0,0 +1,572 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2022 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     Gpt_TimerWheel.c
+ *
+ *  \brief    Software timer wheel multiplexing logical timers on one GPT channel
+ *
+ *  The wheel has GPT_WHEEL_LEVELS levels of GPT_WHEEL_SLOTS slots. A timer
+ *  is kept in the level covering its distance to the wheel time and moves
+ *  down a level (cascade) when the wheel time reaches the start of its slot.
+ *  Start, stop and expiry are list operations on one slot. The channel runs
+ *  in one-shot mode and its compare is programmed to the next occupied slot
+ *  start, so there is no periodic tick.
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include "Std_Types.h"
+#include "Gpt.h"
+#include "Gpt_Irq.h"
+#include "Gpt_Priv.h"
+#if defined(__ARM_FEATURE_CLZ)
+/*LDRA_NOANALYSIS*/
+#include <arm_acle.h>
+/*LDRA_ANALYSIS*/
+#endif
+
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Slot index bits of one wheel level */
+#define GPT_WHEEL_SLOT_BITS (5U)
+/** \brief Mask of the slot index of one wheel level */
+#define GPT_WHEEL_SLOT_MASK (GPT_WHEEL_SLOTS - 1U)
+/** \brief Returned by Gpt_WheelNextEvent when the wheel is empty */
+#define GPT_WHEEL_NO_EVENT (0xFFFFFFFFU)
+/** \brief Longest compare distance, keeps the counter difference unambiguous */
+#define GPT_WHEEL_MAX_ARM_TICKS (0x7FFFFFFFU)
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+extern VAR(Gpt_ChannelStateType, GPT_DATA) Gpt_ChannelState[GPT_RTI_MAX];
+extern P2CONST(Gpt_ConfigType, GPT_DATA, GPT_PBCFG) Gpt_Config_pt;
+extern VAR(uint16, GPT_DATA) Gpt_ChConfig_map[GPT_RTI_MAX];
+extern VAR(uint32, GPT_DATA) Gpt_ChStartTime_map[GPT_RTI_MAX];
+
+#define GPT_START_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Gpt_MemMap.h"
+/** \brief Timer wheel object */
+static VAR(Gpt_WheelObjType, GPT_VAR_CLEARED) Gpt_WheelObj;
+#define GPT_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Gpt_MemMap.h"
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static uint32 Gpt_WheelFindLsb(uint32 value);
+static uint32 Gpt_WheelReadCounter(void);
+static void   Gpt_WheelInsert(Gpt_WheelObjType *wheel, Gpt_WheelTimerType timer);
+static void   Gpt_WheelRemove(Gpt_WheelObjType *wheel, Gpt_WheelTimerType timer);
+static uint32 Gpt_WheelNextEvent(const Gpt_WheelObjType *wheel);
+static void   Gpt_WheelCascade(Gpt_WheelObjType *wheel);
+static void   Gpt_WheelExpire(Gpt_WheelObjType *wheel);
+static void   Gpt_WheelAdvance(Gpt_WheelObjType *wheel);
+static void   Gpt_WheelProgram(Gpt_WheelObjType *wheel);
+static Std_ReturnType Gpt_WheelHwStart(Gpt_WheelObjType *wheel);
+static void   Gpt_WheelHwStop(Gpt_WheelObjType *wheel);
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+#define GPT_START_SEC_CODE
+/*LDRA_INSPECTED 338 S : MISRAC_2012_R.20.1
+ * "Reason - Required to comply with AUTOSAR memmap spec " */
+#include "Gpt_MemMap.h"
+
+void Gpt_WheelInit(void)
+{
+    uint32 idx;
+
+    for (idx = 0U; idx < GPT_TIMER_WHEEL_NUM_TIMERS; idx++)
+    {
+        Gpt_WheelObj.Timer[idx].Notification = (Gpt_WheelNotifyType)NULL_PTR;
+        Gpt_WheelObj.Timer[idx].Expiry       = 0U;
+        Gpt_WheelObj.Timer[idx].Next         = GPT_WHEEL_TIMER_INVALID;
+        Gpt_WheelObj.Timer[idx].Prev         = GPT_WHEEL_TIMER_INVALID;
+        Gpt_WheelObj.Timer[idx].Slot         = 0U;
+        Gpt_WheelObj.Timer[idx].IsActive     = FALSE;
+    }
+    for (idx = 0U; idx < (GPT_WHEEL_LEVELS * GPT_WHEEL_SLOTS); idx++)
+    {
+        Gpt_WheelObj.SlotHead[idx] = GPT_WHEEL_TIMER_INVALID;
+    }
+    for (idx = 0U; idx < GPT_WHEEL_LEVELS; idx++)
+    {
+        Gpt_WheelObj.SlotBitmap[idx] = 0U;
+    }
+    Gpt_WheelObj.Now         = 0U;
+    Gpt_WheelObj.NowTicks    = 0U;
+    Gpt_WheelObj.ActiveCount = 0U;
+    Gpt_WheelObj.IsRunning   = FALSE;
+    Gpt_WheelObj.InIsr       = FALSE;
+}
+
+Std_ReturnType Gpt_WheelStart(Gpt_WheelTimerType timer, Gpt_ValueType value, Gpt_WheelNotifyType notifyFn)
+{
+    Gpt_WheelObjType *wheel  = &Gpt_WheelObj;
+    Std_ReturnType    retVal = E_OK;
+    uint32            counter, elapsed, step, delta;
+
+    if (wheel->IsRunning == FALSE)
+    {
+        retVal = Gpt_WheelHwStart(wheel);
+    }
+
+    if (retVal == E_OK)
+    {
+        if (wheel->Timer[timer].IsActive == TRUE)
+        {
+            /* Restart - re-arm with the new timeout */
+            Gpt_WheelRemove(wheel, timer);
+            wheel->ActiveCount--;
+        }
+
+        /* Bring the wheel time up to the counter, short of the next occupied slot
+         * which is left to the ISR. Crossing empty slots needs no cascade. From a
+         * notification the ISR is still advancing and owns the wheel time. */
+        counter = Gpt_WheelReadCounter();
+        if (wheel->InIsr == FALSE)
+        {
+            elapsed = (counter - wheel->NowTicks) / GPT_TIMER_WHEEL_RESOLUTION;
+            step    = Gpt_WheelNextEvent(wheel);
+            if (step > elapsed)
+            {
+                step = elapsed + 1U;
+            }
+            wheel->Now      += step - 1U;
+            wheel->NowTicks += (step - 1U) * GPT_TIMER_WHEEL_RESOLUTION;
+        }
+
+        /* Remaining ticks round up, a timer never expires early */
+        delta = (counter - wheel->NowTicks) + (GPT_TIMER_WHEEL_RESOLUTION - 1U);
+        delta = (delta / GPT_TIMER_WHEEL_RESOLUTION) + value;
+        /* One full top level rotation is the last distance the slots resolve */
+        if (delta > (GPT_WHEEL_MAX_TIMEOUT + 1U))
+        {
+            delta = GPT_WHEEL_MAX_TIMEOUT + 1U;
+        }
+
+        wheel->Timer[timer].Notification = notifyFn;
+        wheel->Timer[timer].Expiry       = wheel->Now + delta;
+        wheel->Timer[timer].IsActive     = TRUE;
+        wheel->ActiveCount++;
+        Gpt_WheelInsert(wheel, timer);
+
+        /* Started from a notification - the ISR programs the compare on exit */
+        if (wheel->InIsr == FALSE)
+        {
+            Gpt_WheelProgram(wheel);
+        }
+    }
+
+    return (retVal);
+}
+
+void Gpt_WheelStop(Gpt_WheelTimerType timer)
+{
+    Gpt_WheelObjType *wheel = &Gpt_WheelObj;
+
+    if (wheel->Timer[timer].IsActive == TRUE)
+    {
+        Gpt_WheelRemove(wheel, timer);
+        wheel->Timer[timer].IsActive = FALSE;
+        wheel->ActiveCount--;
+
+        /* The compare is left armed, an early interrupt finds nothing to expire
+         * and re-arms - only an empty wheel stops the channel */
+        if ((wheel->ActiveCount == 0U) && (wheel->InIsr == FALSE))
+        {
+            Gpt_WheelHwStop(wheel);
+        }
+    }
+}
+
+/* Index of the least significant set bit, value must not be zero */
+static uint32 Gpt_WheelFindLsb(uint32 value)
+{
+#if defined(__ARM_FEATURE_CLZ)
+    return (31U - (uint32)__clz(value & (~value + 1U)));
+#else
+    uint32 lsb = 0U;
+    uint32 rem = value;
+
+    if (0U == (rem & 0xFFFFU))
+    {
+        rem >>= 16U;
+        lsb  += 16U;
+    }
+    if (0U == (rem & 0xFFU))
+    {
+        rem >>= 8U;
+        lsb  += 8U;
+    }
+    if (0U == (rem & 0xFU))
+    {
+        rem >>= 4U;
+        lsb  += 4U;
+    }
+    if (0U == (rem & 0x3U))
+    {
+        rem >>= 2U;
+        lsb  += 2U;
+    }
+    if (0U == (rem & 0x1U))
+    {
+        lsb += 1U;
+    }
+
+    return (lsb);
+#endif /* #if defined(__ARM_FEATURE_CLZ) */
+}
+
+static uint32 Gpt_WheelReadCounter(void)
+{
+    Gpt_ValueType UpdCompare = 0U;
+    Gpt_ValueType Compare    = 0U;
+    uint32        Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_TIMER_WHEEL_CHANNEL);
+
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    return Gpt_GetCounter_Values((rtiBASE_t *)Gpt_rtiChAddr, GPT_TIMER_WHEEL_CHANNEL, &UpdCompare, &Compare);
+}
+
+static void Gpt_WheelInsert(Gpt_WheelObjType *wheel, Gpt_WheelTimerType timer)
+{
+    uint32 delta = wheel->Timer[timer].Expiry - wheel->Now;
+    uint32 level = 0U;
+    uint32 slot;
+
+    /* Lowest level whose range covers the distance, a zero distance (cascade
+     * of a timer due now) lands in the current level 0 slot */
+    while ((level < (GPT_WHEEL_LEVELS - 1U)) && (delta >= ((uint32)1U << (GPT_WHEEL_SLOT_BITS * (level + 1U)))))
+    {
+        level++;
+    }
+    slot = (level * GPT_WHEEL_SLOTS) +
+           ((wheel->Timer[timer].Expiry >> (GPT_WHEEL_SLOT_BITS * level)) & GPT_WHEEL_SLOT_MASK);
+
+    wheel->Timer[timer].Slot = (uint8)slot;
+    wheel->Timer[timer].Prev = GPT_WHEEL_TIMER_INVALID;
+    wheel->Timer[timer].Next = wheel->SlotHead[slot];
+    if (wheel->SlotHead[slot] != GPT_WHEEL_TIMER_INVALID)
+    {
+        wheel->Timer[wheel->SlotHead[slot]].Prev = timer;
+    }
+    wheel->SlotHead[slot] = timer;
+    SET(uint32, wheel->SlotBitmap[level], (slot & GPT_WHEEL_SLOT_MASK));
+}
+
+static void Gpt_WheelRemove(Gpt_WheelObjType *wheel, Gpt_WheelTimerType timer)
+{
+    uint32             slot = (uint32)wheel->Timer[timer].Slot;
+    Gpt_WheelTimerType next = wheel->Timer[timer].Next;
+    Gpt_WheelTimerType prev = wheel->Timer[timer].Prev;
+
+    if (prev != GPT_WHEEL_TIMER_INVALID)
+    {
+        wheel->Timer[prev].Next = next;
+    }
+    else
+    {
+        wheel->SlotHead[slot] = next;
+    }
+    if (next != GPT_WHEEL_TIMER_INVALID)
+    {
+        wheel->Timer[next].Prev = prev;
+    }
+
+    if (wheel->SlotHead[slot] == GPT_WHEEL_TIMER_INVALID)
+    {
+        CLEAR(uint32, wheel->SlotBitmap[slot / GPT_WHEEL_SLOTS], (slot & GPT_WHEEL_SLOT_MASK));
+    }
+    wheel->Timer[timer].Next = GPT_WHEEL_TIMER_INVALID;
+    wheel->Timer[timer].Prev = GPT_WHEEL_TIMER_INVALID;
+}
+
+/* Units from Now to the start of the first occupied slot */
+static uint32 Gpt_WheelNextEvent(const Gpt_WheelObjType *wheel)
+{
+    uint32 nextEvent = GPT_WHEEL_NO_EVENT;
+    uint32 level, shift, rot, bitmap, dist, slotStart;
+
+    for (level = 0U; level < GPT_WHEEL_LEVELS; level++)
+    {
+        bitmap = wheel->SlotBitmap[level];
+        if (bitmap != 0U)
+        {
+            /* Slots after the current one come first, the current slot itself
+             * holds timers one full rotation ahead */
+            shift  = GPT_WHEEL_SLOT_BITS * level;
+            rot    = (((wheel->Now >> shift) & GPT_WHEEL_SLOT_MASK) + 1U) & GPT_WHEEL_SLOT_MASK;
+            bitmap = (bitmap >> rot) | (bitmap << ((GPT_WHEEL_SLOTS - rot) & GPT_WHEEL_SLOT_MASK));
+            dist   = Gpt_WheelFindLsb(bitmap) + 1U;
+
+            slotStart = ((wheel->Now >> shift) + dist) << shift;
+            if ((slotStart - wheel->Now) < nextEvent)
+            {
+                nextEvent = slotStart - wheel->Now;
+            }
+        }
+    }
+
+    return nextEvent;
+}
+
+static void Gpt_WheelCascade(Gpt_WheelObjType *wheel)
+{
+    uint32             level, slot;
+    Gpt_WheelTimerType timer;
+
+    /* Top level first, a slot start of level n is also one of all lower levels */
+    for (level = GPT_WHEEL_LEVELS - 1U; level > 0U; level--)
+    {
+        if ((wheel->Now & (((uint32)1U << (GPT_WHEEL_SLOT_BITS * level)) - 1U)) == 0U)
+        {
+            slot  = (level * GPT_WHEEL_SLOTS) + ((wheel->Now >> (GPT_WHEEL_SLOT_BITS * level)) & GPT_WHEEL_SLOT_MASK);
+            timer = wheel->SlotHead[slot];
+            while (timer != GPT_WHEEL_TIMER_INVALID)
+            {
+                Gpt_WheelRemove(wheel, timer);
+                Gpt_WheelInsert(wheel, timer);
+                timer = wheel->SlotHead[slot];
+            }
+        }
+    }
+}
+
+static void Gpt_WheelExpire(Gpt_WheelObjType *wheel)
+{
+    uint32             slot = wheel->Now & GPT_WHEEL_SLOT_MASK;
+    Gpt_WheelTimerType timer;
+
+    /* Pop one at a time, the notification may start or stop other timers */
+    timer = wheel->SlotHead[slot];
+    while (timer != GPT_WHEEL_TIMER_INVALID)
+    {
+        Gpt_WheelRemove(wheel, timer);
+        wheel->Timer[timer].IsActive = FALSE;
+        wheel->ActiveCount--;
+        if (NULL_PTR != wheel->Timer[timer].Notification)
+        {
+            wheel->Timer[timer].Notification(timer);
+        }
+        timer = wheel->SlotHead[slot];
+    }
+}
+
+static void Gpt_WheelAdvance(Gpt_WheelObjType *wheel)
+{
+    uint32 units = (Gpt_WheelReadCounter() - wheel->NowTicks) / GPT_TIMER_WHEEL_RESOLUTION;
+    uint32 step;
+
+    while (units > 0U)
+    {
+        /* Jump straight to the next occupied slot, empty slots cost nothing */
+        step = Gpt_WheelNextEvent(wheel);
+        if (step > units)
+        {
+            step = units;
+        }
+        /* NowTicks follows Now, a timer started from a notification sees the
+         * units still pending */
+        wheel->Now      += step;
+        wheel->NowTicks += step * GPT_TIMER_WHEEL_RESOLUTION;
+        units           -= step;
+
+        Gpt_WheelCascade(wheel);
+        Gpt_WheelExpire(wheel);
+    }
+}
+
+static void Gpt_WheelProgram(Gpt_WheelObjType *wheel)
+{
+    uint32  Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_TIMER_WHEEL_CHANNEL);
+    uint32  compareBlk    = (GPT_TIMER_WHEEL_CHANNEL & CH_COMP_MASK);
+    uint32  margin        = GPT_TIMER_WHEEL_RESOLUTION;
+    uint32  nextEvent     = Gpt_WheelNextEvent(wheel);
+    uint64  deltaTicks    = (uint64)GPT_WHEEL_MAX_ARM_TICKS;
+    uint32  compare, counter;
+    boolean isArmed       = FALSE;
+
+    if (nextEvent != GPT_WHEEL_NO_EVENT)
+    {
+        deltaTicks = (uint64)nextEvent * GPT_TIMER_WHEEL_RESOLUTION;
+        if (deltaTicks > (uint64)GPT_WHEEL_MAX_ARM_TICKS)
+        {
+            /* Far deadline - wake up half way to keep the counter in range */
+            deltaTicks = (uint64)GPT_WHEEL_MAX_ARM_TICKS;
+        }
+    }
+    compare = wheel->NowTicks + (uint32)deltaTicks;
+
+    while (isArmed == FALSE)
+    {
+        /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+         * "Reason - Cast for register address " */
+        ((rtiBASE_t *)Gpt_rtiChAddr)->CMP[compareBlk].COMPx = compare;
+        counter                                             = Gpt_WheelReadCounter();
+        /* A deadline already passed, or passed while writing, would only match
+         * after a counter wrap - move it just ahead of the counter */
+        if (((compare - counter) == 0U) || ((compare - counter) > GPT_WHEEL_MAX_ARM_TICKS))
+        {
+            compare = counter + margin;
+            margin  = margin * 2U;
+        }
+        else
+        {
+            isArmed = TRUE;
+        }
+    }
+}
+
+static Std_ReturnType Gpt_WheelHwStart(Gpt_WheelObjType *wheel)
+{
+    uint32         Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_TIMER_WHEEL_CHANNEL);
+    Std_ReturnType retVal        = E_NOT_OK;
+    uint32         tickFreq =
+        Gpt_Config_pt->ChannelConfig_pt[Gpt_ChConfig_map[GPT_TIMER_WHEEL_CHANNEL]].GptChannelTickFrequency;
+
+    /* Left alone while the channel runs as a plain Gpt_StartTimer() channel */
+    if (Gpt_ChannelState[GPT_TIMER_WHEEL_CHANNEL] != GPT_RUNNING)
+    {
+        Gpt_IsrIndex[GPT_TIMER_WHEEL_CHANNEL] = GPT_CH_ISR_MODE_TIMER_WHEEL;
+        /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+         * "Reason - Cast for register address " */
+        Gpt_RTI_StartTimer((rtiBASE_t *)Gpt_rtiChAddr, GPT_TIMER_WHEEL_CHANNEL, tickFreq, GPT_CH_MODE_ONESHOT,
+                           GPT_WHEEL_MAX_ARM_TICKS);
+        Gpt_RTI_EnableNotification((rtiBASE_t *)Gpt_rtiChAddr, GPT_TIMER_WHEEL_CHANNEL);
+        Gpt_ChannelState[GPT_TIMER_WHEEL_CHANNEL] = GPT_RUNNING;
+
+        /* Wheel time restarts at zero with the channel */
+        wheel->Now       = 0U;
+        wheel->NowTicks  = Gpt_ChStartTime_map[GPT_TIMER_WHEEL_CHANNEL];
+        wheel->IsRunning = TRUE;
+        retVal           = E_OK;
+    }
+
+    return (retVal);
+}
+
+static void Gpt_WheelHwStop(Gpt_WheelObjType *wheel)
+{
+    uint32 Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(GPT_TIMER_WHEEL_CHANNEL);
+
+    Gpt_ChannelState[GPT_TIMER_WHEEL_CHANNEL] = GPT_STOPPED;
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    Gpt_RTI_DisableNotification((rtiBASE_t *)Gpt_rtiChAddr, GPT_TIMER_WHEEL_CHANNEL);
+    Gpt_RTI_StopTimer((rtiBASE_t *)Gpt_rtiChAddr, GPT_TIMER_WHEEL_CHANNEL);
+    wheel->IsRunning = FALSE;
+}
+
+#define GPT_STOP_SEC_CODE
+#include "Gpt_MemMap.h"
+
+#define GPT_START_SEC_ISR_CODE
+/*LDRA_INSPECTED 338 S : MISRAC_2012_R.20.1
+ * "Reason - Required to comply with AUTOSAR memmap spec " */
+#include "Gpt_MemMap.h"
+
+/***************************************************************************************************************
+    Function name:  Gpt_WheelIsr
+ ***************************************************************************************************************/
+/*  \Description: Compare interrupt of the timer wheel channel. Advances the wheel to the counter,
+ *                calls the notification of every expired timer and programs the compare to the
+ *                next deadline. The channel is stopped when no timer is left.
+ *  \param[in]:  ChannelID
+ *  \return:     None
+ *  \context:    Called by ISR.
+ *****************************************************************************************************************/
+FUNC(void, GPT_CODE) Gpt_WheelIsr(Gpt_ChannelType Channel)
+{
+    Gpt_WheelObjType *wheel         = &Gpt_WheelObj;
+    uint32            Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(Channel);
+
+    /* Clear the flag first, a compare re-armed below must not be lost */
+    /*LDRA_INSPECTED 440 S : MISRAC_2012_R11.1
+     * "Reason - Cast for register address " */
+    Gpt_RTINotifyContIsr((rtiBASE_t *)Gpt_rtiChAddr, Channel);
+
+    if (wheel->IsRunning == TRUE)
+    {
+        wheel->InIsr = TRUE;
+        Gpt_WheelAdvance(wheel);
+        wheel->InIsr = FALSE;
+        if (wheel->ActiveCount == 0U)
+        {
+            Gpt_WheelHwStop(wheel);
+        }
+        else
+        {
+            Gpt_WheelProgram(wheel);
+        }
+    }
+}
+
+#define GPT_STOP_SEC_ISR_CODE
+#include "Gpt_MemMap.h"
+
+#endif /* #if (STD_ON == GPT_TIMER_WHEEL_API) */
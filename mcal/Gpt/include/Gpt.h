@@ -154,6 +154,10 @@ extern "C" {
 #define GPT_CH_ISR_MODE_CONT_WAKEUP (2U)
 /** \brief GPT oneshot wakeup mode index */
 #define GPT_CH_ISR_MODE_ONESHOT_WAKEUP (3U)
+/** \brief GPT timer wheel channel index */
+#define GPT_CH_ISR_MODE_TIMER_WHEEL (4U)
+/** \brief GPT monotonic time base channel index */
+#define GPT_CH_ISR_MODE_MONOTONIC (5U)
 /**   @} */
 
 /** \brief Driver status UN INITIALIZED */
@@ -258,11 +262,26 @@ extern "C" {
 #define GPT_SID_GET_GETHWUNITOBJ (0x0EU)
 /** \brief GPT Gpt_ConfigRegReadBack API Service ID */
 #define GPT_SID_GET_CONFIG_REG_READBACK (0x0FU)
+/** \brief Gpt_WheelStartTimer() API Service ID */
+#define GPT_SID_WHEEL_START_TIMER (0x10U)
+/** \brief Gpt_WheelStopTimer() API Service ID */
+#define GPT_SID_WHEEL_STOP_TIMER (0x11U)
+/** \brief Gpt_GetMonotonicTicks() API Service ID */
+#define GPT_SID_GET_MONOTONIC_TICKS (0x12U)
+/** \brief Gpt_GetMonotonicNs() API Service ID */
+#define GPT_SID_GET_MONOTONIC_NS (0x13U)
+/** \brief Gpt_MonotonicTicksToNs() API Service ID */
+#define GPT_SID_MONOTONIC_TICKS_TO_NS (0x14U)
+/** \brief Gpt_MonotonicTicksToUs() API Service ID */
+#define GPT_SID_MONOTONIC_TICKS_TO_US (0x15U)
 /**   @} */
 
 /** \brief Maximum resolution for the timer */
 #define MAX_RESOLUTION 0xFFFFFFFFU
 
+/** \brief Longest timer wheel timeout in units of GPT_TIMER_WHEEL_RESOLUTION */
+#define GPT_WHEEL_MAX_TIMEOUT (0xFFFFFU)
+
 /* Klocwork Inspected
  * MISRA C 2012 Dir 4.9
    Reason: Macro cannot be avoided here as sending type as an argument
@@ -356,6 +375,14 @@ typedef enum
 /** \brief  Notification callback function pointer  */
 typedef void (*Gpt_NotifyType)(void);
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+/** \brief Logical timer of the timer wheel, 0 to GPT_TIMER_WHEEL_NUM_TIMERS - 1 */
+typedef uint16 Gpt_WheelTimerType;
+
+/** \brief Timer wheel expiry callback, called from the channel ISR */
+typedef void (*Gpt_WheelNotifyType)(Gpt_WheelTimerType Timer);
+#endif
+
 /** \brief Type for specifying source clock selection  */
 typedef uint32 Gpt_ClockSourceType;
 
@@ -802,6 +829,130 @@ Gpt_GetPredefTimerValue(Gpt_PredefTimerType PredefTimer, uint32* TimeValuePtr);
 FUNC(void, GPT_CODE) Gpt_SetMode(Gpt_ModeType Mode);
 #endif /* if(GPT_WAKEUP_FUNCTIONALITY_API == STD_ON) */
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+/** \brief This service starts a logical timer of the timer wheel.
+ *
+ *
+ * All logical timers share the channel GPT_TIMER_WHEEL_CHANNEL, which is
+ * started in one shot mode with the first timer and stopped when the last
+ * timer expires or is stopped. The compare is programmed to the next
+ * deadline only, there is no periodic tick. Starting an active timer
+ * re-arms it with the new timeout. While the wheel runs, Gpt_StartTimer and
+ * Gpt_StopTimer on the channel report GPT_E_BUSY; while the channel runs
+ * from Gpt_StartTimer, this service reports GPT_E_BUSY and starts nothing.
+ *
+ * Service ID[hex] - 0x10
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Timer - Logical timer, 0 to GPT_TIMER_WHEEL_NUM_TIMERS - 1
+ * \param[in] Value - Timeout in units of GPT_TIMER_WHEEL_RESOLUTION ticks,
+ * 1 to GPT_WHEEL_MAX_TIMEOUT
+ * \param[in] Notification - Called from the channel ISR at expiry
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, GPT_CODE)
+Gpt_WheelStartTimer(Gpt_WheelTimerType Timer, Gpt_ValueType Value, Gpt_WheelNotifyType Notification);
+
+/** \brief This service stops a logical timer of the timer wheel.
+ *
+ *
+ * Stopping a timer which is not active is left without any action.
+ *
+ * Service ID[hex] - 0x11
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Timer - Logical timer, 0 to GPT_TIMER_WHEEL_NUM_TIMERS - 1
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, GPT_CODE) Gpt_WheelStopTimer(Gpt_WheelTimerType Timer);
+#endif /* #if (STD_ON == GPT_TIMER_WHEEL_API) */
+
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+/** \brief This service returns the 64-bit monotonic time in ticks.
+ *
+ *
+ * The time base runs from Gpt_Init on the channel GPT_MONOTONIC_CHANNEL,
+ * whose counter block gives the lower bits. An interrupt every half counter
+ * period extends them to 64 bits, so the value does not wrap. The read does
+ * not lock, it is retried when the extension is updated in between.
+ * The channel is reserved for the time base.
+ *
+ * Service ID[hex] - 0x12
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \return uint64
+ * \retval Ticks since Gpt_Init, 0 if the driver is not initialized
+ *
+ *****************************************************************************/
+FUNC(uint64, GPT_CODE) Gpt_GetMonotonicTicks(void);
+
+/** \brief This service returns the 64-bit monotonic time in nanoseconds.
+ *
+ *
+ * Same as Gpt_MonotonicTicksToNs(Gpt_GetMonotonicTicks()).
+ *
+ * Service ID[hex] - 0x13
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \return uint64
+ * \retval Nanoseconds since Gpt_Init, 0 if the driver is not initialized
+ *
+ *****************************************************************************/
+FUNC(uint64, GPT_CODE) Gpt_GetMonotonicNs(void);
+
+/** \brief This service converts monotonic ticks to nanoseconds.
+ *
+ *
+ * Uses a factor computed in Gpt_Init, there is no division.
+ *
+ * Service ID[hex] - 0x14
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Ticks - Ticks or tick difference of the monotonic time base
+ * \return uint64
+ * \retval Nanoseconds, 0 if the driver is not initialized
+ *
+ *****************************************************************************/
+FUNC(uint64, GPT_CODE) Gpt_MonotonicTicksToNs(uint64 Ticks);
+
+/** \brief This service converts monotonic ticks to microseconds.
+ *
+ *
+ * Uses a factor computed in Gpt_Init, there is no division.
+ *
+ * Service ID[hex] - 0x15
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Ticks - Ticks or tick difference of the monotonic time base
+ * \return uint64
+ * \retval Microseconds, 0 if the driver is not initialized
+ *
+ *****************************************************************************/
+FUNC(uint64, GPT_CODE) Gpt_MonotonicTicksToUs(uint64 Ticks);
+#endif /* #if (STD_ON == GPT_MONOTONIC_TIME_API) */
+
 #ifdef __cplusplus
 }
 #endif
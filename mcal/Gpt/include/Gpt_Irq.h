@@ -97,7 +97,11 @@ extern "C" {
 #define GPT_IRQ_MINOR_VERSION (1U)
 #define GPT_IRQ_PATCH_VERSION (0U)
 
+#if ((STD_ON == GPT_TIMER_WHEEL_API) || (STD_ON == GPT_MONOTONIC_TIME_API))
+#define CHANNEL_MODES 6U
+#else
 #define CHANNEL_MODES 2U
+#endif
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
  *********************************************************************************************************************/
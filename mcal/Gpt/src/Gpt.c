@@ -264,6 +264,12 @@ FUNC(void, GPT_CODE) Gpt_Init(P2CONST(Gpt_ConfigType, AUTOMATIC, GPT_CONST) conf
         if (retVal == E_OK)
         {
             Gpt_ConfigHwChannel(&Gpt_DrvObj, GPT_INITIALIZED);
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+            Gpt_WheelInit();
+#endif
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+            Gpt_MonotonicInit();
+#endif
         }
 
         if (retVal == E_OK)
@@ -310,7 +316,12 @@ FUNC(void, GPT_CODE) Gpt_DeInit(void)
         for (ChannelIdx = 0U; ChannelIdx < Gpt_DrvObj.ChannelCount; ChannelIdx++)
         {
             Gpt_Channel = Gpt_DrvObj.gChannelConfig_pt[ChannelIdx].ChannelId;
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+            /* The time base runs until de-initialization */
+            if ((GPT_RUNNING == Gpt_ChannelState[Gpt_Channel]) && (GPT_MONOTONIC_CHANNEL != Gpt_Channel))
+#else
             if (GPT_RUNNING == Gpt_ChannelState[Gpt_Channel])
+#endif
             {
                 /* At least one of the channels is active */
                 (void)Det_ReportRuntimeError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_DEINIT, GPT_E_BUSY);
@@ -326,6 +337,9 @@ FUNC(void, GPT_CODE) Gpt_DeInit(void)
      */
     if (Dev_Error_Flag == FALSE)
     {
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+        Gpt_MonotonicDeInit();
+#endif
         /* Reset the GPT channel. */
         Gpt_ConfigHwChannel(&Gpt_DrvObj, GPT_UNINITIALIZED);
 
@@ -608,6 +622,15 @@ FUNC(void, GPT_CODE) Gpt_StopTimer(Gpt_ChannelType channel)
     {
         /*Check for Channel State, if channel is not in "Running" state
          * there will be no state change  */
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+        /* The timer wheel owns its channel while it runs, stop its timers instead */
+        if ((channel == GPT_TIMER_WHEEL_CHANNEL) && (Gpt_ChannelState[channel] == GPT_RUNNING) &&
+            (Gpt_IsrIndex[channel] == GPT_CH_ISR_MODE_TIMER_WHEEL))
+        {
+            (void)Det_ReportRuntimeError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_STOP_TIMER, GPT_E_BUSY);
+        }
+        else
+#endif
         if (Gpt_ChannelState[channel] == GPT_RUNNING)
         {
             Gpt_rtiChAddr = Gpt_GetRTIChannelAddr(channel);
@@ -809,6 +832,150 @@ FUNC(void, GPT_CODE) Gpt_SetMode(Gpt_ModeType Mode)
 }
 #endif /* if(GPT_WAKEUP_FUNCTIONALITY_API == STD_ON) */
 
+#if (STD_ON == GPT_TIMER_WHEEL_API)
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(void, GPT_CODE)
+Gpt_WheelStartTimer(Gpt_WheelTimerType Timer, Gpt_ValueType Value, Gpt_WheelNotifyType Notification)
+{
+    Std_ReturnType retVal;
+
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_START_TIMER, GPT_E_UNINIT);
+    }
+    else if (Timer >= GPT_TIMER_WHEEL_NUM_TIMERS)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_START_TIMER, GPT_E_PARAM_CHANNEL);
+    }
+    else if ((Value == 0U) || (Value > GPT_WHEEL_MAX_TIMEOUT))
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_START_TIMER, GPT_E_PARAM_VALUE);
+    }
+    else if (NULL_PTR == Notification)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_START_TIMER, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        /* Critical section, the wheel is shared with the channel ISR */
+        SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+        retVal = Gpt_WheelStart(Timer, Value, Notification);
+        SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+
+        if (retVal != E_OK)
+        {
+            /* The wheel channel is running as a Gpt_StartTimer() channel */
+            (void)Det_ReportRuntimeError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_START_TIMER, GPT_E_BUSY);
+        }
+    }
+} /* Gpt_WheelStartTimer */
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(void, GPT_CODE) Gpt_WheelStopTimer(Gpt_WheelTimerType Timer)
+{
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_STOP_TIMER, GPT_E_UNINIT);
+    }
+    else if (Timer >= GPT_TIMER_WHEEL_NUM_TIMERS)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_WHEEL_STOP_TIMER, GPT_E_PARAM_CHANNEL);
+    }
+    else
+#endif
+    {
+        SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+        Gpt_WheelStop(Timer);
+        SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+    }
+} /* Gpt_WheelStopTimer */
+#endif /* #if (STD_ON == GPT_TIMER_WHEEL_API) */
+
+#if (STD_ON == GPT_MONOTONIC_TIME_API)
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(uint64, GPT_CODE) Gpt_GetMonotonicTicks(void)
+{
+    uint64 ticks = 0U;
+
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_GET_MONOTONIC_TICKS, GPT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        ticks = Gpt_MonotonicGetTicks();
+    }
+    return ticks;
+} /* Gpt_GetMonotonicTicks */
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(uint64, GPT_CODE) Gpt_GetMonotonicNs(void)
+{
+    uint64 timeNs = 0U;
+
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_GET_MONOTONIC_NS, GPT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        timeNs = Gpt_MonotonicToNs(Gpt_MonotonicGetTicks());
+    }
+    return timeNs;
+} /* Gpt_GetMonotonicNs */
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(uint64, GPT_CODE) Gpt_MonotonicTicksToNs(uint64 Ticks)
+{
+    uint64 timeNs = 0U;
+
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_MONOTONIC_TICKS_TO_NS, GPT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        timeNs = Gpt_MonotonicToNs(Ticks);
+    }
+    return timeNs;
+} /* Gpt_MonotonicTicksToNs */
+
+/*LDRA_INSPECTED 76 D : MISRAC_2012_R.8.7
+ * "Reason - This is external APIs " */
+FUNC(uint64, GPT_CODE) Gpt_MonotonicTicksToUs(uint64 Ticks)
+{
+    uint64 timeUs = 0U;
+
+#if (STD_ON == GPT_DEV_ERROR_DETECT)
+    if (Gpt_DriverStatus != GPT_DRIVER_INITIALIZED)
+    {
+        (void)Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SID_MONOTONIC_TICKS_TO_US, GPT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        timeUs = Gpt_MonotonicToUs(Ticks);
+    }
+    return timeUs;
+} /* Gpt_MonotonicTicksToUs */
+#endif /* #if (STD_ON == GPT_MONOTONIC_TIME_API) */
+
 #if (STD_ON == GPT_DEV_ERROR_DETECT)
 static FUNC(Std_ReturnType, GPT_CODE) Gpt_CheckInitDetErrors(P2CONST(Gpt_ConfigType, AUTOMATIC, GPT_CONST) pConfig)
 {
@@ -1,6 +1,6 @@
 include $(mcal_PATH)/Gpt/inc.mk
 
 SRCDIR += $(mcal_PATH)/Gpt/src
-SRCS_COMMON += Gpt.c Gpt_Irq.c Gpt_Priv.c
+SRCS_COMMON += Gpt.c Gpt_Irq.c Gpt_Priv.c Gpt_TimerWheel.c Gpt_Monotonic.c
 # SOC specific files
 SRCDIR += $(mcal_PATH)/Gpt/V0
@@ -82,6 +82,9 @@
 #if (STD_ON == ICU_TIMESTAMP_API)
 static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel);
 #endif
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+static FUNC(uint32, ICU_CODE) Icu_TimestampBatch_Store(Icu_ChObjType *chObj, const uint32 *capPtr);
+#endif
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -108,6 +111,9 @@ void Icu_ResetChObj(Icu_ChObjType *chObj)
     chObj->NotifyInterval        = 0U;
     chObj->NotificationCounter   = 0U;
     chObj->IsActive              = FALSE;
+#if (ICU_TIMESTAMP_BATCH_API == STD_ON)
+    chObj->TimestampEpoch = 0U;
+#endif
 #endif
 #if (ICU_SIGNAL_MEASUREMENT_API == STD_ON)
     chObj->cap1                 = 0U;
@@ -301,6 +307,9 @@ void Icu_TimeStamp_Init(Icu_ChannelType Channel, Icu_ValueType *StartPtr, uint16
     Icu_ChObj[Channel].NextTimeStampIndex    = 0U;
     Icu_ChObj[Channel].NotifyInterval        = NotifyInterval;
     Icu_ChObj[Channel].NotificationCounter   = 0U;
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+    Icu_ChObj[Channel].TimestampEpoch = 0U;
+#endif
 }
 
 void Icu_TimeStamp_Clear(Icu_ChannelType Channel)
@@ -312,6 +321,166 @@ void Icu_TimeStamp_Clear(Icu_ChannelType Channel)
     Icu_ChObj[Channel].NotificationCounter   = 0U;
 }
 
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+uint64 Icu_TimestampBatch_Extend(Icu_ChannelType Channel, Icu_ValueType Timestamp)
+{
+    uint32 baseAddr = Icu_ChObj[Channel].baseAddr;
+    uint32 epoch    = Icu_ChObj[Channel].TimestampEpoch;
+    uint32 counter  = HW_RD_REG32(baseAddr + CSL_ECAP_TSCTR);
+
+    /* An overflow not yet counted by the ISR belongs to the current epoch.
+     * Re-read the counter so that it is sampled after the wrap. */
+    if (ICU_ECAP_getIntrFlags(baseAddr, ECAP_CNTOVF_INT) != 0U)
+    {
+        epoch++;
+        counter = HW_RD_REG32(baseAddr + CSL_ECAP_TSCTR);
+    }
+
+    /* A capture ahead of the counter was taken before the last wrap */
+    if ((uint32)Timestamp > counter)
+    {
+        epoch--;
+    }
+
+    return ((((uint64)epoch) << 32U) | (uint64)Timestamp);
+}
+#endif
+
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+void Icu_TimestampDma_Start(Icu_ChannelType Channel)
+{
+    Icu_ChObjType             *chObj     = &Icu_ChObj[Channel];
+    uint32                     dmaHandle = chObj->chCfg.dmaHandleId;
+    uint32                     blockLen  = (uint32)chObj->TimeStampBufferSize;
+    uint32                     numBlocks, blockIdx, linkIdx;
+    Cdd_Dma_ParamEntry         edmaParam;
+    CDD_EDMACCEDMACCPaRAMEntry firstParam;
+
+    if (chObj->NotifyInterval > 0U)
+    {
+        blockLen = (uint32)chObj->NotifyInterval;
+    }
+    numBlocks            = (uint32)chObj->TimeStampBufferSize / blockLen;
+    chObj->DmaNumBlocks  = (uint16)numBlocks;
+    chObj->DmaBlockCount = 0U;
+
+    /* CAP1 to CAP4 are adjacent - every CEVT4 event moves them as one array
+     * and B counts the arrays of one block. The end of a block interrupts
+     * only when it is notified or ends the linear buffer. */
+    edmaParam.srcPtr     = (void *)(chObj->baseAddr + CSL_ECAP_CAP1);
+    edmaParam.destPtr    = (void *)(chObj->NextTimeStampIndexPtr);
+    edmaParam.aCnt       = (uint16)(ICU_TIMESTAMP_BATCH_SIZE * sizeof(Icu_ValueType));
+    edmaParam.bCnt       = (uint16)(blockLen / ICU_TIMESTAMP_BATCH_SIZE);
+    edmaParam.cCnt       = (uint16)1;
+    edmaParam.bCntReload = 0;
+    edmaParam.srcBIdx    = (sint16)0;
+    edmaParam.destBIdx   = (sint16)(ICU_TIMESTAMP_BATCH_SIZE * sizeof(Icu_ValueType));
+    edmaParam.srcCIdx    = (sint16)0;
+    edmaParam.destCIdx   = (sint16)0;
+    edmaParam.opt        = 0U;
+    if ((chObj->NotifyInterval > 0U) || (chObj->chCfg.bufferType == ICU_LINEAR_BUFFER))
+    {
+        edmaParam.opt = CDD_EDMA_OPT_TCINTEN_MASK;
+    }
+    Cdd_Dma_ParamSet(dmaHandle, 0U, 0U, edmaParam);
+
+    /* The destination of the first set is the DMA view of the buffer start */
+    Cdd_Dma_GetParam(dmaHandle, 0U, 0U, &firstParam);
+    chObj->DmaDstBase = firstParam.destAddr;
+
+    /* Every block links to the next one. The last block of a linear buffer
+     * ends the transfer, in a circular buffer it links to the reload copy
+     * of the first block, which closes the ring back to block 1. */
+    for (blockIdx = 1U; blockIdx < numBlocks; blockIdx++)
+    {
+        linkIdx = blockIdx + 1U;
+        if ((linkIdx == numBlocks) && (chObj->chCfg.bufferType != ICU_CIRCULAR_BUFFER))
+        {
+            linkIdx = CDD_DMA_RELOAD_NO_LINK;
+        }
+        edmaParam.destPtr = (void *)(&chObj->NextTimeStampIndexPtr[blockIdx * blockLen]);
+        Cdd_Dma_ReloadParamSet(dmaHandle, blockIdx, linkIdx, edmaParam);
+    }
+
+    if (chObj->chCfg.bufferType == ICU_CIRCULAR_BUFFER)
+    {
+        edmaParam.destPtr = (void *)(chObj->NextTimeStampIndexPtr);
+        Cdd_Dma_ReloadParamSet(dmaHandle, numBlocks, 1U, edmaParam);
+    }
+    if ((numBlocks > 1U) || (chObj->chCfg.bufferType == ICU_CIRCULAR_BUFFER))
+    {
+        Cdd_Dma_LinkChannel(dmaHandle, 0U, 1U);
+    }
+
+    (void)Cdd_Dma_EnableTransferRegion(dmaHandle, CDD_EDMA_TRIG_MODE_EVENT);
+
+    /* Continuous 4-event capture with the DMA trigger on CEVT4, no ECAP interrupt */
+    Icu_ConfigEcap(chObj->baseAddr, chObj->activation_edge, ICU_ABSOLUTE_MODE, FALSE, chObj->chCfg.intrcapSelect);
+    ICU_ECAP_captureEvtStopWrapConfig(chObj->baseAddr, ECAP_CAPTURE_EVENT4_STOP);
+    ICU_ECAP_dmaEvtSelect(chObj->baseAddr, ECAP_DMA_EVT_CEVT4);
+    ECAP_reArm(chObj->baseAddr);
+}
+
+Std_ReturnType Icu_TimestampDma_CheckParamSets(Icu_ChannelType Channel, uint16 BufferSize, uint16 NotifyInterval)
+{
+    Std_ReturnType retVal    = E_OK;
+    uint32         blockLen  = (uint32)BufferSize;
+    uint32         numParams = 0U;
+
+    if (NotifyInterval > 0U)
+    {
+        blockLen = (uint32)NotifyInterval;
+    }
+    if (blockLen > 0U)
+    {
+        /* One set per block plus the reload copy that closes a circular ring */
+        numParams = (uint32)BufferSize / blockLen;
+        if (Icu_ChObj[Channel].chCfg.bufferType == ICU_CIRCULAR_BUFFER)
+        {
+            numParams++;
+        }
+    }
+    if (numParams > Cdd_Dma_Config.CddDmaDriverHandler[Icu_ChObj[Channel].chCfg.dmaHandleId]
+                         ->edmaConfig.ownResource.channelGroup[0]
+                         ->maxParam)
+    {
+        retVal = E_NOT_OK;
+    }
+    return retVal;
+}
+
+void Icu_TimestampDma_Stop(Icu_ChannelType Channel)
+{
+    (void)Cdd_Dma_DisableTransferRegion(Icu_ChObj[Channel].chCfg.dmaHandleId, CDD_EDMA_TRIG_MODE_EVENT);
+}
+
+Icu_IndexType Icu_TimestampDma_GetIndex(Icu_ChannelType Channel)
+{
+    Icu_ChObjType             *chObj = &Icu_ChObj[Channel];
+    Icu_IndexType              index = chObj->NextTimeStampIndex;
+    uint32                     dstOffset;
+    CDD_EDMACCEDMACCPaRAMEntry activeParam;
+
+    if (chObj->IsRunning != (uint32)FALSE)
+    {
+        /* The active PaRAM destination is the next slot to be written. A
+         * finished linear transfer leaves a null set - report the buffer full. */
+        Cdd_Dma_GetParam(chObj->chCfg.dmaHandleId, 0U, 0U, &activeParam);
+        index = (Icu_IndexType)chObj->TimeStampBufferSize;
+        if (activeParam.destAddr >= chObj->DmaDstBase)
+        {
+            dstOffset = (activeParam.destAddr - chObj->DmaDstBase) / (uint32)sizeof(Icu_ValueType);
+            if (dstOffset < index)
+            {
+                index = dstOffset;
+            }
+        }
+    }
+
+    return index;
+}
+#endif
+
 #endif /*ICU_TIMESTAMP_API*/
 
 #if (STD_ON == ICU_SIGNAL_MEASUREMENT_API)
@@ -330,7 +499,33 @@ void Icu_SignalMeasurement_Init(Icu_ChannelType Channel)
     Icu_ChObj[Channel].DutyCycle.ActiveTime = 0U;
     Icu_ChObj[Channel].DutyAcquired         = FALSE;
     Icu_ChObj[Channel].PeriodAcquired       = FALSE;
+#if (STD_ON == ICU_SIGNAL_AVERAGING_API)
+    (void)memset(&Icu_ChObj[Channel].AvgAcc, 0, sizeof(Icu_SignalAvgType));
+    (void)memset(&Icu_ChObj[Channel].AvgLatch, 0, sizeof(Icu_SignalAvgType));
+    Icu_ChObj[Channel].AvgNumPeriods = 0U;
+    Icu_ChObj[Channel].AvgLatched    = FALSE;
+    Icu_ChObj[Channel].AvgSkipBatch  = TRUE;
+#endif
+}
+
+#if (STD_ON == ICU_SIGNAL_AVERAGING_API)
+void Icu_SignalAveraging_Compute(Icu_ChannelType Channel, const Icu_SignalAvgType *avgPtr,
+                                 Icu_SignalStatisticsType *StatisticsPtr)
+{
+    uint64 clkFreq_mHz = (uint64)Icu_ChObj[Channel].chCfg.instanceClkMHz * 1000000000U;
+    uint64 count       = (uint64)avgPtr->Count;
+
+    /* Count periods of at most 2^32 ticks - the sums stay below 2^48, so the
+     * Q15 and milli Hertz scaling fits in 64 bits */
+    StatisticsPtr->PeriodTicks      = (uint32)((avgPtr->PeriodSum + (count / 2U)) / count);
+    StatisticsPtr->ActiveTicks      = (uint32)((avgPtr->ActiveSum + (count / 2U)) / count);
+    StatisticsPtr->MinPeriodTicks   = avgPtr->MinPeriod;
+    StatisticsPtr->MaxPeriodTicks   = avgPtr->MaxPeriod;
+    StatisticsPtr->FrequencyMilliHz = (uint32)((clkFreq_mHz * count) / avgPtr->PeriodSum);
+    StatisticsPtr->DutyQ15          = (uint16)((avgPtr->ActiveSum << 15U) / avgPtr->PeriodSum);
+    StatisticsPtr->NumPeriods       = avgPtr->Count;
 }
+#endif
 
 #endif
 
@@ -401,6 +596,185 @@ FUNC(void, ICU_CODE) Icu_Timestamp_ISR(Icu_ChannelType Channel)
 }
 #endif
 
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+FUNC(void, ICU_CODE) Icu_TimestampBatch_ISR(Icu_ChannelType Channel)
+{
+    Icu_ChObjType *chObj     = &Icu_ChObj[Channel];
+    uint32         baseAddr  = chObj->baseAddr;
+    uint32         numStored = 0U;
+    uint32         flags;
+    uint32         capVal[ICU_TIMESTAMP_BATCH_SIZE];
+
+    flags = ICU_ECAP_getIntrFlags(baseAddr, (uint32)ECAP_CEVT4_INT | (uint32)ECAP_CNTOVF_INT);
+
+    if ((flags & (uint32)ECAP_CNTOVF_INT) != 0U)
+    {
+        /* Free running counter wrapped - advance the upper word */
+        chObj->TimestampEpoch++;
+    }
+
+    if ((flags & (uint32)ECAP_CEVT4_INT) != 0U)
+    {
+        /* CAP1 to CAP4 hold the last four edges in order */
+        ICU_ECAP_timeStampReadAll(baseAddr, &capVal[0U]);
+        if (chObj->NextTimeStampIndexPtr != NULL_PTR)
+        {
+            numStored = Icu_TimestampBatch_Store(chObj, &capVal[0U]);
+        }
+    }
+
+    ICU_ECAP_intrStatusClear(baseAddr, flags);
+    ICU_ECAP_globalIntrClear(baseAddr);
+
+    if (numStored > 0U)
+    {
+        /* NotifyInterval is counted in timestamps, checked once per batch */
+        chObj->NotificationCounter += (uint16)numStored;
+        if (chObj->NotificationCounter >= chObj->NotifyInterval)
+        {
+            if (chObj->NotifyInterval > 0U)
+            {
+                chObj->NotificationCounter %= chObj->NotifyInterval;
+            }
+            else
+            {
+                chObj->NotificationCounter = 0U;
+            }
+
+            if ((chObj->NotificationEnabled != (uint32)0U) && (chObj->chCfg.notificationHandler != NULL_PTR))
+            {
+                chObj->chCfg.notificationHandler();
+            }
+        }
+    }
+
+    return;
+}
+
+static FUNC(uint32, ICU_CODE) Icu_TimestampBatch_Store(Icu_ChObjType *chObj, const uint32 *capPtr)
+{
+    uint32 numStored = 0U;
+
+    while ((numStored < ICU_TIMESTAMP_BATCH_SIZE) && (chObj->NextTimeStampIndex < chObj->TimeStampBufferSize))
+    {
+        chObj->NextTimeStampIndexPtr[chObj->NextTimeStampIndex] = (Icu_ValueType)capPtr[numStored];
+        chObj->NextTimeStampIndex++;
+        numStored++;
+
+        if ((chObj->NextTimeStampIndex >= chObj->TimeStampBufferSize) &&
+            (chObj->chCfg.bufferType == ICU_CIRCULAR_BUFFER))
+        {
+            /*Next timestamp writes over the first item, and continous capturing timestamps. */
+            chObj->NextTimeStampIndex = 0U;
+        }
+    }
+
+    if (chObj->NextTimeStampIndex >= chObj->TimeStampBufferSize)
+    {
+        /* Linear buffer full - stop capturing, remaining captures of the batch are dropped */
+        ICU_ECAP_intrDisable(chObj->baseAddr, ECAP_INT_ALL);
+        chObj->IsRunning = FALSE;
+    }
+
+    return numStored;
+}
+#endif
+
+#if ((STD_ON == ICU_SIGNAL_MEASUREMENT_API) && (STD_ON == ICU_SIGNAL_AVERAGING_API))
+FUNC(void, ICU_CODE) Icu_SignalAveraging_ISR(Icu_ChannelType Channel)
+{
+    Icu_ChObjType *chObj    = &Icu_ChObj[Channel];
+    uint32         baseAddr = chObj->baseAddr;
+    uint32         flags, capIdx, period;
+    uint32         capVal[ICU_TIMESTAMP_BATCH_SIZE];
+
+    flags = ICU_ECAP_getIntrFlags(baseAddr, (uint32)ECAP_CEVT4_INT | (uint32)ECAP_CNTOVF_INT);
+
+    if ((flags & (uint32)ECAP_CNTOVF_INT) != 0U)
+    {
+        /* No edge for a full counter period - drop the partial window */
+        (void)memset(&chObj->AvgAcc, 0, sizeof(Icu_SignalAvgType));
+        chObj->AvgSkipBatch = TRUE;
+    }
+    else if ((flags & (uint32)ECAP_CEVT4_INT) != 0U)
+    {
+        ICU_ECAP_timeStampReadAll(baseAddr, &capVal[0U]);
+        if (chObj->AvgSkipBatch == TRUE)
+        {
+            /* CAP1 of the first batch counts from the counter start */
+            chObj->AvgSkipBatch = FALSE;
+        }
+        else
+        {
+            /* Delta mode, falling edge first - CAP1/CAP3 hold the high time and
+             * CAP2/CAP4 the following low time */
+            for (capIdx = 0U; capIdx < ICU_TIMESTAMP_BATCH_SIZE; capIdx += 2U)
+            {
+                period = capVal[capIdx] + capVal[capIdx + 1U];
+                if ((chObj->AvgAcc.Count == 0U) || (period < chObj->AvgAcc.MinPeriod))
+                {
+                    chObj->AvgAcc.MinPeriod = period;
+                }
+                if (period > chObj->AvgAcc.MaxPeriod)
+                {
+                    chObj->AvgAcc.MaxPeriod = period;
+                }
+                chObj->AvgAcc.PeriodSum += (uint64)period;
+                chObj->AvgAcc.ActiveSum += (uint64)capVal[capIdx];
+                chObj->AvgAcc.Count++;
+            }
+
+            if (chObj->AvgAcc.Count >= chObj->AvgNumPeriods)
+            {
+                /* Latch the window, the divisions are left to the reader */
+                chObj->AvgLatch   = chObj->AvgAcc;
+                chObj->AvgLatched = TRUE;
+                (void)memset(&chObj->AvgAcc, 0, sizeof(Icu_SignalAvgType));
+                chObj->InputState = ICU_ACTIVE;
+            }
+        }
+    }
+    else
+    {
+        /* No actions required */
+    }
+
+    ICU_ECAP_intrStatusClear(baseAddr, flags);
+    ICU_ECAP_globalIntrClear(baseAddr);
+
+    return;
+}
+#endif
+
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+void Icu_TimestampDma_Callback(void *appData)
+{
+    Icu_ChannelType Channel = (Icu_ChannelType)((uint32)appData);
+    Icu_ChObjType  *chObj   = &Icu_ChObj[Channel];
+
+    if (chObj->chCfg.bufferType == ICU_LINEAR_BUFFER)
+    {
+        chObj->DmaBlockCount++;
+        if (chObj->DmaBlockCount >= chObj->DmaNumBlocks)
+        {
+            /*Stop capturing timestamps, the buffer is full*/
+            Icu_TimestampDma_Stop(Channel);
+            chObj->NextTimeStampIndex = chObj->TimeStampBufferSize;
+            chObj->IsRunning          = FALSE;
+        }
+    }
+
+    /* Each completed block holds NotifyInterval timestamps */
+    if ((chObj->NotifyInterval > 0U) && (chObj->NotificationEnabled != (uint32)0U) &&
+        (chObj->chCfg.notificationHandler != NULL_PTR))
+    {
+        chObj->chCfg.notificationHandler();
+    }
+
+    return;
+}
+#endif
+
 #if (STD_ON == ICU_TIMESTAMP_API)
 static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel)
 {
@@ -414,7 +788,7 @@ static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel)
     {
         /*interrupt occured at CAP1, get the current timestamp from CAP1*/
         timestampRead = ICU_ECAP_timeStampRead(baseAddr, ECAP_CAPTURE_EVENT_1);
-        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (uint16)timestampRead;
+        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (Icu_ValueType)timestampRead;
         ICU_ECAP_intrStatusClear(baseAddr, ECAP_CEVT1_INT);
         avoidNesting_Flag = E_OK;
     }
@@ -422,7 +796,7 @@ static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel)
     {
         /*interrupt occured at CAP1, get the current timestamp from CAP1*/
         timestampRead = ICU_ECAP_timeStampRead(baseAddr, ECAP_CAPTURE_EVENT_2);
-        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (uint16)timestampRead;
+        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (Icu_ValueType)timestampRead;
         ICU_ECAP_intrStatusClear(baseAddr, ECAP_CEVT2_INT);
         avoidNesting_Flag = E_OK;
     }
@@ -430,7 +804,7 @@ static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel)
     {
         /*interrupt occured at CAP1, get the current timestamp from CAP1*/
         timestampRead = ICU_ECAP_timeStampRead(baseAddr, ECAP_CAPTURE_EVENT_3);
-        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (uint16)timestampRead;
+        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (Icu_ValueType)timestampRead;
         ICU_ECAP_intrStatusClear(baseAddr, ECAP_CEVT3_INT);
         avoidNesting_Flag = E_OK;
     }
@@ -438,7 +812,7 @@ static FUNC(void, ICU_CODE) ICU_Timestamp_ISRProcess(Icu_ChannelType Channel)
     {
         /*interrupt occured at CAP1, get the current timestamp from CAP1*/
         timestampRead = ICU_ECAP_timeStampRead(baseAddr, ECAP_CAPTURE_EVENT_4);
-        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (uint16)timestampRead;
+        Icu_ChObj[Channel].NextTimeStampIndexPtr[Icu_ChObj[Channel].NextTimeStampIndex] = (Icu_ValueType)timestampRead;
         ICU_ECAP_intrStatusClear(baseAddr, ECAP_CEVT4_INT);
         avoidNesting_Flag = E_OK;
     }
@@ -460,6 +834,9 @@ FUNC(void, ICU_CODE) Icu_ChannelISR(Icu_ChannelType Channel)
 #if (STD_ON == ICU_TIMESTAMP_API)
     if (Icu_ChObj[Channel].chCfg.measurementMode == ICU_MODE_TIMESTAMP)
     {
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+        Icu_TimestampBatch_ISR(Channel);
+#else
         Icu_Timestamp_ISR(Channel);
 
         if ((++Icu_ChObj[Channel].NotificationCounter >= Icu_ChObj[Channel].NotifyInterval) &&
@@ -471,6 +848,13 @@ FUNC(void, ICU_CODE) Icu_ChannelISR(Icu_ChannelType Channel)
                 Icu_ChObj[Channel].chCfg.notificationHandler();
             }
         }
+#endif
+    }
+#endif
+#if ((STD_ON == ICU_SIGNAL_MEASUREMENT_API) && (STD_ON == ICU_SIGNAL_AVERAGING_API))
+    if (Icu_ChObj[Channel].chCfg.measurementMode == ICU_MODE_SIGNAL_MEASUREMENT)
+    {
+        Icu_SignalAveraging_ISR(Channel);
     }
 #endif
 #if (STD_ON == ICU_EDGE_COUNT_API)
@@ -80,6 +80,9 @@
 #include "Icu_MemMap.h"
 
 #include "Det.h"
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+#include "Cdd_Dma.h"
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -90,6 +93,12 @@ extern "C" {
 #define ICUTIMER_MAX_RESOLUTION (0xFFFFFFFFU)
 #define ICUTICKMAXVALUE         (0xF0000000U)
 
+/** \brief Number of captures read per interrupt in batched Timestamp mode */
+#define ICU_TIMESTAMP_BATCH_SIZE (4U)
+
+/** \brief dmaHandleId of a channel captured without DMA */
+#define ICU_DMA_HANDLE_INVALID (0xFFU)
+
 #define ECAP_INT_ALL                                                                                        \
     (ECAP_CEVT1_INT | ECAP_CEVT2_INT | ECAP_CEVT3_INT | ECAP_CEVT4_INT | ECAP_CNTOVF_INT | ECAP_PRDEQ_INT | \
      ECAP_CMPEQ_INT)
@@ -98,6 +107,23 @@ extern "C" {
 /*                         Structures and Enums                               */
 /* ========================================================================== */
 
+#if ((ICU_SIGNAL_MEASUREMENT_API == STD_ON) && (ICU_SIGNAL_AVERAGING_API == STD_ON))
+/** \brief Period accumulator of an averaged signal measurement window */
+typedef struct
+{
+    uint64 PeriodSum;
+    /**< Sum of the periods in ticks */
+    uint64 ActiveSum;
+    /**< Sum of the active times in ticks */
+    uint32 MinPeriod;
+    /**< Shortest period in ticks */
+    uint32 MaxPeriod;
+    /**< Longest period in ticks */
+    uint16 Count;
+    /**< Number of periods accumulated */
+} Icu_SignalAvgType;
+#endif
+
 /** \brief Icu configuration structure internal to driver */
 typedef struct
 {
@@ -114,6 +140,18 @@ typedef struct
     /**< Notification counter to compare with NotifyInterval */
     boolean        IsActive;
     /**< Set to true when timestamp API is executing */
+#if (ICU_TIMESTAMP_BATCH_API == STD_ON)
+    uint32 TimestampEpoch;
+    /**< Counter overflows since start, upper word of 64-bit timestamps */
+#endif
+#if (ICU_TIMESTAMP_DMA_API == STD_ON)
+    uint32 DmaDstBase;
+    /**< DMA view of the timestamp buffer start address */
+    uint16 DmaNumBlocks;
+    /**< Number of NotifyInterval sized blocks in the buffer */
+    uint16 DmaBlockCount;
+    /**< Blocks completed in linear buffer mode */
+#endif
 #endif
 #if (ICU_SIGNAL_MEASUREMENT_API == STD_ON)
     uint32            cap1;
@@ -136,6 +174,18 @@ typedef struct
     /**< Set to true when Duty cycle values have been acquired */
     boolean           PeriodAcquired;
     /**< Set to true when Period values have been acquired */
+#if (ICU_SIGNAL_AVERAGING_API == STD_ON)
+    Icu_SignalAvgType AvgAcc;
+    /**< Accumulator of the running window */
+    Icu_SignalAvgType AvgLatch;
+    /**< Last completed window */
+    uint16            AvgNumPeriods;
+    /**< Periods per window, 0 when averaging is not running */
+    boolean           AvgLatched;
+    /**< Set to true when AvgLatch holds a window not read yet */
+    boolean           AvgSkipBatch;
+    /**< Set to true when the next captures are not a full period */
+#endif
 #endif
     Icu_InputStateType InputState;
     /**< Variable for input state of module */
@@ -226,6 +276,30 @@ void Icu_HwUnitInit(Icu_ChObjType *chObj);
  *
  **/
 void Icu_SignalMeasurement_Init(Icu_ChannelType Channel);
+#if (STD_ON == ICU_SIGNAL_AVERAGING_API)
+/**
+ * \brief   This API will be called by ISR for averaged signal measurement. It
+ *          reads CAP1 to CAP4 and accumulates two periods.
+ *
+ * \param   Channel      ICU Channel in Use
+ *
+ * \return  None.
+ *
+ **/
+void Icu_SignalAveraging_ISR(Icu_ChannelType Channel);
+/**
+ * \brief   This API will compute the statistics of a latched window
+ *
+ * \param   Channel      ICU Channel in Use
+ * \param   avgPtr       Latched window
+ * \param   StatisticsPtr Statistics output
+ *
+ * \return  None.
+ *
+ **/
+void Icu_SignalAveraging_Compute(Icu_ChannelType Channel, const Icu_SignalAvgType *avgPtr,
+                                 Icu_SignalStatisticsType *StatisticsPtr);
+#endif
 #endif
 
 #if (STD_ON == ICU_TIMESTAMP_API)
@@ -259,6 +333,81 @@ void Icu_Timestamp_ISR(Icu_ChannelType Channel);
  *
  **/
 void Icu_TimeStamp_Clear(Icu_ChannelType Channel);
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+/**
+ * \brief   This API will be called by ISR for batched timestamp API. It reads
+ *          CAP1 to CAP4 in one pass and counts counter overflows.
+ *
+ * \param   Channel         ICU Channel in Use
+ *
+ * \return  None.
+ *
+ **/
+void Icu_TimestampBatch_ISR(Icu_ChannelType Channel);
+/**
+ * \brief   This API will extend a 32-bit timestamp with the overflow count.
+ *          Must be called with the ICU exclusive area held.
+ *
+ * \param   Channel         ICU Channel in Use
+ * \param   Timestamp       Captured 32-bit timestamp
+ *
+ * \return  64-bit timestamp.
+ *
+ **/
+uint64 Icu_TimestampBatch_Extend(Icu_ChannelType Channel, Icu_ValueType Timestamp);
+#endif
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+/**
+ * \brief   This API will start the DMA driven timestamp capture. Each CEVT4
+ *          DMA event copies CAP1 to CAP4 to the buffer, one PaRAM set per
+ *          NotifyInterval block.
+ *
+ * \param   Channel         ICU Channel in Use
+ *
+ * \return  None.
+ *
+ **/
+void Icu_TimestampDma_Start(Icu_ChannelType Channel);
+/**
+ * \brief   This API will check that the DMA handler of the channel owns
+ *          enough PaRAM sets for the block chain of the requested buffer.
+ *
+ * \param   Channel         ICU Channel in Use
+ * \param   BufferSize      Size of the timestamp buffer
+ * \param   NotifyInterval  Notification interval, 0 for none
+ *
+ * \return  E_OK if the PaRAM sets fit, else E_NOT_OK.
+ *
+ **/
+Std_ReturnType Icu_TimestampDma_CheckParamSets(Icu_ChannelType Channel, uint16 BufferSize, uint16 NotifyInterval);
+/**
+ * \brief   This API will stop the DMA driven timestamp capture.
+ *
+ * \param   Channel         ICU Channel in Use
+ *
+ * \return  None.
+ *
+ **/
+void Icu_TimestampDma_Stop(Icu_ChannelType Channel);
+/**
+ * \brief   This API will derive the timestamp index from the DMA destination.
+ *
+ * \param   Channel         ICU Channel in Use
+ *
+ * \return  Index of the next timestamp to be written.
+ *
+ **/
+Icu_IndexType Icu_TimestampDma_GetIndex(Icu_ChannelType Channel);
+/**
+ * \brief   This is the DMA completion callback of a timestamp block.
+ *
+ * \param   appData         ICU Channel in Use
+ *
+ * \return  None.
+ *
+ **/
+void Icu_TimestampDma_Callback(void *appData);
+#endif
 #endif
 
 /**
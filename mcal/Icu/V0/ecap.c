@@ -161,6 +161,14 @@ uint32 ICU_ECAP_timeStampRead(uint32 baseAddr, uint32 capEvtFlag)
     return (HW_RD_REG32(baseAddr + capEvtFlag));
 }
 
+void ICU_ECAP_timeStampReadAll(uint32 baseAddr, uint32 *capPtr)
+{
+    capPtr[0U] = HW_RD_REG32(baseAddr + CSL_ECAP_CAP1);
+    capPtr[1U] = HW_RD_REG32(baseAddr + CSL_ECAP_CAP2);
+    capPtr[2U] = HW_RD_REG32(baseAddr + CSL_ECAP_CAP3);
+    capPtr[3U] = HW_RD_REG32(baseAddr + CSL_ECAP_CAP4);
+}
+
 void ICU_ECAP_captureEvtPolarityConfig(uint32 baseAddr, uint32 capEvt1pol, uint32 capEvt2pol, uint32 capEvt3pol,
                                        uint32 capEvt4pol)
 {
@@ -203,6 +211,18 @@ void ICU_ECAP_continousModeConfig(uint32 baseAddr)
     HW_WR_REG32(temp_addr, value);
 }
 
+void ICU_ECAP_captureEvtStopWrapConfig(uint32 baseAddr, uint32 stopWrap)
+{
+    uint32 temp_addr = baseAddr + CSL_ECAP_ECCTL1_ECCTL2;
+    HW_WR_FIELD32(temp_addr, CSL_ECAP_ECCTL1_ECCTL2_STOP_WRAP, stopWrap);
+}
+
+void ICU_ECAP_dmaEvtSelect(uint32 baseAddr, uint32 dmaEvt)
+{
+    uint32 temp_addr = baseAddr + CSL_ECAP_ECCTL1_ECCTL2;
+    HW_WR_FIELD32(temp_addr, CSL_ECAP_ECCTL1_ECCTL2_DMAEVTSEL, dmaEvt);
+}
+
 void ICU_ECAP_counterControl(uint32 baseAddr, uint32 flag)
 {
     uint32 temp_addr = baseAddr + CSL_ECAP_ECCTL1_ECCTL2;
@@ -246,6 +266,14 @@ uint32 ICU_ECAP_getIntrStatus(uint32 baseAddr, uint32 flag)
     return (value & flag);
 }
 
+uint32 ICU_ECAP_getIntrFlags(uint32 baseAddr, uint32 flag)
+{
+    uint32 temp_addr = baseAddr + CSL_ECAP_ECEINT_ECFLG;
+    uint32 value     = HW_RD_REG32(temp_addr);
+    /* ECFLG is the upper half of the combined ECEINT/ECFLG word */
+    return ((value >> 16) & flag);
+}
+
 void ICU_ECAP_intrStatusClear(uint32 baseAddr, uint32 flag)
 {
     uint32 temp_addr = baseAddr + CSL_ECAP_ECEINT_ECFLG;
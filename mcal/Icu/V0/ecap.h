@@ -133,6 +133,21 @@ extern "C" {
 #define ECAP_CAPTURE_EVENT4_STOP ((uint32)0x03U)
 /** @} */
 
+/**
+ *  \anchor Ecap_DmaEvtSel_t
+ *  \name ECAP capture event triggering the DMA
+ *  @{
+ */
+/** \brief DMA trigger on capture event 1 */
+#define ECAP_DMA_EVT_CEVT1 ((uint32)0x00U)
+/** \brief DMA trigger on capture event 2 */
+#define ECAP_DMA_EVT_CEVT2 ((uint32)0x01U)
+/** \brief DMA trigger on capture event 3 */
+#define ECAP_DMA_EVT_CEVT3 ((uint32)0x02U)
+/** \brief DMA trigger on capture event 4 */
+#define ECAP_DMA_EVT_CEVT4 ((uint32)0x03U)
+/** @} */
+
 /**
  *  \anchor Ecap_APWMPolarityConfig_t
  *  \name ECAP APWM Output Polarity
@@ -468,6 +483,14 @@ void ICU_ECAP_operatingModeSelect(uint32 baseAddr, uint32 modeSelect);
  */
 uint32 ICU_ECAP_timeStampRead(uint32 baseAddr, uint32 capEvtFlag);
 
+/**
+ * \brief   This function reads the time-stamps of all four capture events.
+ *
+ * \param   baseAddr    It is the Memory address of the ECAP instance used.
+ * \param   capPtr      Destination of the CAP1 to CAP4 values, in that order.
+ */
+void ICU_ECAP_timeStampReadAll(uint32 baseAddr, uint32 *capPtr);
+
 /**
  * \brief   This function configures Capture Event polarity.
  *
@@ -522,6 +545,30 @@ void ICU_ECAP_captureEvtCntrRstConfig(uint32 baseAddr, uint32 counterRst1, uint3
  */
 void ICU_ECAP_continousModeConfig(uint32 baseAddr);
 
+/**
+ * \brief   This function configures the capture event after which the
+ *          event sequencer wraps around in Continuous mode.
+ *
+ * \param   baseAddr   It is the Memory address of the ECAP instance used.
+ * \param   stopWrap   Capture event at which to wrap.
+ *
+ *          stopWrap can take one of the following macros.
+ *          - \ref Ecap_StopCaptEvt_t.
+ */
+void ICU_ECAP_captureEvtStopWrapConfig(uint32 baseAddr, uint32 stopWrap);
+
+/**
+ * \brief   This function selects the capture event generating the ECAP DMA
+ *          trigger.
+ *
+ * \param   baseAddr   It is the Memory address of the ECAP instance used.
+ * \param   dmaEvt     Capture event triggering the DMA.
+ *
+ *          dmaEvt can take one of the following macros.
+ *          - \ref Ecap_DmaEvtSel_t.
+ */
+void ICU_ECAP_dmaEvtSelect(uint32 baseAddr, uint32 dmaEvt);
+
 /**
  * \brief   This function configures counter to stop or free running
  *          based on its input argument flag.
@@ -603,6 +650,21 @@ void ICU_ECAP_intrDisable(uint32 baseAddr, uint32 flag);
  */
 uint32 ICU_ECAP_getIntrStatus(uint32 baseAddr, uint32 flag);
 
+/**
+ * \brief   This function returns the pending flags of the specified interrupts
+ *
+ * \param   baseAddr  It is the Memory address of the ECAP instance used.
+ * \param   flag      It is the value which specifies the interrupt flags
+ *                    to be returned.\n
+ *
+ *          flag can take one of the following macros.
+ *          - \ref Ecap_IntrSrc_t.
+ *
+ * \returns Pending flags of the specified interrupts.
+ *
+ */
+uint32 ICU_ECAP_getIntrFlags(uint32 baseAddr, uint32 flag);
+
 /**
  * \brief   This function clears of the status specified interrupts
  *
@@ -215,6 +215,12 @@ extern "C" {
 #define ICU_GETVERSIONINFO_ID ((uint8)0x12U)
 /** \brief Icu_RegisterReadback() API Service ID */
 #define ICU_REGISTERREADBACK_ID ((uint8)0x15U)
+/** \brief Icu_ExtendTimestamp() API Service ID */
+#define ICU_EXTENDTIMESTAMP_ID ((uint8)0x18U)
+/** \brief Icu_StartSignalAveraging() API Service ID */
+#define ICU_STARTSIGNALAVERAGING_ID ((uint8)0x19U)
+/** \brief Icu_GetSignalStatistics() API Service ID */
+#define ICU_GETSIGNALSTATISTICS_ID ((uint8)0x1AU)
 /**   @} */
 
 /**
@@ -252,6 +258,8 @@ extern "C" {
 #define ICU_E_PARAM_NOTIFY_INTERVAL ((uint8)0x18U)
 /** \brief API service Icu_GetVersionInfo called and parameter is invalid */
 #define ICU_E_PARAM_VINFO ((uint8)0x19U)
+/** \brief API service called with an invalid number of averaged periods */
+#define ICU_E_PARAM_NUM_PERIODS ((uint8)0x1AU)
 /**   @} */
 
 /**
@@ -407,10 +415,18 @@ typedef enum
                        CSL_ECAP_ECEINT_ECFLG_CEVT3_MASK | CSL_ECAP_ECEINT_ECFLG_CEVT4_MASK
 } Icu_IntrCapSelect;
 
+#if (ICU_TIMESTAMP_BATCH_API == STD_ON) || (ICU_TIMESTAMP_DMA_API == STD_ON)
+/**
+ *  \brief This type defines Value type, wide enough for the 32-bit ECAP counter
+ *   as needed by the batched and DMA timestamp capture
+ */
+typedef uint32 Icu_ValueType;
+#else
 /**
  *  \brief This type defines Value type
  */
 typedef uint16 Icu_ValueType;
+#endif
 
 /**
  *  \brief This type defines Duty Cycle struct
@@ -423,6 +439,29 @@ typedef struct
     Icu_ValueType PeriodTime;
 } Icu_DutyCycleType;
 
+#if (ICU_SIGNAL_AVERAGING_API == STD_ON)
+/**
+ *  \brief This type defines the averaged signal statistics of one window
+ */
+typedef struct
+{
+    /** \brief Averaged period in ECAP clock ticks */
+    uint32 PeriodTicks;
+    /** \brief Averaged active (high) time in ECAP clock ticks */
+    uint32 ActiveTicks;
+    /** \brief Shortest period of the window in ECAP clock ticks */
+    uint32 MinPeriodTicks;
+    /** \brief Longest period of the window in ECAP clock ticks */
+    uint32 MaxPeriodTicks;
+    /** \brief Averaged frequency in milli Hertz */
+    uint32 FrequencyMilliHz;
+    /** \brief Averaged duty cycle in Q15, 0x8000 is 100% */
+    uint16 DutyQ15;
+    /** \brief Number of periods averaged */
+    uint16 NumPeriods;
+} Icu_SignalStatisticsType;
+#endif
+
 /**
  *  \brief This type defines return value Icu_GetTimeStampIndex
  */
@@ -528,6 +567,10 @@ typedef struct
     uint32                            instanceClkMHz;
     /** \brief Prescaler value to be used for ICU  module */
     uint32                            prescaler;
+#if (ICU_TIMESTAMP_DMA_API == STD_ON)
+    /** \brief Cdd_Dma handler copying the capture registers in Timestamp mode, 0xFF for none */
+    uint32                            dmaHandleId;
+#endif
 } Icu_ChannelConfigType;
 
 /**
@@ -730,6 +773,30 @@ FUNC(void, ICU_CODE) Icu_StopTimestamp(Icu_ChannelType Channel);
  *
  *****************************************************************************/
 FUNC(Icu_IndexType, ICU_CODE) Icu_GetTimestampIndex(Icu_ChannelType Channel);
+
+#if (ICU_TIMESTAMP_BATCH_API == STD_ON)
+/** \brief Service for extending a captured timestamp to 64 bits
+ *
+ *
+ * This service extends a 32-bit timestamp captured on the given channel to
+ * 64 bits using the counter overflows seen since Icu_StartTimestamp. The
+ * timestamp must be less than one counter period (2^32 ticks) old.
+ *
+ *
+ * Service ID[hex] - 0x18
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Channel - Numeric identifier of the ICU channel
+ * \param[in] Timestamp - Value read from the timestamp buffer
+ * \return uint64
+ * \retval 64-bit timestamp, 0 on error
+ *
+ *****************************************************************************/
+FUNC(uint64, ICU_CODE) Icu_ExtendTimestamp(Icu_ChannelType Channel, Icu_ValueType Timestamp);
+#endif
 #endif
 
 #if (ICU_EDGE_COUNT_API == STD_ON)
@@ -888,6 +955,60 @@ FUNC(void, ICU_CODE) Icu_StartSignalMeasurement(Icu_ChannelType Channel);
  *
  *****************************************************************************/
 FUNC(void, ICU_CODE) Icu_StopSignalMeasurement(Icu_ChannelType Channel);
+
+#if (ICU_SIGNAL_AVERAGING_API == STD_ON)
+/** \brief Largest NumPeriods of Icu_StartSignalAveraging, even so that the
+ *  period count never rounds up past the uint16 range */
+#define ICU_SIGNAL_AVG_MAX_PERIODS ((uint16)0xFFFEU)
+
+/** \brief Service for starting the averaged measurement of signals.
+ *
+ *
+ * This service starts a continuous measurement of a given channel. Each
+ * ECAP interrupt delivers two periods, which are accumulated until
+ * NumPeriods periods are collected. The window is then latched for
+ * Icu_GetSignalStatistics and the next window starts. No notification is
+ * given per edge. Icu_StopSignalMeasurement stops the measurement.
+ *
+ *
+ * Service ID[hex] - 0x19
+ *
+ * Sync/Async - Asynchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Channel - Numeric identifier of the ICU channel
+ * \param[in] NumPeriods - Periods per window, 1 to ICU_SIGNAL_AVG_MAX_PERIODS,
+ * rounded up to an even count
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, ICU_CODE) Icu_StartSignalAveraging(Icu_ChannelType Channel, uint16 NumPeriods);
+
+/** \brief Service for reading the averaged signal statistics.
+ *
+ *
+ * This service returns the frequency, duty cycle and period jitter of the
+ * last completed window of a given channel. Each window is returned once.
+ *
+ *
+ * Service ID[hex] - 0x1A
+ *
+ * Sync/Async - Synchronous
+ *
+ * Reentrancy - Reentrant
+ *
+ * \param[in] Channel - Numeric identifier of the ICU channel
+ * \param[out] StatisticsPtr - pointer to store the statistics
+ * \return Std_ReturnType
+ * \retval E_OK - A new window was returned
+ * \retval E_NOT_OK - No window completed since the last call
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, ICU_CODE)
+Icu_GetSignalStatistics(Icu_ChannelType Channel, Icu_SignalStatisticsType* StatisticsPtr);
+#endif
 #endif
 
 #if (ICU_GET_TIME_ELAPSED_API == STD_ON)
@@ -132,6 +132,21 @@ static FUNC(Std_ReturnType, ICU_CODE) Icu_checkStopTimestampErrors(Icu_ChannelTy
 static FUNC(Std_ReturnType, ICU_CODE) Icu_checkGetTimestampIndexErrors(Icu_ChannelType Channel);
 #endif /* (STD_ON == ICU_DEV_ERROR_DETECT) */
 
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_TIMESTAMP_BATCH_API))
+static FUNC(Std_ReturnType, ICU_CODE) Icu_checkExtendTimestampErrors(Icu_ChannelType Channel);
+#endif
+
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_TIMESTAMP_DMA_API))
+static FUNC(Std_ReturnType, ICU_CODE)
+    Icu_checkTimestampDmaErrors(Icu_ChannelType Channel, uint16 BufferSize, uint16 NotifyInterval);
+#endif
+
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_SIGNAL_MEASUREMENT_API) && \
+     (STD_ON == ICU_SIGNAL_AVERAGING_API))
+static FUNC(Std_ReturnType, ICU_CODE)
+    Icu_checkSignalAveragingErrors(uint8 ServiceId, Icu_ChannelType Channel, uint16 NumPeriods);
+#endif
+
 #if (STD_ON == ICU_DEV_ERROR_DETECT)
 static FUNC(Std_ReturnType, ICU_CODE) Icu_checkStopSignalMeasurementErrors(Icu_ChannelType Channel);
 #endif /* (STD_ON == ICU_DEV_ERROR_DETECT) */
@@ -461,7 +476,27 @@ Icu_StartTimestamp(Icu_ChannelType Channel, Icu_ValueType* BufferPtr, uint16 Buf
 
 #if (STD_ON == ICU_DEV_ERROR_DETECT)
     retVal = Icu_checkStartTimestampErrors(Channel, BufferPtr, BufferSize);
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        retVal = Icu_checkTimestampDmaErrors(Channel, BufferSize, NotifyInterval);
+    }
+#endif
 #endif /* (STD_ON == ICU_DEV_ERROR_DETECT) */
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+    /* The PaRAM sets of the block chain are written without bound checks
+     * when the DMA DET is off, so the chain must fit the handler. */
+    if ((((Std_ReturnType)E_OK) == retVal) && (Icu_ChObj[Channel].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID))
+    {
+        retVal = Icu_TimestampDma_CheckParamSets(Channel, BufferSize, NotifyInterval);
+#if (STD_ON == ICU_DEV_ERROR_DETECT)
+        if (((Std_ReturnType)E_OK) != retVal)
+        {
+            (void)Icu_reportDetError(ICU_STARTTIMESTAMP_ID, ICU_E_PARAM_BUFFER_SIZE);
+        }
+#endif
+    }
+#endif
     if (((Std_ReturnType)E_OK) == retVal)
     {
         baseAddr = Icu_ChObj[Channel].baseAddr;
@@ -469,8 +504,27 @@ Icu_StartTimestamp(Icu_ChannelType Channel, Icu_ValueType* BufferPtr, uint16 Buf
 
         Icu_TimeStamp_Init(Channel, BufferPtr, BufferSize, NotifyInterval);
 
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+        if (Icu_ChObj[Channel].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID)
+        {
+            Icu_TimestampDma_Start(Channel);
+        }
+        else
+#endif
+        {
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+        /* Continuous 4-event capture, one interrupt per CAP1..CAP4 batch plus
+         * counter overflow for the 64-bit extension */
+        Icu_ConfigEcap(baseAddr, Icu_ChObj[Channel].activation_edge, ICU_ABSOLUTE_MODE, TRUE,
+                       (Icu_IntrCapSelect)ECAP_CEVT4_INT);
+        ICU_ECAP_captureEvtStopWrapConfig(baseAddr, ECAP_CAPTURE_EVENT4_STOP);
+        ECAP_reArm(baseAddr);
+        ICU_ECAP_intrEnable(baseAddr, (uint16)ECAP_CNTOVF_INT);
+#else
         Icu_ConfigEcap(baseAddr, Icu_ChObj[Channel].activation_edge, ICU_ABSOLUTE_MODE, TRUE,
                        Icu_ChObj[Channel].chCfg.intrcapSelect);
+#endif
+        }
 
         Icu_ChObj[Channel].IsRunning = TRUE;
         Icu_ChObj[Channel].IsActive  = TRUE;
@@ -509,6 +563,13 @@ FUNC(void, ICU_CODE) Icu_StopTimestamp(Icu_ChannelType Channel)
             /* Disable CAP1-CAP4 register loads */
             ICU_ECAP_captureLoadingDisable(baseAddr);
 
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            if (Icu_ChObj[Channel].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID)
+            {
+                Icu_TimestampDma_Stop(Channel);
+            }
+#endif
+
             Icu_TimeStamp_Clear(Channel);
 
             Icu_ChObj[Channel].IsRunning = FALSE;
@@ -537,6 +598,13 @@ FUNC(Icu_IndexType, ICU_CODE) Icu_GetTimestampIndex(Icu_ChannelType Channel)
         if ((Icu_ChObj[Channel].IsActive) != (uint32)0U)
         {
             index = Icu_ChObj[Channel].NextTimeStampIndex;
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            if (Icu_ChObj[Channel].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID)
+            {
+                /* No per-edge interrupt - the DMA destination is the index */
+                index = Icu_TimestampDma_GetIndex(Channel);
+            }
+#endif
         }
         else
         {
@@ -548,6 +616,33 @@ FUNC(Icu_IndexType, ICU_CODE) Icu_GetTimestampIndex(Icu_ChannelType Channel)
     return index;
 }
 
+#if (STD_ON == ICU_TIMESTAMP_BATCH_API)
+FUNC(uint64, ICU_CODE) Icu_ExtendTimestamp(Icu_ChannelType Channel, Icu_ValueType Timestamp)
+{
+    uint64 timestamp64                    = 0U;
+    VAR(Std_ReturnType, AUTOMATIC) retVal = E_OK;
+
+#if (STD_ON == ICU_DEV_ERROR_DETECT)
+    retVal = Icu_checkExtendTimestampErrors(Channel);
+#endif
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        SchM_Enter_Icu_ICU_EXCLUSIVE_AREA_0();
+        if ((Icu_ChObj[Channel].IsActive) != (uint32)0U)
+        {
+            timestamp64 = Icu_TimestampBatch_Extend(Channel, Timestamp);
+        }
+        else
+        {
+            /*return 0*/
+        }
+        SchM_Exit_Icu_ICU_EXCLUSIVE_AREA_0();
+    }
+
+    return timestamp64;
+}
+#endif /* ICU_TIMESTAMP_BATCH_API */
+
 #endif /* ICU_TIMESTAMP_API*/
 
 #if (STD_ON == ICU_EDGE_COUNT_API)
@@ -775,6 +870,9 @@ FUNC(void, ICU_CODE) Icu_StopSignalMeasurement(Icu_ChannelType Channel)
             Icu_ChObj[Channel].PeriodAcquired       = TRUE;
         }
 
+#if (STD_ON == ICU_SIGNAL_AVERAGING_API)
+        Icu_ChObj[Channel].AvgNumPeriods = 0U;
+#endif
         Icu_ChObj[Channel].IsRunning = FALSE;
         SchM_Exit_Icu_ICU_EXCLUSIVE_AREA_0();
     }
@@ -782,6 +880,81 @@ FUNC(void, ICU_CODE) Icu_StopSignalMeasurement(Icu_ChannelType Channel)
     return;
 }
 
+#if (STD_ON == ICU_SIGNAL_AVERAGING_API)
+FUNC(void, ICU_CODE) Icu_StartSignalAveraging(Icu_ChannelType Channel, uint16 NumPeriods)
+{
+    uint32 baseAddr;
+    VAR(Std_ReturnType, AUTOMATIC) retVal = E_OK;
+
+#if (STD_ON == ICU_DEV_ERROR_DETECT)
+    retVal = Icu_checkSignalAveragingErrors(ICU_STARTSIGNALAVERAGING_ID, Channel, NumPeriods);
+#endif /* (STD_ON == ICU_DEV_ERROR_DETECT) */
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        baseAddr = Icu_ChObj[Channel].baseAddr;
+        SchM_Enter_Icu_ICU_EXCLUSIVE_AREA_0();
+
+        Icu_ChObj[Channel].InputState = ICU_IDLE;
+
+        Icu_SignalMeasurement_Init(Channel);
+        Icu_ChObj[Channel].AvgNumPeriods = NumPeriods;
+
+        /* Continuous delta capture of both edges, one interrupt per two periods */
+        Icu_ConfigEcap(baseAddr, ICU_BOTH_EDGES, ICU_DELTA_MODE, FALSE, Icu_ChObj[Channel].chCfg.intrcapSelect);
+        ICU_ECAP_captureEvtStopWrapConfig(baseAddr, ECAP_CAPTURE_EVENT4_STOP);
+        ECAP_reArm(baseAddr);
+        ICU_ECAP_intrEnable(baseAddr, (uint16)((uint32)ECAP_CEVT4_INT | (uint32)ECAP_CNTOVF_INT));
+
+        Icu_ChObj[Channel].IsRunning = TRUE;
+        SchM_Exit_Icu_ICU_EXCLUSIVE_AREA_0();
+    }
+
+    return;
+}
+
+FUNC(Std_ReturnType, ICU_CODE)
+Icu_GetSignalStatistics(Icu_ChannelType Channel, Icu_SignalStatisticsType* StatisticsPtr)
+{
+    Icu_SignalAvgType avgWindow;
+    VAR(Std_ReturnType, AUTOMATIC) retVal = E_OK;
+
+#if (STD_ON == ICU_DEV_ERROR_DETECT)
+    retVal = Icu_checkSignalAveragingErrors(ICU_GETSIGNALSTATISTICS_ID, Channel, 1U);
+    if ((NULL_PTR == StatisticsPtr) && (retVal == (Std_ReturnType)E_OK))
+    {
+        (void)Icu_reportDetError(ICU_GETSIGNALSTATISTICS_ID, ICU_E_PARAM_POINTER);
+        retVal = E_NOT_OK;
+    }
+#endif /* (STD_ON == ICU_DEV_ERROR_DETECT) */
+    if (((Std_ReturnType)E_OK) == retVal)
+    {
+        SchM_Enter_Icu_ICU_EXCLUSIVE_AREA_0();
+        avgWindow = Icu_ChObj[Channel].AvgLatch;
+        if (Icu_ChObj[Channel].AvgLatched == TRUE)
+        {
+            Icu_ChObj[Channel].AvgLatched = FALSE;
+        }
+        else
+        {
+            retVal = E_NOT_OK;
+        }
+        SchM_Exit_Icu_ICU_EXCLUSIVE_AREA_0();
+
+        /* Divisions run outside the exclusive area on the copied window */
+        if ((((Std_ReturnType)E_OK) == retVal) && (avgWindow.PeriodSum != 0U))
+        {
+            Icu_SignalAveraging_Compute(Channel, &avgWindow, StatisticsPtr);
+        }
+        else
+        {
+            retVal = E_NOT_OK;
+        }
+    }
+
+    return retVal;
+}
+#endif /* ICU_SIGNAL_AVERAGING_API */
+
 #endif /* ICU_SIGNAL_MEASUREMENT_API*/
 
 /*
@@ -956,6 +1129,13 @@ static FUNC(void, ICU_CODE) Icu_CheckInit_Internal(uint32 chNum, const Icu_Confi
 
 #if (STD_ON == ICU_TIMESTAMP_API)
             Icu_ChObj[chIdx].IsActive = FALSE;
+#endif
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            if (Icu_ChObj[chIdx].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID)
+            {
+                (void)Cdd_Dma_CbkRegister(Icu_ChObj[chIdx].chCfg.dmaHandleId, (void *)chIdx,
+                                          &Icu_TimestampDma_Callback);
+            }
 #endif
             break;
         }
@@ -1140,6 +1320,103 @@ static FUNC(Std_ReturnType, ICU_CODE) Icu_checkGetTimestampIndexErrors(Icu_Chann
 }
 #endif
 
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_TIMESTAMP_BATCH_API))
+static FUNC(Std_ReturnType, ICU_CODE) Icu_checkExtendTimestampErrors(Icu_ChannelType Channel)
+{
+    Std_ReturnType retVal = E_OK;
+    if (ICU_STATUS_UNINIT == Icu_DrvStatus)
+    {
+        (void)Icu_reportDetError(ICU_EXTENDTIMESTAMP_ID, ICU_E_UNINIT);
+        retVal = E_NOT_OK;
+    }
+
+    if (retVal == (Std_ReturnType)E_OK)
+    {
+        if (ICU_MAX_NUM_CHANNELS <= Channel)
+        {
+            (void)Icu_reportDetError(ICU_EXTENDTIMESTAMP_ID, ICU_E_PARAM_CHANNEL);
+            retVal = E_NOT_OK;
+        }
+        else
+        {
+            if (ICU_MODE_TIMESTAMP != Icu_ChObj[Channel].chCfg.measurementMode)
+            {
+                (void)Icu_reportDetError(ICU_EXTENDTIMESTAMP_ID, ICU_E_PARAM_CHANNEL);
+                retVal = E_NOT_OK;
+            }
+        }
+    }
+    return retVal;
+}
+#endif
+
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_TIMESTAMP_DMA_API))
+static FUNC(Std_ReturnType, ICU_CODE)
+    Icu_checkTimestampDmaErrors(Icu_ChannelType Channel, uint16 BufferSize, uint16 NotifyInterval)
+{
+    Std_ReturnType retVal = E_OK;
+
+    if (Icu_ChObj[Channel].chCfg.dmaHandleId != ICU_DMA_HANDLE_INVALID)
+    {
+        /* DMA moves whole CAP1..CAP4 batches and one block per NotifyInterval */
+        if ((BufferSize % ICU_TIMESTAMP_BATCH_SIZE) != 0U)
+        {
+            (void)Icu_reportDetError(ICU_STARTTIMESTAMP_ID, ICU_E_PARAM_BUFFER_SIZE);
+            retVal = E_NOT_OK;
+        }
+        else if (((NotifyInterval % ICU_TIMESTAMP_BATCH_SIZE) != 0U) ||
+                 ((NotifyInterval > 0U) && ((BufferSize % NotifyInterval) != 0U)))
+        {
+            (void)Icu_reportDetError(ICU_STARTTIMESTAMP_ID, ICU_E_PARAM_NOTIFY_INTERVAL);
+            retVal = E_NOT_OK;
+        }
+        else
+        {
+            /* No Actions Required. */
+        }
+    }
+    return retVal;
+}
+#endif
+
+#if ((STD_ON == ICU_DEV_ERROR_DETECT) && (STD_ON == ICU_SIGNAL_MEASUREMENT_API) && \
+     (STD_ON == ICU_SIGNAL_AVERAGING_API))
+static FUNC(Std_ReturnType, ICU_CODE)
+    Icu_checkSignalAveragingErrors(uint8 ServiceId, Icu_ChannelType Channel, uint16 NumPeriods)
+{
+    Std_ReturnType retVal = E_OK;
+    if (ICU_STATUS_UNINIT == Icu_DrvStatus)
+    {
+        (void)Icu_reportDetError(ServiceId, ICU_E_UNINIT);
+        retVal = E_NOT_OK;
+    }
+
+    if (retVal == (Std_ReturnType)E_OK)
+    {
+        if (ICU_MAX_NUM_CHANNELS <= Channel)
+        {
+            (void)Icu_reportDetError(ServiceId, ICU_E_PARAM_CHANNEL);
+            retVal = E_NOT_OK;
+        }
+        else if (ICU_MODE_SIGNAL_MEASUREMENT != Icu_ChObj[Channel].chCfg.measurementMode)
+        {
+            (void)Icu_reportDetError(ServiceId, ICU_E_PARAM_CHANNEL);
+            retVal = E_NOT_OK;
+        }
+        else if ((0U == NumPeriods) || (NumPeriods > ICU_SIGNAL_AVG_MAX_PERIODS))
+        {
+            (void)Icu_reportDetError(ServiceId, ICU_E_PARAM_NUM_PERIODS);
+            retVal = E_NOT_OK;
+        }
+        else
+        {
+            /* No Actions Required. */
+        }
+    }
+    return retVal;
+}
+#endif
+
 #if (STD_ON == ICU_DEV_ERROR_DETECT)
 static FUNC(Std_ReturnType, ICU_CODE) Icu_checkStopSignalMeasurementErrors(Icu_ChannelType Channel)
 {
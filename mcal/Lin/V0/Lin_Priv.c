@@ -63,6 +63,9 @@
  *********************************************************************************************************************/
 #include "Lin_Priv.h"
 #include "sys_pmu.h"
+#if (STD_ON == LIN_STATISTICS_API)
+#include <string.h>
+#endif
 
 /*********************************************************************************************************************
  * Version Check (if required)
@@ -88,6 +91,16 @@
 /** \brief  Max data length of the LIN SDU */
 #define LIN_MAX_DATA_LENGTH (8U)
 
+#if (STD_ON == LIN_STATISTICS_API)
+/** \brief  Last histogram bin */
+#define LIN_STATS_HIST_LAST (LIN_STATS_HIST_BINS - 1U)
+#endif
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/** \brief  Interrupts completing a slave response slot of the schedule table */
+#define LIN_SCHEDULE_RX_INT (LIN_INT_RX | LIN_INT_NRE | LIN_INT_CE | LIN_INT_OE | LIN_INT_PE)
+#endif
+
 /**
  * \brief LIN MCAL library delay in counts
  *
@@ -109,6 +122,45 @@
 /*********************************************************************************************************************
  * Local Type Declarations
  *********************************************************************************************************************/
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/* Register image of one schedule slot, computed once by Lin_ScheduleHwStart */
+typedef struct Lin_SlotImageTag
+{
+    uint32                gcr1;     /* SCIGCR1 TXENA, RXENA and CTYPE bits */
+    uint32                mask;     /* LINMASK with both TX and RX ID masks */
+    uint32                format;   /* SCIFORMAT LENGTH field */
+    uint32                intFlags; /* Completion interrupts, 0 when the slot is checked on the next tick */
+    Lin_FramePidType      pid;
+    Lin_FrameResponseType drc;
+    uint8                 dl;
+} Lin_SlotImageType;
+
+typedef struct Lin_ScheduleTag
+{
+    P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) table;
+    Lin_ScheduleNotifyType notify;
+    Lin_SlotImageType      image[LIN_SCHEDULE_MAX_ENTRIES];
+    uint16                 ticksLeft;
+    uint8                  numEntries;
+    uint8                  curEntry;
+    boolean                active;
+    boolean                txPending; /* Master response of curEntry not yet checked */
+    boolean                rxPending; /* Slave response of curEntry not yet received */
+} Lin_ScheduleType;
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+/* Measurement state behind Lin_StatisticsType */
+typedef struct Lin_StatsStateTag
+{
+    uint32  headerCycles;    /* PMU cycles at the ID write of the running frame */
+    boolean headerValid;     /* headerCycles belongs to a frame not yet accounted */
+    boolean slotStarted;     /* At least one slot started since Lin_ScheduleStart */
+    uint32  slotCycles;      /* PMU cycles at the start of the last slot */
+    uint64  scheduleCycles;  /* Cycles from the first slot start to the last one */
+    uint32  scheduleTicks;   /* Schedule ticks in scheduleCycles */
+} Lin_StatsStateType;
+#endif
 
 /*********************************************************************************************************************
  * Exported Object Definitions
@@ -129,6 +181,24 @@ static VAR(uint8, LIN_VAR) Lin_RxShadowBuffer[LIN_MAX_CHANNEL][LIN_MAX_DATA_LENG
 #define LIN_STOP_SEC_VAR_NO_INIT_8
 #include "Lin_MemMap.h"
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+#define LIN_START_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Lin_MemMap.h"
+static VAR(Lin_ScheduleType, LIN_VAR) Lin_Schedule[LIN_MAX_CHANNEL];
+#define LIN_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Lin_MemMap.h"
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+#define LIN_START_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Lin_MemMap.h"
+/* Cleared by Lin_StatsReset from Lin_Init */
+static VAR(Lin_StatisticsType, LIN_VAR) Lin_Stats[LIN_MAX_CHANNEL];
+static VAR(Lin_StatsStateType, LIN_VAR) Lin_StatsState[LIN_MAX_CHANNEL];
+#define LIN_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+#include "Lin_MemMap.h"
+#endif
+
 /*********************************************************************************************************************
  *  Local Function Prototypes
  *********************************************************************************************************************/
@@ -394,6 +464,80 @@ LOCAL_INLINE FUNC(void, LIN_CODE) Lin_ServiceInterrupts(uint32 base, Lin_Interru
  **/
 static FUNC(void, LIN_CODE) Lin_SetLoopbackMode(uint32 base, Lin_LoopbackModeType loopbackMode);
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/**
+ * \brief   This API will pack up to 4 SDU bytes into a LINTDx word, first byte in the MSB.
+ *
+ * \param   data      Pointer to the first byte.
+ * \param   count     Number of bytes to pack.
+ *
+ * \return  LINTDx register value.
+ *
+ **/
+LOCAL_INLINE FUNC(uint32, LIN_CODE) Lin_PackTxWord(P2CONST(uint8, AUTOMATIC, LIN_APPL_DATA) data, uint32 count);
+
+/**
+ * \brief   This API will start one schedule slot from its register image.
+ *
+ * \param   base      Base address of Lin Instance.
+ * \param   image     Register image of the slot.
+ * \param   sduPtr    Data of a master response slot.
+ *
+ * \return  None.
+ *
+ **/
+static FUNC(void, LIN_CODE) Lin_ScheduleSendSlot(uint32 base, P2CONST(Lin_SlotImageType, AUTOMATIC, LIN_VAR) image,
+                                                 P2CONST(uint8, AUTOMATIC, LIN_APPL_DATA) sduPtr);
+
+/**
+ * \brief   This API will complete a slave response slot and call the notification.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   base           Base address of Lin Instance.
+ * \param   status         Receive status of the slot.
+ *
+ * \return  None.
+ *
+ **/
+static FUNC(void, LIN_CODE) Lin_ScheduleRxDone(uint8 channelID, uint32 base, Lin_StatusType status, boolean fromIsr);
+
+/**
+ * \brief   This API will complete the current slot of the schedule table before the next one starts.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   base           Base address of Lin Instance.
+ *
+ * \return  None.
+ *
+ **/
+static FUNC(void, LIN_CODE) Lin_ScheduleCloseSlot(uint8 channelID, uint32 base);
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+/**
+ * \brief   This API will return the histogram bin of a cycle count, i.e. its bit length.
+ *
+ * \param   cycles      Value to classify.
+ *
+ * \return  Bin index, 0 to LIN_STATS_HIST_LAST.
+ *
+ **/
+LOCAL_INLINE FUNC(uint32, LIN_CODE) Lin_StatsBin(uint32 cycles);
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/**
+ * \brief   This API will account the start of a schedule slot for the slot jitter.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   prevDelay      Length in ticks of the slot that ends now, 0 for the first slot.
+ *
+ * \return  None.
+ *
+ **/
+static FUNC(void, LIN_CODE) Lin_StatsRecordSlotStart(uint8 channelID, uint16 prevDelay);
+#endif
+#endif
+
 /*********************************************************************************************************************
  *  External Functions Definition
  *********************************************************************************************************************/
@@ -702,6 +846,31 @@ FUNC(void, LIN_CODE) Lin_ProcessISR(uint32 channelID)
     uint32               lin_cnt_base_addr = Lin_Drv_Config_Ptr->linChannelCfg[channelID].linControllerConfig.CntrAddr;
     Lin_InterruptLineNum int_line = Lin_Drv_Config_Ptr->linChannelCfg[channelID].linControllerConfig.IntrLineNum;
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+    if (TRUE == Lin_Schedule[channelID].rxPending)
+    {
+        /* Slave response of the running schedule slot */
+        Lin_StatusType status = Lin_FetchRxStatus(lin_cnt_base_addr);
+
+        if (LIN_RX_BUSY != status)
+        {
+            Lin_ScheduleRxDone((uint8)channelID, lin_cnt_base_addr, status, TRUE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Clear Global Interrupt Flag Bit */
+        HW_WR_REG32((lin_cnt_base_addr + CSL_LIN_LIN_GLB_INT_CLR),
+                    (uint32)CSL_LIN_LIN_GLB_INT_CLR_INT0_FLG_CLR_MASK << (uint8)(int_line));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+
     if ((TRUE == Lin_Drv_Config_Ptr->linChannelCfg[channelID].linChannelWakeupSupport) &&
         (((HW_RD_REG32(lin_cnt_base_addr + CSL_LIN_SCIFLR) & CSL_LIN_SCIFLR_WAKEUP_MASK) ==
           CSL_LIN_SCIFLR_WAKEUP_MASK)))
@@ -817,6 +986,247 @@ FUNC(Std_ReturnType, LIN_CODE) Lin_SendGoToSleepSignal(uint32 base)
 
     return return_value;
 }
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+FUNC(void, LIN_CODE) Lin_ScheduleHwInit(uint8 channelID)
+{
+    Lin_Schedule[channelID].table      = (const Lin_ScheduleEntryType *)NULL_PTR;
+    Lin_Schedule[channelID].notify     = (Lin_ScheduleNotifyType)NULL_PTR;
+    Lin_Schedule[channelID].numEntries = 0U;
+    Lin_Schedule[channelID].curEntry   = 0U;
+    Lin_Schedule[channelID].ticksLeft  = 0U;
+    Lin_Schedule[channelID].active     = FALSE;
+    Lin_Schedule[channelID].txPending  = FALSE;
+    Lin_Schedule[channelID].rxPending  = FALSE;
+}
+
+FUNC(void, LIN_CODE)
+Lin_ScheduleHwStart(uint8 channelID, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) table, uint8 numEntries,
+                    Lin_ScheduleNotifyType notify)
+{
+    P2CONST(Lin_ControllerType, AUTOMATIC, LIN_APPL_CONST) cntr =
+        &Lin_Drv_Config_Ptr->linChannelCfg[channelID].linControllerConfig;
+    Lin_ScheduleType *sched = &Lin_Schedule[channelID];
+    uint8             idx;
+
+    /* Resolve the per frame register writes of Lin_SendData once for the whole table */
+    for (idx = 0U; idx < numEntries; idx++)
+    {
+        P2CONST(Lin_PduType, AUTOMATIC, LIN_APPL_CONST) pdu = &table[idx].Pdu;
+        Lin_SlotImageType *image                            = &sched->image[idx];
+
+        image->gcr1 = (uint32)CSL_LIN_SCIGCR1_TXENA_MASK | (uint32)CSL_LIN_SCIGCR1_RXENA_MASK;
+        if (LIN_ENHANCED_CS == pdu->Cs)
+        {
+            image->gcr1 |= (uint32)CSL_LIN_SCIGCR1_CTYPE_MASK;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* A zero ID mask keeps the controller from sending respectively accepting a response */
+        if (LIN_MASTER_RESPONSE == pdu->Drc)
+        {
+            image->mask     = ((uint32)pdu->Pid << CSL_LIN_LINMASK_TXIDMASK_SHIFT) & CSL_LIN_LINMASK_TXIDMASK_MASK;
+            image->intFlags = 0U;
+        }
+        else if (LIN_SLAVE_RESPONSE == pdu->Drc)
+        {
+            image->mask     = ((uint32)pdu->Pid << CSL_LIN_LINMASK_RXIDMASK_SHIFT) & CSL_LIN_LINMASK_RXIDMASK_MASK;
+            image->intFlags = LIN_SCHEDULE_RX_INT;
+        }
+        else
+        {
+            image->mask     = 0U;
+            image->intFlags = 0U;
+        }
+
+        image->format =
+            (((uint32)pdu->Dl - 1U) << CSL_LIN_SCIFORMAT_LENGTH_SHIFT) & (uint32)CSL_LIN_SCIFORMAT_LENGTH_MASK;
+        image->pid = pdu->Pid;
+        image->drc = pdu->Drc;
+        image->dl  = pdu->Dl;
+    }
+
+    /* Route the slave response interrupts to the configured line, they are armed per slot */
+    Lin_EnableInterrupt(cntr->CntrAddr, cntr->IntrLineNum, LIN_SCHEDULE_RX_INT);
+    Lin_DisableInterrupt(cntr->CntrAddr, LIN_SCHEDULE_RX_INT);
+
+    sched->table      = table;
+    sched->notify     = notify;
+    sched->numEntries = numEntries;
+    /* The first tick closes the (empty) last slot and starts entry 0 */
+    sched->curEntry   = numEntries - 1U;
+    sched->ticksLeft  = 1U;
+    sched->txPending  = FALSE;
+    sched->rxPending  = FALSE;
+    sched->active     = TRUE;
+
+#if (STD_ON == LIN_STATISTICS_API)
+    Lin_StatsState[channelID].slotStarted = FALSE;
+#endif
+}
+
+FUNC(void, LIN_CODE) Lin_ScheduleHwStop(uint8 channelID)
+{
+    uint32 lin_cnt_base_addr = Lin_Drv_Config_Ptr->linChannelCfg[channelID].linControllerConfig.CntrAddr;
+
+    Lin_DisableInterrupt(lin_cnt_base_addr, LIN_SCHEDULE_RX_INT);
+    Lin_ScheduleHwInit(channelID);
+}
+
+FUNC(void, LIN_CODE) Lin_ScheduleHwTick(uint8 channelID)
+{
+    uint32            lin_cnt_base_addr = Lin_Drv_Config_Ptr->linChannelCfg[channelID].linControllerConfig.CntrAddr;
+    Lin_ScheduleType *sched             = &Lin_Schedule[channelID];
+
+    if (TRUE == sched->active)
+    {
+        sched->ticksLeft--;
+        if (0U == sched->ticksLeft)
+        {
+#if (STD_ON == LIN_STATISTICS_API)
+            uint16 prevDelay = sched->table[sched->curEntry].Delay;
+#endif
+            Lin_ScheduleCloseSlot(channelID, lin_cnt_base_addr);
+
+            sched->curEntry++;
+            if (sched->curEntry >= sched->numEntries)
+            {
+                sched->curEntry = 0U;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            Lin_ScheduleSendSlot(lin_cnt_base_addr, &sched->image[sched->curEntry],
+                                 sched->table[sched->curEntry].Pdu.SduPtr);
+#if (STD_ON == LIN_STATISTICS_API)
+            Lin_StatsRecordHeader(channelID);
+            Lin_StatsRecordSlotStart(channelID, prevDelay);
+#endif
+
+            sched->txPending = (boolean)(LIN_MASTER_RESPONSE == sched->image[sched->curEntry].drc);
+            sched->rxPending = (boolean)(LIN_SLAVE_RESPONSE == sched->image[sched->curEntry].drc);
+            sched->ticksLeft = sched->table[sched->curEntry].Delay;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+FUNC(boolean, LIN_CODE) Lin_ScheduleHwIsActive(uint8 channelID)
+{
+    return Lin_Schedule[channelID].active;
+}
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+FUNC(void, LIN_CODE) Lin_StatsReset(uint8 channelID)
+{
+    (void)memset(&Lin_Stats[channelID], 0, sizeof(Lin_StatisticsType));
+    (void)memset(&Lin_StatsState[channelID], 0, sizeof(Lin_StatsStateType));
+}
+
+FUNC(void, LIN_CODE) Lin_StatsSnapshot(uint8 channelID, P2VAR(Lin_StatisticsType, AUTOMATIC, LIN_APPL_DATA) statsPtr)
+{
+    *statsPtr = Lin_Stats[channelID];
+}
+
+FUNC(void, LIN_CODE) Lin_StatsRecordHeader(uint8 channelID)
+{
+    uint32 cycles = 0U;
+
+    Mcal_GetCycleCounterValue(&cycles);
+    Lin_StatsState[channelID].headerCycles = cycles;
+    Lin_StatsState[channelID].headerValid  = TRUE;
+}
+
+FUNC(void, LIN_CODE) Lin_StatsRecordStatus(uint8 channelID, Lin_StatusType status, boolean fromIsr)
+{
+    Lin_StatisticsType *stats      = &Lin_Stats[channelID];
+    boolean             isComplete = TRUE;
+    boolean             isOk       = FALSE;
+
+    switch (status)
+    {
+        case LIN_TX_OK:
+            stats->txOkCount++;
+            isOk = TRUE;
+            break;
+        case LIN_TX_HEADER_ERROR:
+            stats->txHeaderErrorCount++;
+            break;
+        case LIN_TX_ERROR:
+            stats->txErrorCount++;
+            break;
+        case LIN_RX_OK:
+            stats->rxOkCount++;
+            isOk = TRUE;
+            break;
+        case LIN_RX_ERROR:
+            stats->rxErrorCount++;
+            break;
+        case LIN_RX_NO_RESPONSE:
+            stats->rxNoResponseCount++;
+            break;
+        default:
+            /* Busy or not a frame status */
+            isComplete = FALSE;
+            break;
+    }
+
+    if ((TRUE == isOk) && (TRUE == Lin_StatsState[channelID].headerValid))
+    {
+        uint32 cycles = 0U;
+        uint32 latency;
+
+        Mcal_GetCycleCounterValue(&cycles);
+        /* Unsigned subtraction handles a single wrap of the 32-bit cycle counter */
+        latency = cycles - Lin_StatsState[channelID].headerCycles;
+
+        if (TRUE == fromIsr)
+        {
+            if ((0U == stats->latencyCount) || (latency < stats->minLatencyCycles))
+            {
+                stats->minLatencyCycles = latency;
+            }
+            if (latency > stats->maxLatencyCycles)
+            {
+                stats->maxLatencyCycles = latency;
+            }
+            stats->lastLatencyCycles   = latency;
+            stats->totalLatencyCycles += (uint64)latency;
+            stats->latencyCount++;
+            stats->latencyHist[Lin_StatsBin(latency)]++;
+        }
+        else
+        {
+            /* A polled completion is only seen at the poll, keep it out of the response latency */
+            if (latency > stats->maxPolledLatencyCycles)
+            {
+                stats->maxPolledLatencyCycles = latency;
+            }
+            stats->lastPolledLatencyCycles   = latency;
+            stats->totalPolledLatencyCycles += (uint64)latency;
+            stats->polledLatencyCount++;
+        }
+    }
+
+    if (TRUE == isComplete)
+    {
+        Lin_StatsState[channelID].headerValid = FALSE;
+    }
+}
+#endif
 /*********************************************************************************************************************
  *  Local Functions Definition
  *********************************************************************************************************************/
@@ -1084,6 +1494,236 @@ static FUNC(void, LIN_CODE) Lin_SetLoopbackMode(uint32 base, Lin_LoopbackModeTyp
     }
 }
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+LOCAL_INLINE FUNC(uint32, LIN_CODE) Lin_PackTxWord(P2CONST(uint8, AUTOMATIC, LIN_APPL_DATA) data, uint32 count)
+{
+    uint32 word = 0U;
+    uint32 i;
+
+    for (i = 0U; i < count; i++)
+    {
+        word |= (uint32)data[i] << (24U - (8U * i));
+    }
+
+    return word;
+}
+
+static FUNC(void, LIN_CODE) Lin_ScheduleSendSlot(uint32 base, P2CONST(Lin_SlotImageType, AUTOMATIC, LIN_VAR) image,
+                                                 P2CONST(uint8, AUTOMATIC, LIN_APPL_DATA) sduPtr)
+{
+    uint32 regVal;
+
+    /* Drop status flags of the previous slot so that they are not taken for this one */
+    HW_WR_REG32((base + CSL_LIN_SCIFLR), LIN_INT_ALL);
+
+    /* Transmit enable, receive enable and checksum type in a single read-modify-write */
+    regVal = HW_RD_REG32(base + CSL_LIN_SCIGCR1) & ~(uint32)CSL_LIN_SCIGCR1_CTYPE_MASK;
+    HW_WR_REG32((base + CSL_LIN_SCIGCR1), (regVal | image->gcr1));
+
+    /* TX and RX ID masks */
+    HW_WR_REG32((base + CSL_LIN_LINMASK), image->mask);
+
+    /* Frame length */
+    regVal = HW_RD_REG32(base + CSL_LIN_SCIFORMAT) & ~(uint32)CSL_LIN_SCIFORMAT_LENGTH_MASK;
+    HW_WR_REG32((base + CSL_LIN_SCIFORMAT), (regVal | image->format));
+
+    if (LIN_MASTER_RESPONSE == image->drc)
+    {
+        /* Load the response before the header goes out, byte 0 is the MSB of LINTD0 */
+        if (image->dl > 4U)
+        {
+            HW_WR_REG32((base + CSL_LIN_LINTD1), Lin_PackTxWord(&sduPtr[4], (uint32)image->dl - 4U));
+            HW_WR_REG32((base + CSL_LIN_LINTD0), Lin_PackTxWord(sduPtr, 4U));
+        }
+        else
+        {
+            HW_WR_REG32((base + CSL_LIN_LINTD0), Lin_PackTxWord(sduPtr, (uint32)image->dl));
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (0U != image->intFlags)
+    {
+        HW_WR_REG32((base + CSL_LIN_SCISETINT), image->intFlags);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Writing the ID starts the header transmission */
+    HW_WR_REG32((base + CSL_LIN_LINID), (uint32)image->pid);
+}
+
+static FUNC(void, LIN_CODE) Lin_ScheduleRxDone(uint8 channelID, uint32 base, Lin_StatusType status, boolean fromIsr)
+{
+    Lin_ScheduleType *sched  = &Lin_Schedule[channelID];
+    const uint8      *sduPtr = (const uint8 *)NULL_PTR;
+
+    Lin_DisableInterrupt(base, LIN_SCHEDULE_RX_INT);
+    sched->rxPending = FALSE;
+#if (STD_ON == LIN_STATISTICS_API)
+    Lin_StatsRecordStatus(channelID, status, fromIsr);
+#else
+    (void)fromIsr;
+#endif
+
+    if (LIN_RX_OK == status)
+    {
+        uint32 rd0 = HW_RD_REG32(base + CSL_LIN_LINRD0);
+        uint32 rd1 = HW_RD_REG32(base + CSL_LIN_LINRD1);
+        uint8  i;
+
+        /* Byte 0 is the MSB of LINRD0, unused bytes of a short frame are copied as well */
+        for (i = 0U; i < 4U; i++)
+        {
+            Lin_RxShadowBuffer[channelID][i]      = (uint8)(rd0 >> (24U - (8U * (uint32)i)));
+            Lin_RxShadowBuffer[channelID][i + 4U] = (uint8)(rd1 >> (24U - (8U * (uint32)i)));
+        }
+        sduPtr = Lin_RxShadowBuffer[channelID];
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (NULL_PTR != sched->notify)
+    {
+        sched->notify(channelID, sched->curEntry, status, sduPtr);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+static FUNC(void, LIN_CODE) Lin_ScheduleCloseSlot(uint8 channelID, uint32 base)
+{
+    Lin_ScheduleType *sched = &Lin_Schedule[channelID];
+
+    if (TRUE == sched->txPending)
+    {
+        /* Master responses are not interrupt driven, their status is final once the slot time is over */
+        Lin_StatusType status = Lin_FetchTxStatus(base);
+
+        sched->txPending = FALSE;
+#if (STD_ON == LIN_STATISTICS_API)
+        Lin_StatsRecordStatus(channelID, status, FALSE);
+#endif
+        if (NULL_PTR != sched->notify)
+        {
+            sched->notify(channelID, sched->curEntry, status, (const uint8 *)NULL_PTR);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if (TRUE == sched->rxPending)
+    {
+        /* No completion interrupt within the slot, nothing received counts as no response */
+        Lin_StatusType status = Lin_FetchRxStatus(base);
+
+        if (LIN_RX_BUSY == status)
+        {
+            status = LIN_RX_NO_RESPONSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        Lin_ScheduleRxDone(channelID, base, status, FALSE);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+LOCAL_INLINE FUNC(uint32, LIN_CODE) Lin_StatsBin(uint32 cycles)
+{
+    uint32 value = cycles;
+    uint32 bin   = 0U;
+
+    /* Bit length by binary search, no count-leading-zeros intrinsic needed */
+    if (value >= 0x10000U)
+    {
+        value >>= 16U;
+        bin    += 16U;
+    }
+    if (value >= 0x100U)
+    {
+        value >>= 8U;
+        bin    += 8U;
+    }
+    if (value >= 0x10U)
+    {
+        value >>= 4U;
+        bin    += 4U;
+    }
+    if (value >= 0x4U)
+    {
+        value >>= 2U;
+        bin    += 2U;
+    }
+    if (value >= 0x2U)
+    {
+        value >>= 1U;
+        bin    += 1U;
+    }
+    bin += value;
+
+    return (bin > LIN_STATS_HIST_LAST) ? LIN_STATS_HIST_LAST : bin;
+}
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+static FUNC(void, LIN_CODE) Lin_StatsRecordSlotStart(uint8 channelID, uint16 prevDelay)
+{
+    Lin_StatisticsType *stats  = &Lin_Stats[channelID];
+    Lin_StatsStateType *state  = &Lin_StatsState[channelID];
+    uint32              cycles = 0U;
+
+    Mcal_GetCycleCounterValue(&cycles);
+
+    if (TRUE == state->slotStarted)
+    {
+        uint32 interval = cycles - state->slotCycles;
+        uint32 nominal;
+        uint32 jitter;
+
+        state->scheduleCycles += (uint64)interval;
+        state->scheduleTicks  += (uint32)prevDelay;
+
+        /* The mean tick period since the schedule start stands in for the GPT period, which the driver
+         * does not know; it converges to the timer period, so the error of one slot start shows up here */
+        nominal = (uint32)((state->scheduleCycles * (uint64)prevDelay) / (uint64)state->scheduleTicks);
+        jitter  = (interval > nominal) ? (interval - nominal) : (nominal - interval);
+
+        stats->lastJitterCycles = jitter;
+        if (jitter > stats->maxJitterCycles)
+        {
+            stats->maxJitterCycles = jitter;
+        }
+        stats->jitterHist[Lin_StatsBin(jitter)]++;
+    }
+    else
+    {
+        state->slotStarted    = TRUE;
+        state->scheduleCycles = 0U;
+        state->scheduleTicks  = 0U;
+    }
+
+    state->slotCycles = cycles;
+    stats->slotCount++;
+}
+#endif
+#endif
+
 #if (STD_ON == LIN_REGISTER_READBACK_API)
 /******************************************************************************
  *  Lin_HwRegisterReadback
@@ -1137,6 +1777,10 @@ FUNC(void, LIN_CODE) Lin_DeinitInternal(void)
         HW_WR_REG32(lin_cnt_base_addr + CSL_LIN_SCIPIO1, 0x00000000U);
         HW_WR_REG32(lin_cnt_base_addr + CSL_LIN_SCICLEARINT, 0xFFFFFFFFU);
         HW_WR_REG32(lin_cnt_base_addr + CSL_LIN_LINCOMP, 0x00000000U);
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+        Lin_ScheduleHwInit(channel_idx);
+#endif
     }
 }
 #define LIN_STOP_SEC_CODE
@@ -307,6 +307,110 @@ FUNC(void, LIN_CODE) Lin_DeinitInternal(void);
  *
  **/
 FUNC(Std_ReturnType, LIN_CODE) Lin_SendGoToSleepSignal(uint32 base);
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/**
+ * \brief   This API will reset the schedule table state of a channel.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_ScheduleHwInit(uint8 channelID);
+
+/**
+ * \brief   This API will precompute the slot register images and start the schedule table.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   table          Schedule table, entries already checked by the caller.
+ * \param   numEntries     Number of entries in table.
+ * \param   notify         Slot completion notification, may be NULL_PTR.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE)
+Lin_ScheduleHwStart(uint8 channelID, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) table, uint8 numEntries,
+                    Lin_ScheduleNotifyType notify);
+
+/**
+ * \brief   This API will stop the schedule table and disarm the slot interrupts.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_ScheduleHwStop(uint8 channelID);
+
+/**
+ * \brief   This API will advance the schedule table by one tick and start the next slot when due.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_ScheduleHwTick(uint8 channelID);
+
+/**
+ * \brief   This API will check if the schedule table of a channel is running.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  TRUE: Schedule table is running.
+ *          FALSE: Schedule table is stopped.
+ *
+ **/
+FUNC(boolean, LIN_CODE) Lin_ScheduleHwIsActive(uint8 channelID);
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+/**
+ * \brief   This API will clear the statistics of a channel.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_StatsReset(uint8 channelID);
+
+/**
+ * \brief   This API will copy the statistics of a channel into statsPtr.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   statsPtr       Pointer to where the snapshot is stored.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_StatsSnapshot(uint8 channelID, P2VAR(Lin_StatisticsType, AUTOMATIC, LIN_APPL_DATA) statsPtr);
+
+/**
+ * \brief   This API will timestamp the start of a header.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_StatsRecordHeader(uint8 channelID);
+
+/**
+ * \brief   This API will account a frame status. Only final TX and RX states are counted, the latency is taken for
+ *          LIN_TX_OK and LIN_RX_OK.
+ *
+ * \param   channelID      LIN channel to be addressed.
+ * \param   status         Status returned by Lin_FetchTxStatus / Lin_FetchRxStatus.
+ * \param   fromIsr        TRUE if the LIN ISR saw the completion, FALSE if it was polled.
+ *
+ * \return  None.
+ *
+ **/
+FUNC(void, LIN_CODE) Lin_StatsRecordStatus(uint8 channelID, Lin_StatusType status, boolean fromIsr);
+#endif
 /*********************************************************************************************************************
  *  Exported Inline Function Definitions and Function-Like Macros
  *********************************************************************************************************************/
@@ -174,6 +174,16 @@ extern "C" {
 #define LIN_SID_REGISTER_READBACK ((uint8)0x0CU)
 /** \brief Lin_Deinit() */
 #define LIN_SID_DEINIT ((uint8)0x0DU)
+/** \brief Lin_ScheduleStart() */
+#define LIN_SID_SCHEDULE_START ((uint8)0x0EU)
+/** \brief Lin_ScheduleStop() */
+#define LIN_SID_SCHEDULE_STOP ((uint8)0x0FU)
+/** \brief Lin_ScheduleTick() */
+#define LIN_SID_SCHEDULE_TICK ((uint8)0x10U)
+/** \brief Lin_GetStatistics() */
+#define LIN_SID_GET_STATISTICS ((uint8)0x11U)
+/** \brief Lin_ResetStatistics() */
+#define LIN_SID_RESET_STATISTICS ((uint8)0x12U)
 /** @} */
 //*****************************************************************************
 //
@@ -206,6 +216,10 @@ extern "C" {
 /** \brief API service called with a NULL pointer */
 #define LIN_E_PARAM_POINTER ((uint8)0x05U)
 #endif
+#ifndef LIN_E_PARAM_VALUE
+/** \brief API service called with an invalid parameter value */
+#define LIN_E_PARAM_VALUE ((uint8)0x06U)
+#endif
 /** @} */
 /*********************************************************************************************************************
  * Exported Preprocessor #define Macros
@@ -223,6 +237,12 @@ extern "C" {
 /** \brief Category 2 ISR type */
 #define LIN_ISR_CAT2 (0x02U)
 /** @} */
+
+#if (STD_ON == LIN_STATISTICS_API)
+/** \brief Number of bins of the statistics histograms. Bin 0 counts the value 0, bin n (n > 0) counts values in
+ *         [2^(n-1), 2^n) PMU cycles, so bin 10 is 512 to 1023 cycles (1.28 to 2.56 us at 400 MHz). */
+#define LIN_STATS_HIST_BINS (33U)
+#endif
 /* ========================================================================== */
 /*                          Function Declarations                             */
 /* ========================================================================== */
@@ -253,6 +273,70 @@ typedef struct Lin_ConfigTag
     Lin_ChannelType linChannelCfg[LIN_MAX_CHANNEL];
 } Lin_ConfigType;
 
+#if (STD_ON == LIN_STATISTICS_API)
+/** \brief Frame, latency and slot jitter statistics of a LIN channel. Times are PMU cycle counts. */
+typedef struct Lin_StatisticsTag
+{
+    /** \brief Frames completed with LIN_TX_OK */
+    uint32 txOkCount;
+    /** \brief Frames completed with LIN_TX_HEADER_ERROR */
+    uint32 txHeaderErrorCount;
+    /** \brief Frames completed with LIN_TX_ERROR */
+    uint32 txErrorCount;
+    /** \brief Frames completed with LIN_RX_OK */
+    uint32 rxOkCount;
+    /** \brief Frames completed with LIN_RX_ERROR (checksum, overrun or parity error) */
+    uint32 rxErrorCount;
+    /** \brief Frames completed with LIN_RX_NO_RESPONSE */
+    uint32 rxNoResponseCount;
+    /** \brief Header start to the LIN ISR seeing the response of the last LIN_RX_OK frame */
+    uint32 lastLatencyCycles;
+    /** \brief Smallest header to response latency */
+    uint32 minLatencyCycles;
+    /** \brief Largest header to response latency */
+    uint32 maxLatencyCycles;
+    /** \brief Number of latencies taken */
+    uint32 latencyCount;
+    /** \brief Sum of all header to response latencies, divide by latencyCount for the mean */
+    uint64 totalLatencyCycles;
+    /** \brief Header to response latency histogram, see LIN_STATS_HIST_BINS */
+    uint32 latencyHist[LIN_STATS_HIST_BINS];
+    /** \brief Number of LIN_TX_OK / LIN_RX_OK frames whose completion was polled, not seen by the ISR */
+    uint32 polledLatencyCount;
+    /** \brief Header start to the poll that saw the last polled completion. It is bounded by the poll period or
+     *slot length, not by the response time. */
+    uint32 lastPolledLatencyCycles;
+    /** \brief Largest header start to polled completion time */
+    uint32 maxPolledLatencyCycles;
+    /** \brief Sum of all header start to polled completion times */
+    uint64 totalPolledLatencyCycles;
+    /** \brief Schedule table slots started */
+    uint32 slotCount;
+    /** \brief Deviation of the last slot start interval from its nominal length */
+    uint32 lastJitterCycles;
+    /** \brief Largest slot start deviation */
+    uint32 maxJitterCycles;
+    /** \brief Slot start deviation histogram, see LIN_STATS_HIST_BINS */
+    uint32 jitterHist[LIN_STATS_HIST_BINS];
+} Lin_StatisticsType;
+#endif
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/** \brief One entry (slot) of a LIN master schedule table */
+typedef struct Lin_ScheduleEntryTag
+{
+    /** \brief Frame sent in this slot. For LIN_MASTER_RESPONSE the data is read from SduPtr when the slot starts */
+    Lin_PduType Pdu;
+    /** \brief Slot length in Lin_ScheduleTick() periods, must be at least 1 */
+    uint16      Delay;
+} Lin_ScheduleEntryType;
+
+/** \brief Notification called from the LIN ISR (or from Lin_ScheduleTick() on a slot timeout) when a slot
+ *         completes. SduPtr points to the received data for LIN_RX_OK and is NULL_PTR otherwise. */
+typedef P2FUNC(void, LIN_APPL_CODE, Lin_ScheduleNotifyType)(uint8 Channel, uint8 EntryIdx, Lin_StatusType Status,
+                                                            P2CONST(uint8, AUTOMATIC, LIN_APPL_DATA) SduPtr);
+#endif
+
 /*********************************************************************************************************************
  * Exported Object Declarations
  *********************************************************************************************************************/
@@ -467,6 +551,110 @@ Lin_RegisterReadback(uint8 Channel, P2VAR(Lin_RegisterReadbackType, AUTOMATIC, L
  *
  *****************************************************************************/
 FUNC(void, LIN_CODE) Lin_Deinit(void);
+
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+/** \brief This function starts the in-driver master schedule table on a channel.
+ *
+ * The checksum model, ID masks and frame length of each entry are converted once into register images so that
+ * starting a slot only writes the precomputed values. The first slot is sent on the next Lin_ScheduleTick(). While
+ * the schedule runs, Lin_SendFrame() is rejected on the channel. The table is referenced, not copied, and must stay
+ * valid until Lin_ScheduleStop().
+ *
+ * Service ID[hex]   : 0x0E
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non Reentrant
+ *
+ * \param[in] Channel - LIN channel to be addressed.
+ * \param[in] Table - Schedule table, run cyclically.
+ * \param[in] NumEntries - Number of entries in Table, 1 to LIN_SCHEDULE_MAX_ENTRIES.
+ * \param[in] Notify - Slot completion notification, may be NULL_PTR.
+ * \return Std_ReturnType
+ * \retval E_OK: Schedule table started
+ * \retval E_NOT_OK: Development error or the channel is not operational and idle
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, LIN_CODE)
+Lin_ScheduleStart(uint8 Channel, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) Table, uint8 NumEntries,
+                  Lin_ScheduleNotifyType Notify);
+
+/** \brief This function stops the schedule table of a channel. A frame already on the bus is completed by the
+ *hardware but not notified.
+ *
+ * Service ID[hex]   : 0x0F
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non Reentrant
+ *
+ * \param[in] Channel - LIN channel to be addressed.
+ * \return void
+ *
+ *****************************************************************************/
+FUNC(void, LIN_CODE) Lin_ScheduleStop(uint8 Channel);
+
+/** \brief This function is the time base of the schedule table. It is meant to be called from a periodic GPT
+ *notification (or any other periodic interrupt) so that slots start with the jitter of that interrupt only.
+ *
+ * Service ID[hex]   : 0x10
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non Reentrant
+ *
+ * \param[in] Channel - LIN channel to be addressed.
+ * \return void
+ *
+ *****************************************************************************/
+FUNC(void, LIN_CODE) Lin_ScheduleTick(uint8 Channel);
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+/** \brief This function returns a snapshot of the statistics of a channel: completed frames per status, header to
+ *response latency and schedule slot start jitter. Cycle values are taken from the PMU cycle counter, which must be
+ *enabled by the application.
+ *
+ * The latency runs from the ID write that starts the header to the LIN ISR seeing the completed response, which
+ *is the case for slave responses of the schedule table. Frames whose completion is only polled - Lin_SendFrame()
+ *frames seen by Lin_GetStatus() and master responses of the schedule table seen by the next Lin_ScheduleTick() - are
+ *kept apart in the polled latency fields, as their time includes the poll period or the slot length.
+ *The slot jitter is the difference between the time from one slot start to the next and the slot Delay times the
+ *mean Lin_ScheduleTick() period since Lin_ScheduleStart().
+ *
+ * Service ID[hex]   : 0x11
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[in] Channel - LIN channel to be addressed.
+ * \param[out] StatsPtr - Pointer to where to store the statistics. If this pointer is NULL_PTR, then the API will
+ *return E_NOT_OK.
+ * \return Std_ReturnType
+ * \retval E_OK: Statistics have been copied
+ * \retval E_NOT_OK: Statistics could not be read
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, LIN_CODE)
+Lin_GetStatistics(uint8 Channel, P2VAR(Lin_StatisticsType, AUTOMATIC, LIN_APPL_DATA) StatsPtr);
+
+/** \brief This function clears the statistics of a channel.
+ *
+ * Service ID[hex]   : 0x12
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[in] Channel - LIN channel to be addressed.
+ * \return Std_ReturnType
+ * \retval E_OK: Statistics have been cleared
+ * \retval E_NOT_OK: Statistics could not be cleared
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, LIN_CODE) Lin_ResetStatistics(uint8 Channel);
+#endif
 /*********************************************************************************************************************
  *  Exported Inline Function Definitions and Function-Like Macros
  *********************************************************************************************************************/
@@ -133,6 +133,11 @@ static FUNC(Lin_StatusType, LIN_CODE)
 static FUNC(Std_ReturnType, LIN_CODE)
     Lin_RegReadback_Deterror(uint8 Channel, P2VAR(Lin_RegisterReadbackType, AUTOMATIC, LIN_APPL_DATA) RegRbPtr);
 #endif
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+static FUNC(Std_ReturnType, LIN_CODE)
+    Lin_ScheduleStartDetCheck(uint8 Channel, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) Table,
+                              uint8 NumEntries);
+#endif
 /*********************************************************************************************************************
  * Local Object Definitions
  *********************************************************************************************************************/
@@ -251,6 +256,13 @@ static FUNC(Std_ReturnType, LIN_CODE) Lin_InitInternal(P2CONST(Lin_ConfigType, A
         /* Pass pointer of Driver Configuration to be used for ISR processing*/
         Lin_SetDriverCfgPtr(Lin_ConfigPtr);
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+        Lin_ScheduleHwInit(channel_idx);
+#endif
+#if (STD_ON == LIN_STATISTICS_API)
+        Lin_StatsReset(channel_idx);
+#endif
+
         /* Init individual controller */
         return_value = Lin_HwUnitConfig(&Lin_ConfigPtr->linChannelCfg[channel_idx]);
         if (return_value == E_NOT_OK)
@@ -368,6 +380,12 @@ Lin_SendFrame(uint8 Channel, P2CONST(Lin_PduType, AUTOMATIC, LIN_APPL_CONST) Pdu
 
         return_value = Lin_SendData(&Lin_Config_Ptr->linChannelCfg[Channel],
                                     &Lin_Channel_Status[Channel].linChannelActivityStatus, PduInfoPtr);
+#if (STD_ON == LIN_STATISTICS_API)
+        if (((Std_ReturnType)E_OK) == return_value)
+        {
+            Lin_StatsRecordHeader(Channel);
+        }
+#endif
 
         SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
     }
@@ -409,6 +427,16 @@ static FUNC(Std_ReturnType, LIN_CODE)
 #endif
             return_value = E_NOT_OK;
         }
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+        else if (TRUE == Lin_ScheduleHwIsActive(Channel))
+        {
+            /* The channel is owned by the schedule table */
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+            (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SEND_FRAME, LIN_E_STATE_TRANSITION);
+#endif
+            return_value = E_NOT_OK;
+        }
+#endif
     }
     return return_value;
 }
@@ -438,6 +466,10 @@ Lin_GoToSleep(uint8 Channel)
 
         SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+        Lin_ScheduleHwStop(Channel);
+#endif
+
         if (TRUE == Lin_Config_Ptr->linChannelCfg[Channel].linChannelWakeupSupport)
         {
             Lin_EnableWakeupDetection(&Lin_Config_Ptr->linChannelCfg[Channel], TRUE);
@@ -494,6 +526,10 @@ Lin_GoToSleepInternal(uint8 Channel)
     {
         SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+        Lin_ScheduleHwStop(Channel);
+#endif
+
         Lin_Channel_Status[Channel].linChannelNetworkStatus = LIN_CHANNEL_SLEEP;
 
         if (TRUE == Lin_Config_Ptr->linChannelCfg[Channel].linChannelWakeupSupport)
@@ -729,6 +765,11 @@ static FUNC(Lin_StatusType, LIN_CODE)
             break;
             /* TI_COVERAGE_GAP_STOP */
     }
+
+#if (STD_ON == LIN_STATISTICS_API)
+    /* Busy and idle states are not counted */
+    Lin_StatsRecordStatus(Channel, return_value, FALSE);
+#endif
     return return_value;
 }
 
@@ -796,6 +837,211 @@ static FUNC(Std_ReturnType, LIN_CODE)
 #endif /*#if (STD_ON == LIN_DEV_ERROR_DETECT)*/
 #endif /*#if (STD_ON == LIN_REGISTER_READBACK_API)*/
 
+#if (STD_ON == LIN_SCHEDULE_TABLE_API)
+FUNC(Std_ReturnType, LIN_CODE)
+Lin_ScheduleStart(uint8 Channel, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) Table, uint8 NumEntries,
+                  Lin_ScheduleNotifyType Notify)
+{
+    Std_ReturnType return_value = Lin_ScheduleStartDetCheck(Channel, Table, NumEntries);
+
+    if (((Std_ReturnType)E_OK) == return_value)
+    {
+        SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
+
+        /* A frame started by Lin_SendFrame is dropped the same way a new Lin_SendFrame would drop it */
+        if (LIN_CHANNEL_IDLE != Lin_Channel_Status[Channel].linChannelActivityStatus)
+        {
+            Lin_AbortTransmission(Lin_Config_Ptr->linChannelCfg[Channel].linControllerConfig.CntrAddr);
+            Lin_Channel_Status[Channel].linChannelActivityStatus = LIN_CHANNEL_IDLE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        Lin_ScheduleHwStart(Channel, Table, NumEntries, Notify);
+
+        SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
+    }
+    return return_value;
+}
+
+FUNC(void, LIN_CODE) Lin_ScheduleStop(uint8 Channel)
+{
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+    if (LIN_INIT != Lin_Module_State)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_STOP, LIN_E_UNINIT);
+    }
+    else if (LIN_MAX_CHANNEL <= Channel)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_STOP, LIN_E_INVALID_CHANNEL);
+    }
+    else
+#endif
+    {
+        SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
+        Lin_ScheduleHwStop(Channel);
+        SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
+    }
+}
+
+FUNC(void, LIN_CODE) Lin_ScheduleTick(uint8 Channel)
+{
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+    if (LIN_INIT != Lin_Module_State)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_TICK, LIN_E_UNINIT);
+    }
+    else if (LIN_MAX_CHANNEL <= Channel)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_TICK, LIN_E_INVALID_CHANNEL);
+    }
+    else
+#endif
+    {
+        /* Keeps the LIN ISR from completing the slot that is being closed here */
+        SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
+        Lin_ScheduleHwTick(Channel);
+        SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
+    }
+}
+
+static FUNC(Std_ReturnType, LIN_CODE)
+    Lin_ScheduleStartDetCheck(uint8 Channel, P2CONST(Lin_ScheduleEntryType, AUTOMATIC, LIN_APPL_CONST) Table,
+                              uint8 NumEntries)
+{
+    Std_ReturnType return_value = E_OK;
+    uint8          idx;
+
+    if (LIN_INIT != Lin_Module_State)
+    {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_UNINIT);
+#endif
+        return_value = E_NOT_OK;
+    }
+    else if (Channel >= LIN_MAX_CHANNEL)
+    {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_INVALID_CHANNEL);
+#endif
+        return_value = E_NOT_OK;
+    }
+    else if (NULL_PTR == Table)
+    {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_PARAM_POINTER);
+#endif
+        return_value = E_NOT_OK;
+    }
+    else if ((0U == NumEntries) || (NumEntries > LIN_SCHEDULE_MAX_ENTRIES))
+    {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_PARAM_VALUE);
+#endif
+        return_value = E_NOT_OK;
+    }
+    else if ((LIN_CHANNEL_OPERATIONAL != Lin_Channel_Status[Channel].linChannelNetworkStatus) ||
+             (TRUE == Lin_ScheduleHwIsActive(Channel)))
+    {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_STATE_TRANSITION);
+#endif
+        return_value = E_NOT_OK;
+    }
+    else
+    {
+        for (idx = 0U; (idx < NumEntries) && (E_OK == return_value); idx++)
+        {
+            if ((LIN_MASTER_RESPONSE == Table[idx].Pdu.Drc) && (NULL_PTR == Table[idx].Pdu.SduPtr))
+            {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+                (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_PARAM_POINTER);
+#endif
+                return_value = E_NOT_OK;
+            }
+            else if ((0U == Table[idx].Pdu.Dl) || (Table[idx].Pdu.Dl > 8U) || (0U == Table[idx].Delay))
+            {
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+                (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_SCHEDULE_START, LIN_E_PARAM_VALUE);
+#endif
+                return_value = E_NOT_OK;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+    return return_value;
+}
+#endif
+
+#if (STD_ON == LIN_STATISTICS_API)
+FUNC(Std_ReturnType, LIN_CODE)
+Lin_GetStatistics(uint8 Channel, P2VAR(Lin_StatisticsType, AUTOMATIC, LIN_APPL_DATA) StatsPtr)
+{
+    Std_ReturnType return_value = E_NOT_OK;
+
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+    if (LIN_INIT != Lin_Module_State)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_GET_STATISTICS, LIN_E_UNINIT);
+    }
+    else if (LIN_MAX_CHANNEL <= Channel)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_GET_STATISTICS, LIN_E_INVALID_CHANNEL);
+    }
+    else if (NULL_PTR == StatsPtr)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_GET_STATISTICS, LIN_E_PARAM_POINTER);
+    }
+    else
+#else
+    if ((LIN_INIT == Lin_Module_State) && (LIN_MAX_CHANNEL > Channel) && (NULL_PTR != StatsPtr))
+#endif
+    {
+        /* Consistent copy with respect to the LIN ISR and Lin_ScheduleTick() */
+        SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
+        Lin_StatsSnapshot(Channel, StatsPtr);
+        SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
+
+        return_value = E_OK;
+    }
+
+    return return_value;
+}
+
+FUNC(Std_ReturnType, LIN_CODE) Lin_ResetStatistics(uint8 Channel)
+{
+    Std_ReturnType return_value = E_NOT_OK;
+
+#if (STD_ON == LIN_DEV_ERROR_DETECT)
+    if (LIN_INIT != Lin_Module_State)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_RESET_STATISTICS, LIN_E_UNINIT);
+    }
+    else if (LIN_MAX_CHANNEL <= Channel)
+    {
+        (void)Det_ReportError(LIN_MODULE_ID, LIN_INSTANCE_ID, LIN_SID_RESET_STATISTICS, LIN_E_INVALID_CHANNEL);
+    }
+    else
+#else
+    if ((LIN_INIT == Lin_Module_State) && (LIN_MAX_CHANNEL > Channel))
+#endif
+    {
+        SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0();
+        Lin_StatsReset(Channel);
+        SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0();
+
+        return_value = E_OK;
+    }
+
+    return return_value;
+}
+#endif
+
 /*********************************************************************************************************************
  *  Local Functions Definition
  *********************************************************************************************************************/
@@ -63,10 +63,14 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 #include "Pwm_Priv.h"
+#include "SchM_Pwm.h"
 #include "sys_common.h"
-#if (STD_ON == PWM_SFO_SUPPORT_ENABLE)
+#if (STD_ON == PWM_SFO_SUPPORT_ENABLE) || (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
 #include "Pwm_Sfo.h"
 #endif
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+#include "sys_pmu.h"
+#endif
 
 /* ========================================================================== */
 /*                                Macros                                      */
@@ -111,9 +115,23 @@ VAR(uint16, PWM_VAR_NO_INIT) Pwm_IsrIndex[PWM_HW_MAX_NUM_CHANNELS];
 #define PWM_START_SEC_VAR_INIT_32
 #include "Pwm_MemMap.h"
 VAR(uint32, PWM_VAR_INIT) Pwm_gOttoCal_base = (uint32)MCAL_CSL_CONTROLSS_OTTOCAL0_U_BASE;
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+/** \brief Result of the previous background SFO run, 0 if none */
+VAR(uint32, PWM_VAR_INIT) Pwm_SfoLastRun = 0U;
+#endif
 #define PWM_STOP_SEC_VAR_INIT_32
 #include "Pwm_MemMap.h"
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+#define PWM_START_SEC_VAR_INIT_UNSPECIFIED
+#include "Pwm_MemMap.h"
+/** \brief Background SFO calibration status. The scale factor is kept over
+ *  Pwm_DeInit so that a later Pwm_Init starts with the last known value. */
+VAR(Pwm_SfoStatusType, PWM_VAR_INIT) Pwm_SfoStatus = {PWM_SFO_CAL_STATE_IDLE, 0U, 0U, 0U, 0U};
+#define PWM_STOP_SEC_VAR_INIT_UNSPECIFIED
+#include "Pwm_MemMap.h"
+#endif
+
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -214,7 +232,8 @@ FUNC(void, PWM_CODE) Pwm_HwUnitInit(Pwm_ChObjType *chObj)
     float32                duty_cycle_percent_int;
     float32                duty_cycle_percent_dec;
     float32                duty_cycle_period;
-    uint32                 phwPeriod = 0U;
+    uint32                 phwPeriod  = 0U;
+    uint16                 compareVal = 0U;
 
     baseAddr  = chObj->baseAddr;
     phwPeriod = pChannelConfig->hwPeriod;
@@ -268,20 +287,14 @@ FUNC(void, PWM_CODE) Pwm_HwUnitInit(Pwm_ChObjType *chObj)
     {
         signalParams.tbCtrMode = EPWM_COUNTER_MODE_UP_DOWN;
 
-        /* Calculation for high resolution */
-        duty_cycle_percent = (float32)(((float32)(pChannelConfig->dutyCycle)) / ((float32)32768U));
-
-        /*0x8000 is 32768, calculating percentage from hex*/
-        duty_cycle_period      = duty_cycle_percent * (float32)(pChannelConfig->hwPeriod);
-        duty_cycle_percent_int = (float32)(pChannelConfig->hwPeriod);
-        duty_cycle_percent_dec = duty_cycle_percent_int - duty_cycle_period;
+        /* Integer Q15 compare value, exactly representable as float32 */
+        compareVal = Pwm_DutyToCompare(phwPeriod, pChannelConfig->dutyCycle);
 
         /* Set the parameters of PWM. */
-        signalParams.freqInHz = duty_cycle_percent_int;
-        signalParams.dutyValA = duty_cycle_period;
-        signalParams.dutyValA = duty_cycle_percent_dec;
-        signalParams.dutyValB = duty_cycle_period;
-        signalParams.dutyValB = duty_cycle_percent_dec;
+        signalParams.freqInHz = (float32)phwPeriod;
+        /* CMPA/CMPB = (100% - duty cycle) TBPRD  */
+        signalParams.dutyValA = (float32)compareVal;
+        signalParams.dutyValB = (float32)compareVal;
 
         /* Set the Polarity. */
         if (pChannelConfig->polarity == PWM_HIGH)
@@ -368,10 +381,11 @@ FUNC(void, PWM_CODE) Pwm_SetDutyCycle_Internal(Pwm_ChObjType *chObj, uint16 Duty
     /* Updating Init time dutyCycle which is used to enable notifications,
      * if the duty cycle is not 0% or 100% */
     chObj->chCfg.dutyCycle = DutyCycle;
-    period                 = (uint32)EPWM_getTimeBasePeriod(baseAddr);
 
     if (chObj->chCfg.enableHR == TRUE)
     {
+        period = (uint32)EPWM_getTimeBasePeriod(baseAddr);
+
         signalParams.tbCtrMode = EPWM_COUNTER_MODE_UP_DOWN;
 
         /* Calculation for high resolution */
@@ -413,41 +427,36 @@ FUNC(void, PWM_CODE) Pwm_SetDutyCycle_Internal(Pwm_ChObjType *chObj, uint16 Duty
     }
     else
     {
-        signalParams.tbCtrMode = EPWM_COUNTER_MODE_UP_DOWN;
-
-        /* Calculation for high resolution */
-        duty_cycle_percent = (float32)(((float32)(chObj->chCfg.dutyCycle)) / ((float32)32768U));
+        /* Action qualifiers and the shadow load on counter zero are set up
+         * by Pwm_HwUnitInit, only the compare values change here. TBPRD
+         * always mirrors hwPeriod for a non HR channel. */
+        Pwm_SetCompare_epwm(baseAddr, Pwm_DutyToCompare(chObj->chCfg.hwPeriod, DutyCycle));
+    }
+}
+#endif
 
-        /*0x8000 is 32768, calculating percentage from hex*/
-        duty_cycle_period      = duty_cycle_percent * (float32)(period);
-        duty_cycle_percent_int = (float32)(period);
-        duty_cycle_percent_dec = duty_cycle_percent_int - duty_cycle_period;
+/* CMPA/CMPB = TBPRD - (TBPRD * DutyCycle) in Q15 with round to nearest.
+ * TBPRD is at most 16 bit and DutyCycle is saturated to 0x8000, so the
+ * product always fits in 32 bit. */
+FUNC(uint16, PWM_CODE) Pwm_DutyToCompare(uint32 period, uint16 DutyCycle)
+{
+    uint32 duty = (uint32)DutyCycle;
+    uint32 onTicks;
 
-        /* Update DutyCycle */
-        /* Check the Output outputCh */
-        /* Set the parameters of PWM. */
-        signalParams.freqInHz = period;
-        signalParams.dutyValA = duty_cycle_percent_dec;
-        signalParams.dutyValB = duty_cycle_percent_dec;
-        /* Set the Polarity. */
-        if (chObj->chCfg.polarity == PWM_HIGH)
-        {
-            signalParams.invertSignalB = (boolean)0;
-        }
-        else
-        {
-            signalParams.invertSignalB = (boolean)1;
-        }
+    if (duty > (uint32)PWM_DUTY_100_PERCENT)
+    {
+        duty = (uint32)PWM_DUTY_100_PERCENT;
+    }
+    onTicks = ((period * duty) + 0x4000U) >> 15U;
 
-        signalParams.sysClkInHz = sysClk;
-        signalParams.tbClkDiv   = (EPWM_ClockDivider)chObj->chCfg.prescale;
-        signalParams.tbHSClkDiv = (EPWM_HSClockDivider)chObj->chCfg.hsPrescale;
+    return (uint16)(period - onTicks);
+}
 
-        /* Genearte the PWM signal. */
-        PWM_ConfigureSignalDutyOnly(baseAddr, &signalParams);
-    }
+FUNC(void, PWM_CODE) Pwm_SetCompare_epwm(uint32 baseAddr, uint16 compareVal)
+{
+    EPWM_setCounterCompareValue(baseAddr, EPWM_COUNTER_COMPARE_A, compareVal);
+    EPWM_setCounterCompareValue(baseAddr, EPWM_COUNTER_COMPARE_B, compareVal);
 }
-#endif
 
 #if (STD_ON == PWM_DEINIT_API)
 FUNC(void, PWM_CODE) Pwm_IpDeInit_epwm(const Pwm_ChObjType *chObj)
@@ -812,7 +821,11 @@ Pwm_ConfigHR_epwm(uint32 baseAddr, float32 sysClk, float32 peroid, float32 Duty,
     float32 temp_val;
     float32 highRes_regVal;
 
-#if (STD_ON == PWM_SFO_SUPPORT_ENABLE)
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+    /* Start with the last known scale factor, Pwm_SfoMainFunction keeps it
+       calibrated in the background. */
+    Pwm_MEP_ScaleFactor = (sint32)Pwm_SfoStartupScaleFactor(sysClk);
+#elif (STD_ON == PWM_SFO_SUPPORT_ENABLE)
     uint32          Pwm_SFO_status = PWM_SFO_INCOMPLETE;
     volatile uint32 tempCount      = PWM_MAX_TIMEOUT_DURATION;
     if (PWM_MAX_TIMEOUT_DURATION > 9U)
@@ -820,10 +833,8 @@ Pwm_ConfigHR_epwm(uint32 baseAddr, float32 sysClk, float32 peroid, float32 Duty,
         /* each unit of SW_delay equals to 9 clockcycle, so divided by 9U*/
         tempCount = PWM_MAX_TIMEOUT_DURATION / 9U;
     }
-#endif
-
-#if (STD_OFF == PWM_SFO_SUPPORT_ENABLE)
-    uint32  Pwm_MEP_step = 150U; /*150ps choosen, for 100MHZ*/
+#else
+    uint32  Pwm_MEP_step = PWM_SFO_NOMINAL_MEP_STEP_PS; /*150ps choosen, for 100MHZ*/
     /* TBCLK/MEP_step_size_am263x = 5ns/150ps*/
     float32 tbCLK       = ((float32)1U / sysClk);
     Pwm_MEP_ScaleFactor = tbCLK / ((float32)Pwm_MEP_step * 0.000000000001);
@@ -839,7 +850,7 @@ Pwm_ConfigHR_epwm(uint32 baseAddr, float32 sysClk, float32 peroid, float32 Duty,
     /* Enable MEP Scale Step. */
     HRPWM_setMEPStep(Ctrladdr, (uint16)Pwm_MEP_ScaleFactor);
 
-#if (STD_ON == PWM_SFO_SUPPORT_ENABLE)
+#if (STD_ON == PWM_SFO_SUPPORT_ENABLE) && (STD_OFF == PWM_SFO_BACKGROUND_CAL_API)
     /*
 
 *  Calling SFO() updates the HRMSTEP register with calibrated MEP_ScaleFactor.
@@ -874,7 +885,7 @@ Pwm_ConfigHR_epwm(uint32 baseAddr, float32 sysClk, float32 peroid, float32 Duty,
        This function generates MEP_ScaleFactor by running the
        MEP calibration module in the HRPWM logic.*/
 
-#if (STD_ON == PWM_SFO_SUPPORT_ENABLE)
+#if (STD_ON == PWM_SFO_SUPPORT_ENABLE) && (STD_OFF == PWM_SFO_BACKGROUND_CAL_API)
     Pwm_SFO_status = Pwm_SFO();
 #endif
 }
@@ -1021,6 +1032,11 @@ FUNC(void, PWM_CODE) Pwm_SystemInit(P2CONST(Pwm_ConfigType, AUTOMATIC, PWM_PBCFG
 {
     uint32 chIdx, chnum;
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+    /* Before the channels, HRPWM channels take their startup scale factor from here */
+    Pwm_SfoBgInit();
+#endif
+
     /* Only initialize configured resources */
     for (chnum = 0U; chnum < PWM_HW_MAX_NUM_CHANNELS; chnum++)
     {
@@ -1105,6 +1121,10 @@ FUNC(void, PWM_CODE) Pwm_SystemDeInit(void)
     /* Reset driver object */
     Pwm_ResetChObj(&Pwm_ChObj[0U]);
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+    Pwm_SfoBgDeInit();
+#endif
+
 #if (STD_ON == PWM_DEV_ERROR_DETECT)
     Pwm_DrvStatus = PWM_STATUS_UNINIT;
 #endif
@@ -1163,6 +1183,44 @@ Pwm_SystemSetDutyCycle_Internal(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
 #endif /*#if (PWM_SET_PERIOD_AND_DUTY_API==STD_ON) || \ \
     (PWM_SET_DUTY_CYCLE_API == STD_ON)*/
 
+#if (STD_ON == PWM_SET_DUTY_CYCLE_API)
+FUNC(void, PWM_CODE)
+Pwm_SystemSetDutyCycleMulti(const Pwm_ChannelType *Channels, const uint16 *DutyCycles, uint8 NumChannels)
+{
+    Pwm_ChObjType *chObj;
+    uint16         compareVal[PWM_MAX_NUM_CHANNELS];
+    uint8          idx;
+
+    /* Pass 1: compute the compare values of the non HR channels. HR channels
+     * and channels forced to idle take the single channel path, the latter
+     * to release the software forced output. */
+    for (idx = 0U; idx < NumChannels; idx++)
+    {
+        chObj = &Pwm_ChObj[Channels[idx]];
+        if ((chObj->chCfg.enableHR == TRUE) || ((boolean)TRUE == chObj->channelForcedIdle))
+        {
+            Pwm_SetDutyCycle_Internal(chObj, DutyCycles[idx]);
+        }
+        if (chObj->chCfg.enableHR != TRUE)
+        {
+            chObj->chCfg.dutyCycle = DutyCycles[idx];
+            compareVal[idx]        = Pwm_DutyToCompare(chObj->chCfg.hwPeriod, DutyCycles[idx]);
+        }
+    }
+
+    /* Pass 2: write the shadow registers back to back so that all of them
+     * are latched by the same counter zero event */
+    for (idx = 0U; idx < NumChannels; idx++)
+    {
+        chObj = &Pwm_ChObj[Channels[idx]];
+        if (chObj->chCfg.enableHR != TRUE)
+        {
+            Pwm_SetCompare_epwm(chObj->baseAddr, compareVal[idx]);
+        }
+    }
+}
+#endif
+
 #if (STD_ON == PWM_REGISTER_READBACK_API)
 void Pwm_HwRegisterReadback(Pwm_RegisterReadbackType *RegRbPtr, Pwm_ChannelType Channel)
 {
@@ -1361,6 +1419,49 @@ Pwm_SetDutyCycle_Deterror(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
     }
     return returnval;
 }
+
+FUNC(Std_ReturnType, PWM_CODE)
+Pwm_SetDutyCycleMulti_Deterror(const Pwm_ChannelType *Channels, const uint16 *DutyCycles, uint8 NumChannels)
+{
+    Std_ReturnType returnval = E_OK;
+    uint8          idx;
+
+    if (PWM_STATUS_INIT != Pwm_DrvStatus)
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_SET_DUTY_CYCLE_MULTI, PWM_E_UNINIT);
+#endif
+        returnval = E_NOT_OK;
+    }
+    else if ((NULL_PTR == Channels) || (NULL_PTR == DutyCycles))
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_SET_DUTY_CYCLE_MULTI, PWM_E_PARAM_POINTER);
+#endif
+        returnval = E_NOT_OK;
+    }
+    else if ((0U == NumChannels) || (NumChannels > (uint32)PWM_MAX_NUM_CHANNELS))
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_SET_DUTY_CYCLE_MULTI, PWM_E_PARAM_CHANNEL);
+#endif
+        returnval = E_NOT_OK;
+    }
+    else
+    {
+        for (idx = 0U; (idx < NumChannels) && (E_OK == returnval); idx++)
+        {
+            if ((Channels[idx] >= (uint32)PWM_MAX_NUM_CHANNELS) || (DutyCycles[idx] > PWM_DUTY_100_PERCENT))
+            {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+                (void)Pwm_reportDetError(PWM_SID_SET_DUTY_CYCLE_MULTI, PWM_E_PARAM_CHANNEL);
+#endif
+                returnval = E_NOT_OK;
+            }
+        }
+    }
+    return returnval;
+}
 #endif
 
 #if (STD_ON == PWM_REGISTER_READBACK_API)
@@ -1481,5 +1582,145 @@ FUNC(Pwm_OutputStateType, PWM_CODE) Pwm_SystemGetOutputState(Pwm_ChannelType Cha
 }
 #endif
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+FUNC(void, PWM_CODE) Pwm_SfoBgInit(void)
+{
+    /* The scale factor is intentionally kept, it is the startup value */
+    Pwm_SfoStatus.calState       = PWM_SFO_CAL_STATE_RUNNING;
+    Pwm_SfoStatus.completedRuns  = 0U;
+    Pwm_SfoStatus.lastStepCycles = 0U;
+    Pwm_SfoStatus.maxStepCycles  = 0U;
+    Pwm_SfoLastRun               = 0U;
+}
+
+FUNC(void, PWM_CODE) Pwm_SfoBgDeInit(void)
+{
+    Pwm_SfoStatus.calState = PWM_SFO_CAL_STATE_IDLE;
+}
+
+FUNC(uint16, PWM_CODE) Pwm_SfoStartupScaleFactor(float32 sysClk)
+{
+    float32 tbCLK;
+    uint16  scaleFactor = Pwm_SfoStatus.scaleFactor;
+
+    if (0U == scaleFactor)
+    {
+        /* Nothing known yet, start with the nominal MEP step.
+           TBCLK/MEP_step_size_am263x = 5ns/150ps
+           It is not stored in Pwm_SfoStatus: the status keeps reporting no
+           known scale factor until a calibration run has been published. */
+        tbCLK       = ((float32)1U / sysClk);
+        scaleFactor = (uint16)(tbCLK / ((float32)PWM_SFO_NOMINAL_MEP_STEP_PS * 0.000000000001));
+    }
+
+    return scaleFactor;
+}
+
+FUNC(void, PWM_CODE) Pwm_SfoBgStep(void)
+{
+    uint32 startCycles = 0U;
+    uint32 endCycles   = 0U;
+    uint32 scaleFactor = 0U;
+    uint32 delta;
+    sint32 stepStatus;
+
+    if (PWM_SFO_CAL_STATE_IDLE != Pwm_SfoStatus.calState)
+    {
+        Mcal_GetCycleCounterValue(&startCycles);
+        stepStatus = Pwm_SFO_Step(&scaleFactor);
+        Mcal_GetCycleCounterValue(&endCycles);
+
+        /* Pwm_GetSfoStatus takes its snapshot in the same exclusive area */
+        SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_0();
+        if (PWM_SFO_COMPLETE == stepStatus)
+        {
+            Pwm_SfoStatus.completedRuns++;
+            if ((0U == scaleFactor) || (scaleFactor > 255U))
+            {
+                /* Keep the published value */
+                Pwm_SfoStatus.calState = PWM_SFO_CAL_STATE_ERROR;
+                scaleFactor            = 0U;
+            }
+            else
+            {
+                delta = (scaleFactor > Pwm_SfoLastRun) ? (scaleFactor - Pwm_SfoLastRun) : (Pwm_SfoLastRun - scaleFactor);
+                if ((0U != Pwm_SfoLastRun) && (delta <= PWM_SFO_CONVERGENCE_TOLERANCE))
+                {
+                    /* Publish with a single HRMSTEP write, the HRPWM auto conversion
+                       either uses the old or the new scale factor. */
+                    Pwm_MEP_ScaleFactor       = (sint32)scaleFactor;
+                    Pwm_SfoStatus.scaleFactor = (uint16)scaleFactor;
+                    HRPWM_setMEPStep(Pwm_gOttoCal_base, (uint16)scaleFactor);
+                    Pwm_SfoStatus.calState = PWM_SFO_CAL_STATE_CONVERGED;
+                }
+                else
+                {
+                    Pwm_SfoStatus.calState = PWM_SFO_CAL_STATE_RUNNING;
+                }
+            }
+            Pwm_SfoLastRun = scaleFactor;
+        }
+
+        Pwm_SfoStatus.lastStepCycles = endCycles - startCycles;
+        if (Pwm_SfoStatus.lastStepCycles > Pwm_SfoStatus.maxStepCycles)
+        {
+            Pwm_SfoStatus.maxStepCycles = Pwm_SfoStatus.lastStepCycles;
+        }
+        SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_0();
+    }
+}
+
+FUNC(void, PWM_CODE) Pwm_SfoBgSetScaleFactor(uint16 ScaleFactor)
+{
+    Pwm_SfoStatus.scaleFactor = ScaleFactor;
+    if (PWM_SFO_CAL_STATE_IDLE != Pwm_SfoStatus.calState)
+    {
+        Pwm_MEP_ScaleFactor = (sint32)ScaleFactor;
+        HRPWM_setMEPStep(Pwm_gOttoCal_base, ScaleFactor);
+    }
+}
+
+FUNC(Std_ReturnType, PWM_CODE) Pwm_GetSfoStatus_Deterror(const Pwm_SfoStatusType *SfoStatusPtr)
+{
+    Std_ReturnType returnval = E_OK;
+
+    if (PWM_STATUS_INIT != Pwm_DrvStatus)
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_GET_SFO_STATUS, PWM_E_UNINIT);
+#endif
+        returnval = E_NOT_OK;
+    }
+    else if (NULL_PTR == SfoStatusPtr)
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_GET_SFO_STATUS, PWM_E_PARAM_POINTER);
+#endif
+        returnval = E_NOT_OK;
+    }
+    else
+    {
+        /* do nothing */
+    }
+
+    return returnval;
+}
+
+FUNC(Std_ReturnType, PWM_CODE) Pwm_SetSfoScaleFactor_Deterror(uint16 ScaleFactor)
+{
+    Std_ReturnType returnval = E_OK;
+
+    if ((0U == ScaleFactor) || (ScaleFactor > 255U))
+    {
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+        (void)Pwm_reportDetError(PWM_SID_SET_SFO_SCALE_FACTOR, PWM_E_PARAM_VALUE);
+#endif
+        returnval = E_NOT_OK;
+    }
+
+    return returnval;
+}
+#endif /* #if (STD_ON == PWM_SFO_BACKGROUND_CAL_API) */
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
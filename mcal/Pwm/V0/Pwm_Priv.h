@@ -96,6 +96,11 @@ extern "C" {
 /** \brief 16 bit value representing 50% of a period value */
 #define PWM_DUTY_50_PERCENT (0x4000U)
 
+/** \brief Max difference of two consecutive SFO runs for the result to be published */
+#define PWM_SFO_CONVERGENCE_TOLERANCE (1U)
+/** \brief Nominal MEP step in ps, used when no scale factor is known yet */
+#define PWM_SFO_NOMINAL_MEP_STEP_PS (150U)
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -126,6 +131,9 @@ typedef struct
 /* ========================================================================== */
 
 extern volatile uint8 Pwm_DrvStatus;
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+extern VAR(Pwm_SfoStatusType, PWM_VAR_INIT) Pwm_SfoStatus;
+#endif
 
 /* ========================================================================== */
 /*                          Function Declarations                             */
@@ -401,6 +409,10 @@ Pwm_SystemSetDutyCycle_Internal(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
 #if (STD_ON == PWM_SET_DUTY_CYCLE_API)
 FUNC(Std_ReturnType, PWM_CODE)
 Pwm_SetDutyCycle_Deterror(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+FUNC(void, PWM_CODE)
+Pwm_SystemSetDutyCycleMulti(const Pwm_ChannelType *Channels, const uint16 *DutyCycles, uint8 NumChannels);
+FUNC(Std_ReturnType, PWM_CODE)
+Pwm_SetDutyCycleMulti_Deterror(const Pwm_ChannelType *Channels, const uint16 *DutyCycles, uint8 NumChannels);
 #endif
 #if (STD_ON == PWM_SET_PERIOD_AND_DUTY_API)
 FUNC(Std_ReturnType, PWM_CODE)
@@ -445,11 +457,25 @@ PWM_ConfigureSignalDutyOnly(uint32 base, const EPWM_SignalParams *signalParams);
 
 FUNC(void, PWM_CODE) Pwm_HwSetDefReg_epwm(uint32 baseAddr);
 
+FUNC(uint16, PWM_CODE) Pwm_DutyToCompare(uint32 period, uint16 DutyCycle);
+
+FUNC(void, PWM_CODE) Pwm_SetCompare_epwm(uint32 baseAddr, uint16 compareVal);
+
 FUNC(void, PWM_CODE)
 Pwm_ConfigHR_epwm(uint32 baseAddr, float32 sysClk, float32 peroid, float32 Duty, uint32 outputCh);
 
 FUNC(void, PWM_CODE) Pwm_Initialize(uint32 epwmbaseadrr);
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+FUNC(void, PWM_CODE) Pwm_SfoBgInit(void);
+FUNC(void, PWM_CODE) Pwm_SfoBgDeInit(void);
+FUNC(uint16, PWM_CODE) Pwm_SfoStartupScaleFactor(float32 sysClk);
+FUNC(void, PWM_CODE) Pwm_SfoBgStep(void);
+FUNC(void, PWM_CODE) Pwm_SfoBgSetScaleFactor(uint16 ScaleFactor);
+FUNC(Std_ReturnType, PWM_CODE) Pwm_GetSfoStatus_Deterror(const Pwm_SfoStatusType *SfoStatusPtr);
+FUNC(Std_ReturnType, PWM_CODE) Pwm_SetSfoScaleFactor_Deterror(uint16 ScaleFactor);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -178,6 +178,50 @@ extern VAR(sint32, PWM_VAR_NO_INIT) Pwm_MEP_ScaleFactor;
 #include "Pwm_MemMap.h"
 
 FUNC(sint32, PWM_CODE) Pwm_SFO(void)
+{
+    sint32 status;
+    uint32 scale_factor = 0U;
+
+    status = Pwm_SFO_Step(&scale_factor);
+    if (PWM_SFO_COMPLETE == status)
+    {
+        Pwm_MEP_SF[Pwm_SFO_Cal] = scale_factor;
+        Pwm_MEP_ScaleFactor     = (sint32)Pwm_MEP_SF[0];
+
+        /* Update status & assign scale factor value to HRMSTEP register */
+        /* TI_COVERAGE_GAP_START - the ScaleFactor gets updated during runtime
+           and the value cannot be greater than 255 */
+        if (Pwm_MEP_ScaleFactor > 255)
+        {
+            status = PWM_SFO_ERROR;
+        }
+        /* TI_COVERAGE_GAP_STOP */
+        else
+        {
+            /* Update HRMSTEP register only with DCAL result*/
+
+            HW_WR_REG16(Pwm_gOttoCal_base + PWM_CSL_OTTOCAL_HRMSTEP, Pwm_MEP_SF[0]);
+        }
+    }
+    return status;
+}
+
+/******************************************************************************
+
+ FUNCTION:    Pwm_SFO_Step(ScaleFactor)
+ DESCRIPTION: Advances the MEP calibration state machine by one step. The
+              measured scale factor is only returned to the caller, neither
+              Pwm_MEP_ScaleFactor nor the HRMSTEP register is updated, so
+              the caller decides when the result is published.
+
+ PARAMETERS:  ScaleFactor - measured MEP scale factor, written only when
+                            the function returns 1
+
+ RETURN:      1 - calibration run complete, ScaleFactor is valid.
+              0 - calibration run still in progress.
+
+******************************************************************************/
+FUNC(sint32, PWM_CODE) Pwm_SFO_Step(P2VAR(uint32, AUTOMATIC, PWM_APPL_DATA) ScaleFactor)
 {
     static uint16 hrc1, hrc2; /* holds HRCNT0 count in 65535 HRCNT1 counts */
     static uint16 TaskPtr = 0U;
@@ -377,29 +421,13 @@ FUNC(sint32, PWM_CODE) Pwm_SFO(void)
             Numer = (MEP2 - MEP1) * 2;
 
             /* Calculate MEP scale factor */
-            scale_factor            = ((((float32)Numer) / Denom) + ((float32)0.5));
-            Pwm_MEP_SF[Pwm_SFO_Cal] = scale_factor;
-            Pwm_MEP_ScaleFactor     = (sint32)Pwm_MEP_SF[0];
+            scale_factor = ((((float32)Numer) / Denom) + ((float32)0.5));
+            *ScaleFactor = scale_factor;
 
             /* Update the task pointer to MEP1 calibration initialization task
              for next call.*/
             TaskPtr = 1;
-
-            /* Update status & assign scale factor value to HRMSTEP register */
-            /* TI_COVERAGE_GAP_START - the ScaleFactor gets updated during runtime
-               and the value cannot be greater than 255 */
-            if (Pwm_MEP_ScaleFactor > 255)
-            {
-                status = PWM_SFO_ERROR;
-            }
-            /* TI_COVERAGE_GAP_STOP */
-            else
-            {
-                /* Update HRMSTEP register only with DCAL result*/
-
-                HW_WR_REG16(Pwm_gOttoCal_base + PWM_CSL_OTTOCAL_HRMSTEP, Pwm_MEP_SF[0]);
-                status = PWM_SFO_COMPLETE;
-            }
+            status  = PWM_SFO_COMPLETE;
 
             break;
         /* TI_COVERAGE_GAP_START - Taskptr can't be controlled using configuration parameter */
@@ -79,6 +79,8 @@ extern "C" {
 #include "Pwm_MemMap.h"
 
 FUNC(sint32, PWM_CODE) Pwm_SFO(void); /* SFO Calibration Function */
+/* One SFO state machine step, result is not published */
+FUNC(sint32, PWM_CODE) Pwm_SFO_Step(P2VAR(uint32, AUTOMATIC, PWM_APPL_DATA) ScaleFactor);
 
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
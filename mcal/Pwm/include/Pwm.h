@@ -182,6 +182,11 @@ extern "C" {
 #ifndef PWM_E_NOT_DISENGAGED
 #define PWM_E_NOT_DISENGAGED ((uint8)(0x16U))
 #endif
+
+/** \brief PWM driver invalid parameter value */
+#ifndef PWM_E_PARAM_VALUE
+#define PWM_E_PARAM_VALUE ((uint8)(0x17U))
+#endif
 /** @} */
 
 /**
@@ -211,6 +216,14 @@ extern "C" {
 #define PWM_SID_GET_VERSION_INFO ((uint8)(0x8U))
 /** \brief PWM driver service ID for Critical register read back API */
 #define PWM_SID_REGISTER_READBACK ((uint8)(0xDU))
+/** \brief PWM driver service ID for set multi channel duty cycle API */
+#define PWM_SID_SET_DUTY_CYCLE_MULTI ((uint8)(0xEU))
+/** \brief PWM driver service ID for background SFO calibration main function */
+#define PWM_SID_SFO_MAIN_FUNCTION ((uint8)(0xFU))
+/** \brief PWM driver service ID for get SFO calibration status API */
+#define PWM_SID_GET_SFO_STATUS ((uint8)(0x10U))
+/** \brief PWM driver service ID for set SFO scale factor API */
+#define PWM_SID_SET_SFO_SCALE_FACTOR ((uint8)(0x11U))
 /** @} */
 
 /**
@@ -258,6 +271,22 @@ extern "C" {
 #define PWM_ISR_CAT2 (0x02U)
 /** @} */
 
+/**
+ *  \name PWM Background SFO Calibration States
+ *
+ *  Values of Pwm_SfoStatusType.calState
+ *  @{
+ */
+/** \brief Driver not initialized, calibration not running */
+#define PWM_SFO_CAL_STATE_IDLE ((uint8)(0U))
+/** \brief Calibrating, the startup scale factor (restored or nominal) is in use */
+#define PWM_SFO_CAL_STATE_RUNNING ((uint8)(1U))
+/** \brief Two consecutive runs agreed, their result is published */
+#define PWM_SFO_CAL_STATE_CONVERGED ((uint8)(2U))
+/** \brief Last run was out of range, the published value is kept */
+#define PWM_SFO_CAL_STATE_ERROR ((uint8)(3U))
+/** @} */
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -280,6 +309,26 @@ typedef enum
 
 } Pwm_EdgeNotificationType;
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+/** \brief Background SFO calibration status, returned by Pwm_GetSfoStatus */
+typedef struct
+{
+    /** \brief Calibration state, one of PWM_SFO_CAL_STATE_* */
+    uint8 calState;
+    /** \brief MEP scale factor published by a calibration run or set with
+     *   Pwm_SetSfoScaleFactor. 0 while HRPWM channels run with the nominal,
+     *   uncalibrated startup value; such a value must not be stored for a
+     *   later Pwm_SetSfoScaleFactor */
+    uint16 scaleFactor;
+    /** \brief Number of completed calibration runs since Pwm_Init */
+    uint32 completedRuns;
+    /** \brief CPU cycles spent in the last Pwm_SfoMainFunction call */
+    uint32 lastStepCycles;
+    /** \brief Largest number of CPU cycles spent in one Pwm_SfoMainFunction call */
+    uint32 maxStepCycles;
+} Pwm_SfoStatusType;
+#endif
+
 #define PWM_START_SEC_VAR_INIT_8
 #include "Pwm_MemMap.h"
 /** \brief Pwm driver init status */
@@ -365,6 +414,41 @@ FUNC(void, PWM_CODE) Pwm_DeInit(void);
  *
  *****************************************************************************/
 FUNC(void, PWM_CODE) Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+
+/** \brief Service for setting the Duty Cycle of several channels together
+ *  This service sets the duty cycle of NumChannels channels inside one
+ *  critical section. For channels without high resolution the compare values
+ *  are computed first and then written back to back. The compare registers
+ *  are shadowed and loaded on counter zero, so for such channels with
+ *  synchronized time bases the new duty cycles take effect in the same PWM
+ *  period.
+ *  High resolution channels are not part of the back to back write: each is
+ *  updated through the Pwm_SetDutyCycle path while the compare values are
+ *  computed, so they only share the period with the other channels if no
+ *  counter zero event falls between their update and the back to back write.
+ *  A channel set to idle by Pwm_SetOutputToIdle is also first passed through
+ *  the Pwm_SetDutyCycle path, which releases the forced output immediately.
+ *  Duty cycle semantics per channel are the same as Pwm_SetDutyCycle.
+ *  The function can be called on task level.
+ *
+ * Mode              : Supervisor Mode (Privileged Mode)
+ *
+ * Service ID[hex]   : 0x0E
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[in] Channels - Array of channel numbers
+ * \param[in] DutyCycles - Array of duty cycles, one per channel
+ * \param[in] NumChannels - Number of entries in both arrays
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, PWM_CODE)
+Pwm_SetDutyCycleMulti(P2CONST(Pwm_ChannelType, AUTOMATIC, PWM_APPL_DATA) Channels,
+                      P2CONST(uint16, AUTOMATIC, PWM_APPL_DATA) DutyCycles, uint8 NumChannels);
 #endif
 
 #if (STD_ON == PWM_SET_PERIOD_AND_DUTY_API)
@@ -537,6 +621,67 @@ Pwm_RegisterReadback(Pwm_ChannelType PwmChannel, P2VAR(Pwm_RegisterReadbackType,
 FUNC(Pwm_OutputStateType, PWM_CODE) Pwm_GetOutputState(Pwm_ChannelType ChannelNumber);
 #endif
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+
+/** \brief Background SFO calibration main function.
+ *  Advances the MEP scale factor calibration by one step. A full calibration
+ *  run takes several calls; when two consecutive runs agree the result is
+ *  published to the HRMSTEP register with a single register write. To be
+ *  called periodically from a low priority task. Does nothing while the
+ *  driver is not initialized.
+ *
+ * Service ID[hex]   : 0x0F
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non Reentrant
+ *
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, PWM_CODE) Pwm_SfoMainFunction(void);
+
+/** \brief This function returns the background SFO calibration status,
+ *         the published scale factor and the cost of one calibration step.
+ *         The cycle counts are taken from the PMU cycle counter, which has
+ *         to be enabled by the application.
+ *
+ * Service ID[hex]   : 0x10
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Reentrant
+ *
+ * \param[out] SfoStatusPtr - Pointer to where to store the status
+ * \return Std_ReturnType
+ * \retval E_OK: Status has been copied
+ * \retval E_NOT_OK: Driver not initialized or NULL pointer
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, PWM_CODE)
+Pwm_GetSfoStatus(P2VAR(Pwm_SfoStatusType, AUTOMATIC, PWM_APPL_DATA) SfoStatusPtr);
+
+/** \brief This function sets the MEP scale factor HRPWM channels start with.
+ *         Typically used to restore the value read with Pwm_GetSfoStatus
+ *         in a previous power cycle, so that high resolution operation is
+ *         available directly after Pwm_Init. May be called before Pwm_Init;
+ *         if the driver is initialized the value is published immediately.
+ *
+ * Service ID[hex]   : 0x11
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non Reentrant
+ *
+ * \param[in] ScaleFactor - MEP scale factor, 1 to 255
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, PWM_CODE) Pwm_SetSfoScaleFactor(uint16 ScaleFactor);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
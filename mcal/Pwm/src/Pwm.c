@@ -241,6 +241,38 @@ FUNC(void, PWM_CODE) Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 Duty
     return;
 }
 
+/*  Sets the DutyCycle of several channels so that the new compare values are
+ *  latched on the same PWM period. */
+FUNC(void, PWM_CODE)
+Pwm_SetDutyCycleMulti(P2CONST(Pwm_ChannelType, AUTOMATIC, PWM_APPL_DATA) Channels,
+                      P2CONST(uint16, AUTOMATIC, PWM_APPL_DATA) DutyCycles, uint8 NumChannels)
+{
+    Std_ReturnType ret_val = E_OK;
+
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+    ret_val = Pwm_SetDutyCycleMulti_Deterror(Channels, DutyCycles, NumChannels);
+#endif
+
+    /* Check for DET Error */
+    if (ret_val == E_OK)
+    {
+        /* Enter Critical Section. */
+        SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_0();
+
+        /* Change the duty cycles. */
+        Pwm_SystemSetDutyCycleMulti(Channels, DutyCycles, NumChannels);
+
+        /* Exit Critical Section. */
+        SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_0();
+    }
+    else
+    {
+        /*do nothing */
+    }
+
+    return;
+}
+
 #endif /*(STD_ON == PWM_SET_DUTY_CYCLE_API)*/
 
 /*
@@ -467,5 +499,62 @@ Pwm_GetVersionInfo(P2VAR(Std_VersionInfoType, AUTOMATIC, PWM_APPL_DATA) VersionI
 }
 #endif /* PWM_VERSION_INFO_API*/
 
+#if (STD_ON == PWM_SFO_BACKGROUND_CAL_API)
+/*  Advances the background MEP scale factor calibration by one step. */
+FUNC(void, PWM_CODE) Pwm_SfoMainFunction(void)
+{
+    Pwm_SfoBgStep();
+}
+
+FUNC(Std_ReturnType, PWM_CODE)
+Pwm_GetSfoStatus(P2VAR(Pwm_SfoStatusType, AUTOMATIC, PWM_APPL_DATA) SfoStatusPtr)
+{
+    Std_ReturnType retVal = E_OK;
+
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+    retVal = Pwm_GetSfoStatus_Deterror(SfoStatusPtr);
+#endif
+
+    if (retVal == E_OK)
+    {
+        /* Enter Critical Section, the main function may update the status. */
+        SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_0();
+
+        *SfoStatusPtr = Pwm_SfoStatus;
+
+        /* Exit Critical Section. */
+        SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_0();
+    }
+
+    return retVal;
+}
+
+FUNC(void, PWM_CODE) Pwm_SetSfoScaleFactor(uint16 ScaleFactor)
+{
+    Std_ReturnType ret_val = E_OK;
+
+#if (STD_ON == PWM_DEV_ERROR_DETECT)
+    ret_val = Pwm_SetSfoScaleFactor_Deterror(ScaleFactor);
+#endif
+
+    if (ret_val == E_OK)
+    {
+        /* Enter Critical Section. */
+        SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_0();
+
+        Pwm_SfoBgSetScaleFactor(ScaleFactor);
+
+        /* Exit Critical Section. */
+        SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_0();
+    }
+    else
+    {
+        /*do nothing */
+    }
+
+    return;
+}
+#endif /* #if (STD_ON == PWM_SFO_BACKGROUND_CAL_API) */
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
@@ -142,6 +142,9 @@ Cdd_Uart_Object_Configuration_Mapping(CddUart_Handle CddUartHandle,
     CddUartHandle->hUartInit->transferMode     = ChannelCfgPtr->uartIOMode;
     CddUartHandle->dmaTxHandleId               = ChannelCfgPtr->edmaXbarTxHandleID;
     CddUartHandle->dmaRxHandleId               = ChannelCfgPtr->edmaXbarRxHandleID;
+#if (STD_ON == CDD_UART_RX_RING_API)
+    CddUartHandle->rxRingActive = (uint32)FALSE;
+#endif
 }
 
 /* To get the Channel Index */
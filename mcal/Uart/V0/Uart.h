@@ -1452,6 +1452,26 @@ typedef struct
 
     void *args;
     /**< Pointer to be used by application to store miscellaneous data.*/
+
+#if (STD_ON == CDD_UART_RX_RING_API)
+    /*
+     * UART circular DMA receive variables
+     */
+    uint8          *rxRingBuf;
+    /**< Ring buffer filled by the Rx DMA */
+    uint32          rxRingSize;
+    /**< Ring buffer size in bytes */
+    uint32          rxRingTail;
+    /**< Consumer read index, only written by the consumer */
+    uint32          rxRingTailWrapCnt;
+    /**< Number of times the consumer wrapped around the ring */
+    uint32          rxRingSpanLen;
+    /**< Length of the span returned by the last acquire */
+    volatile uint32 rxRingWrapCnt;
+    /**< Number of times the DMA wrapped around the ring, written by the DMA ISR */
+    volatile uint32 rxRingActive;
+    /**< TRUE while the ring receive is running */
+#endif
 } CddUart_Object, *CddUart_Handle;
 
 /* ========================================================================== */
@@ -141,6 +141,9 @@ static sint32        UART_readPolling(CddUart_Handle hUart, CddUart_Transaction
 static uint32        Cdd_Uart_getRxFifoTrigBitVal(uint32 rxTrig);
 static uint32        Cdd_Uart_getTxFifoTrigBitVal(uint32 txTrig);
 static uint32        UART_checkCharsAvailInRXFifo(uint32 baseAddr);
+#if (STD_ON == CDD_UART_TX_FIFO_REFILL)
+static inline uint32 UART_getTxFifoSpace(uint32 baseAddr);
+#endif
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -251,9 +254,33 @@ static inline uint32 UART_readData(CddUart_Handle hUart, uint32 size)
     return (rdSize);
 }
 
+#if (STD_ON == CDD_UART_TX_FIFO_REFILL)
+static inline uint32 UART_getTxFifoSpace(uint32 baseAddr)
+{
+    uint32 txFifoLvl   = HW_RD_FIELD32(baseAddr + UART_TXFIFO_LVL, UART_TXFIFO_LVL_TXFIFO_LVL);
+    uint32 txFifoSpace = 0U;
+
+    if (txFifoLvl < UART_FIFO_SIZE)
+    {
+        txFifoSpace = UART_FIFO_SIZE - txFifoLvl;
+    }
+
+    return txFifoSpace;
+}
+#endif
+
 static inline uint32 UART_writeData(CddUart_Handle hUart, uint32 writeSizeRemaining)
 {
     uint32             numBytesToTransfer, numBytesToTransferred;
+#if (STD_ON == CDD_UART_TX_FIFO_REFILL)
+    /* The THR interrupt fires once at least the TLR trigger level of space is
+     * free - top the FIFO up to full so the line never idles between refills */
+    numBytesToTransfer = UART_getTxFifoSpace(hUart->baseAddr);
+    if (numBytesToTransfer >= writeSizeRemaining)
+    {
+        numBytesToTransfer = writeSizeRemaining;
+    }
+#else
     CddUart_InitHandle hUartInit = hUart->hUartInit;
 
     /* In interrupt mode write only threshold level of data with FIFO enabled */
@@ -262,6 +289,7 @@ static inline uint32 UART_writeData(CddUart_Handle hUart, uint32 writeSizeRemain
     {
         numBytesToTransfer = hUartInit->txTrigLvl;
     }
+#endif
 
     numBytesToTransferred = numBytesToTransfer;
     /* Send characters until FIFO threshold level or done. */
@@ -1536,11 +1564,29 @@ static void UART_writeDataPolling(CddUart_Handle hUart)
 static uint32 UART_fifoWrite(CddUart_Handle hUart, const uint8 *buffer, uint32 writeSizeRemaining)
 {
     const uint8 *buf           = buffer;
-    uint32       lineStatus    = 0U;
     uint32       tempChunksize = 0U;
     sint32       maxTrialCount = (sint32)UART_TRANSMITEMPTY_TRIALCOUNT;
     uint32       size = writeSizeRemaining, remainingSize = writeSizeRemaining;
+#if (STD_ON == CDD_UART_TX_FIFO_REFILL)
+    uint32       minChunksize = hUart->hUartInit->txTrigLvl;
+#else
+    uint32       lineStatus = 0U;
+#endif
 
+#if (STD_ON == CDD_UART_TX_FIFO_REFILL)
+
+    /* Wait only for the trigger level of free FIFO space (or the rest of the
+     * buffer) and refill what is free, the shift register keeps draining */
+    if ((minChunksize == 0U) || (minChunksize > remainingSize))
+    {
+        minChunksize = remainingSize;
+    }
+    do
+    {
+        tempChunksize = UART_getTxFifoSpace(hUart->baseAddr);
+        maxTrialCount--;
+    } while ((tempChunksize < minChunksize) && ((sint32)0 < maxTrialCount));
+#else
     /* Load the fifo size  */
     tempChunksize = UART_FIFO_SIZE;
 
@@ -1554,6 +1600,7 @@ static uint32 UART_fifoWrite(CddUart_Handle hUart, const uint8 *buffer, uint32 w
     } while (((uint32)(UART_LSR_TX_SR_E_MASK | UART_LSR_TX_FIFO_E_MASK) !=
               ((uint32)(UART_LSR_TX_SR_E_MASK | UART_LSR_TX_FIFO_E_MASK) & lineStatus)) &&
              ((sint32)0 < maxTrialCount));
+#endif
 
     if (maxTrialCount > (sint32)0)
     {
@@ -1685,6 +1732,9 @@ sint32 Uart_Cdd_deInit(CddUart_Handle hUart)
 #if (STD_ON == CDD_UART_DMA_ENABLE)
         if (CDD_UART_MODE_DMA == hUart->hUartInit->transferMode)
         {
+#if (STD_ON == CDD_UART_RX_RING_API)
+            Uart_Cdd_rxRingStop(hUart);
+#endif
             status = Uart_Cdd_dmaDeInit(hUart);
         }
 #endif
@@ -1989,7 +2039,11 @@ sint32 Uart_Cdd_readDmaEx(CddUart_Handle hUart, CddUart_Transaction *trans)
     if (MCAL_SystemP_SUCCESS == status)
     {
         /* Check if any transaction is in progress */
+#if (STD_ON == CDD_UART_RX_RING_API)
+        if ((NULL_PTR != hUart->readTrans) || ((uint32)TRUE == hUart->rxRingActive))
+#else
         if (NULL_PTR != hUart->readTrans)
+#endif
         {
             trans->status = UART_TRANSFER_STATUS_ERROR_INUSE;
             status        = MCAL_SystemP_FAILURE;
@@ -2161,6 +2215,127 @@ sint32 Uart_Cdd_readCancelDma(CddUart_Handle hUart, CddUart_Transaction *trans)
 
     return (status);
 }
+
+#if (STD_ON == CDD_UART_RX_RING_API)
+sint32 Uart_Cdd_rxRingStart(CddUart_Handle hUart, uint8 *ringBuf, uint32 ringSize)
+{
+    sint32 status = MCAL_SystemP_SUCCESS;
+
+    /* Check parameters, BCNT of the PaRAM set limits the ring size */
+    if ((NULL_PTR == hUart) || (NULL_PTR == ringBuf) || (0U == ringSize) || (ringSize > (uint32)0xFFFFU))
+    {
+        status = MCAL_SystemP_INVALID_PARAM;
+    }
+
+    if (MCAL_SystemP_SUCCESS == status)
+    {
+        if ((hUart->state != MCAL_STATE_READY) || (NULL_PTR != hUart->readTrans) ||
+            ((uint32)TRUE == hUart->rxRingActive))
+        {
+            status = MCAL_SystemP_BUSY;
+        }
+    }
+
+    if (MCAL_SystemP_SUCCESS == status)
+    {
+        hUart->rxRingBuf         = ringBuf;
+        hUart->rxRingSize        = ringSize;
+        hUart->rxRingTail        = 0U;
+        hUart->rxRingTailWrapCnt = 0U;
+        hUart->rxRingSpanLen     = 0U;
+        hUart->rxRingWrapCnt     = 0U;
+        hUart->rxTimeoutCnt      = 0U;
+        hUart->rxRingActive      = (uint32)TRUE;
+
+        status = Uart_Cdd_dmaRxRingStart(hUart);
+        if (MCAL_SystemP_SUCCESS == status)
+        {
+            /* Rx timeout marks the idle line, line status reports errors */
+            UART_intrEnable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
+        }
+        else
+        {
+            Uart_Cdd_dmaRxRingStop(hUart);
+            hUart->rxRingActive = (uint32)FALSE;
+        }
+    }
+
+    return (status);
+}
+
+void Uart_Cdd_rxRingStop(CddUart_Handle hUart)
+{
+    if ((NULL_PTR != hUart) && ((uint32)TRUE == hUart->rxRingActive))
+    {
+        UART_intrDisable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
+
+        SchM_Enter_Cdd_Uart_UART_EXCLUSIVE_AREA_0();
+        Uart_Cdd_dmaRxRingStop(hUart);
+        hUart->rxRingActive = (uint32)FALSE;
+        SchM_Exit_Cdd_Uart_UART_EXCLUSIVE_AREA_0();
+    }
+}
+
+sint32 Uart_Cdd_rxRingAcquire(CddUart_Handle hUart, Cdd_Uart_RxSpanType *span)
+{
+    sint32 status = MCAL_SystemP_SUCCESS;
+    uint32  wrapCnt, head, lag;
+    uint32  tail = hUart->rxRingTail;
+    boolean wrapPending;
+
+    /* Sample head, wrap count and uncounted wrap of the same lap */
+    do
+    {
+        wrapCnt     = hUart->rxRingWrapCnt;
+        wrapPending = Uart_Cdd_dmaRxRingWrapPending(hUart);
+        head        = Uart_Cdd_dmaRxRingHead(hUart);
+    } while ((wrapCnt != hUart->rxRingWrapCnt) || (wrapPending != Uart_Cdd_dmaRxRingWrapPending(hUart)));
+
+    lag = wrapCnt - hUart->rxRingTailWrapCnt;
+
+    if (((0U == lag) || ((uint32)0xFFFFFFFFU == lag)) && (head >= tail))
+    {
+        /* Same lap, or the reader already crossed a wrap the ISR has not counted yet */
+        hUart->rxRingSpanLen = head - tail;
+    }
+    else if (((1U == lag) && (head <= tail)) || ((0U == lag) && (head < tail)))
+    {
+        /* DMA wrapped, hand out the data up to the end of the ring first */
+        hUart->rxRingSpanLen = hUart->rxRingSize - tail;
+    }
+    else
+    {
+        /* DMA overwrote unreleased data, drop everything received so far. The head
+         * is on the lap after the last counted wrap only while the completion of
+         * that wrap is still pending. A wrap the ISR has acknowledged but not yet
+         * counted costs one false overrun on the next acquire. */
+        hUart->rxRingTailWrapCnt = wrapCnt;
+        if (TRUE == wrapPending)
+        {
+            hUart->rxRingTailWrapCnt = wrapCnt + 1U;
+        }
+        hUart->rxRingTail    = head;
+        hUart->rxRingSpanLen = 0U;
+        status               = MCAL_SystemP_FAILURE;
+    }
+
+    span->DataPtr = &hUart->rxRingBuf[hUart->rxRingTail];
+    span->Length  = hUart->rxRingSpanLen;
+
+    return (status);
+}
+
+void Uart_Cdd_rxRingRelease(CddUart_Handle hUart, uint32 length)
+{
+    hUart->rxRingSpanLen -= length;
+    hUart->rxRingTail    += length;
+    if (hUart->rxRingTail >= hUart->rxRingSize)
+    {
+        hUart->rxRingTail = 0U;
+        hUart->rxRingTailWrapCnt++;
+    }
+}
+#endif /* (STD_ON == CDD_UART_RX_RING_API) */
 #endif /* (STD_ON == CDD_UART_DMA_ENABLE) */
 
 sint32 Uart_Cdd_flushTxFifo(CddUart_Handle hUart)
@@ -2308,41 +2483,52 @@ void UART_procLineStatusErr(CddUart_Handle hUart)
         if (((lineStatus & UART_FIFO_PE_FE_BI_DETECTED) == UART_FIFO_PE_FE_BI_DETECTED) ||
             ((lineStatus & UART_OVERRUN_ERROR) == UART_OVERRUN_ERROR))
         {
-            /* empty the RX FIFO which contains data with errors */
-            if (hUart->readTrans != NULL_PTR)
+#if (STD_ON == CDD_UART_RX_RING_API)
+            if ((uint32)TRUE == hUart->rxRingActive)
             {
-                hUart->readTrans->count = (uint32)(hUart->readCount);
+                /* The EDMA keeps draining the FIFO, CPU reads would steal valid bytes
+                 * from the ring. Reading LSR above already cleared the error status. */
+                Uart_Cdd_errorCallback(hUart);
             }
-
-            /* Clearing Receive Errors(FE,BI,PE)by reading erroneous data from RX FIFO */
-            /* Iteration count: Worst case = FIFO size */
-            iteration = UART_FIFO_SIZE;
-            do
+            else
+#endif
             {
-                /* Read and throw error byte */
-                /* Till Line status int is pending */
-                (void)UART_fifoCharGet(hUart->baseAddr);
+                /* empty the RX FIFO which contains data with errors */
+                if (hUart->readTrans != NULL_PTR)
+                {
+                    hUart->readTrans->count = (uint32)(hUart->readCount);
+                }
 
-                iteration--;
+                /* Clearing Receive Errors(FE,BI,PE)by reading erroneous data from RX FIFO */
+                /* Iteration count: Worst case = FIFO size */
+                iteration = UART_FIFO_SIZE;
+                do
+                {
+                    /* Read and throw error byte */
+                    /* Till Line status int is pending */
+                    (void)UART_fifoCharGet(hUart->baseAddr);
 
-                lineStatus  = (uint32)UART_readLineStatus(hUart->baseAddr);
-                lineStatus &= (UART_LSR_RX_FIFO_STS_MASK | UART_LSR_RX_BI_MASK | UART_LSR_RX_FE_MASK |
-                               UART_LSR_RX_PE_MASK | UART_LSR_RX_OE_MASK | UART_LSR_RX_FIFO_E_MASK);
-            } while ((lineStatus != (uint32)0U) && (iteration != (uint32)0U));
+                    iteration--;
 
-            UART_intrDisable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
+                    lineStatus  = (uint32)UART_readLineStatus(hUart->baseAddr);
+                    lineStatus &= (UART_LSR_RX_FIFO_STS_MASK | UART_LSR_RX_BI_MASK | UART_LSR_RX_FE_MASK |
+                                   UART_LSR_RX_PE_MASK | UART_LSR_RX_OE_MASK | UART_LSR_RX_FIFO_E_MASK);
+                } while ((lineStatus != (uint32)0U) && (iteration != (uint32)0U));
 
-            /* Reset the read buffer and read count so we can pass it back */
-            hUart->readBuf = (uint8 *)hUart->readBuf - hUart->readCount;
+                UART_intrDisable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
 
-            /* Update hUart->readTrans error status */
-            if (NULL_PTR != hUart->readTrans)
-            {
-                Uart_Cdd_readTransErrorStatus(hUart, lineStatus);
-            }
+                /* Reset the read buffer and read count so we can pass it back */
+                hUart->readBuf = (uint8 *)hUart->readBuf - hUart->readCount;
 
-            hUart->readTrans = (CddUart_Transaction *)NULL_PTR;
-            Uart_Cdd_errorCallback(hUart);
+                /* Update hUart->readTrans error status */
+                if (NULL_PTR != hUart->readTrans)
+                {
+                    Uart_Cdd_readTransErrorStatus(hUart, lineStatus);
+                }
+
+                hUart->readTrans = (CddUart_Transaction *)NULL_PTR;
+                Uart_Cdd_errorCallback(hUart);
+            }
         }
     }
 }
@@ -2488,6 +2674,29 @@ static boolean Uart_Cdd_masterIsr_processInterrupt(CddUart_Handle hUart, uint32
             /* RX line status error */
             UART_procLineStatusErr(hUart);
         }
+#if (STD_ON == CDD_UART_RX_RING_API)
+        else if ((uint32)TRUE == hUart->rxRingActive)
+        {
+            /* The EDMA drains the FIFO, only the Rx timeout needs the CPU */
+            if ((intType & UART_INTID_CHAR_TIMEOUT) == UART_INTID_CHAR_TIMEOUT)
+            {
+                UART_intrDisable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
+                /* Work around for errata i2310 */
+                if (FALSE == UART_checkCharsAvailInRXFifo(hUart->baseAddr))
+                {
+                    UART_i2310WA(hUart->baseAddr);
+                }
+
+                /* Move the bytes below the trigger level into the ring */
+                Uart_Cdd_dmaRxRingFlush(hUart);
+                hUart->rxTimeoutCnt++;
+                UART_intrEnable(hUart->baseAddr, UART_INTR_RHR_CTI | UART_INTR_LINE_STAT);
+
+                /* Idle line, notify the reader */
+                Uart_Cdd_readCompleteCallback(hUart);
+            }
+        }
+#endif
         else
         {
             if ((intType & UART_INTID_CHAR_TIMEOUT) == UART_INTID_CHAR_TIMEOUT)
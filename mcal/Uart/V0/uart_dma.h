@@ -141,6 +141,55 @@ void UART_edmaIsrTx(void *args);
  */
 void UART_edmaIsrRx(void *args);
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+/**
+ * \brief API to start the circular receive into hUart->rxRingBuf
+ *
+ * The receive PaRAM set links to a self linked copy so the EDMA restarts at
+ * the start of the ring after every rxRingSize bytes.
+ *
+ * \param hUart         [in] UART Handle
+ *
+ * \return MCAL_SystemP_SUCCESS on success, else failure
+ */
+sint32 Uart_Cdd_dmaRxRingStart(CddUart_Handle hUart);
+
+/**
+ * \brief API to stop the circular receive
+ *
+ * \param hUart         [in] UART Handle
+ */
+void Uart_Cdd_dmaRxRingStop(CddUart_Handle hUart);
+
+/**
+ * \brief API to get the ring index the EDMA writes next
+ *
+ * \param hUart         [in] UART Handle
+ *
+ * \return Write index, 0 to rxRingSize - 1
+ */
+uint32 Uart_Cdd_dmaRxRingHead(CddUart_Handle hUart);
+
+/**
+ * \brief API to check for a ring wrap the EDMA completion ISR has not counted yet
+ *
+ * \param hUart         [in] UART Handle
+ *
+ * \return TRUE if the completion of the receive channel is still pending
+ */
+boolean Uart_Cdd_dmaRxRingWrapPending(CddUart_Handle hUart);
+
+/**
+ * \brief API to move the bytes left below the Rx FIFO trigger level into the ring
+ *
+ * The bytes are moved by manual EDMA triggers so that the EDMA stays the only
+ * writer of the ring.
+ *
+ * \param hUart         [in] UART Handle
+ */
+void Uart_Cdd_dmaRxRingFlush(CddUart_Handle hUart);
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
@@ -84,6 +84,15 @@
 /** \brief Receive EDMA channel event queue number                            */
 #define CDD_EDMA_UART_RX_EVT_QUEUE_NO (1U)
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+/** \brief Receive PaRAM set index of the circular receive                    */
+#define CDD_EDMA_UART_RX_RING_PARAM (0U)
+/** \brief Self linked reload PaRAM set index of the circular receive         */
+#define CDD_EDMA_UART_RX_RING_RELOAD_PARAM (1U)
+/** \brief Polls of the Rx FIFO level allowed for one manual trigger          */
+#define CDD_EDMA_UART_RX_RING_FLUSH_WAIT (1000U)
+#endif
+
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -274,6 +283,116 @@ sint32 Uart_Cdd_dmaRead(CddUart_Handle hUart, const CddUart_Transaction *transac
     return status;
 }
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+sint32 Uart_Cdd_dmaRxRingStart(CddUart_Handle hUart)
+{
+    sint32             status = MCAL_SystemP_SUCCESS;
+    Cdd_Dma_ParamEntry edmaRxParam;
+
+    /* Receive param set configuration, one byte per UART event */
+    edmaRxParam.srcPtr     = (uint8 *)hUart->baseAddr + UART_RHR;
+    edmaRxParam.destPtr    = (void *)hUart->rxRingBuf;
+    edmaRxParam.aCnt       = (uint16)1U;
+    edmaRxParam.bCnt       = (uint16)(hUart->rxRingSize);
+    edmaRxParam.cCnt       = (uint16)1U;
+    edmaRxParam.bCntReload = (uint16)edmaRxParam.bCnt;
+    edmaRxParam.srcBIdx    = (sint16)0;
+    edmaRxParam.destBIdx   = (sint16)edmaRxParam.aCnt;
+    edmaRxParam.srcCIdx    = (sint16)0;
+    edmaRxParam.destCIdx   = (sint16)0;
+    edmaRxParam.opt        = (CDD_EDMA_OPT_TCINTEN_MASK);
+
+    /* Write Rx param set */
+    Cdd_Dma_ParamSet(hUart->dmaRxHandleId, 0U, CDD_EDMA_UART_RX_RING_PARAM, edmaRxParam);
+
+    /* The self linked reload set restarts the ring forever, every wrap
+     * raises the completion interrupt */
+    Cdd_Dma_ReloadParamSet(hUart->dmaRxHandleId, CDD_EDMA_UART_RX_RING_RELOAD_PARAM, CDD_EDMA_UART_RX_RING_RELOAD_PARAM,
+                           edmaRxParam);
+    Cdd_Dma_LinkChannel(hUart->dmaRxHandleId, CDD_EDMA_UART_RX_RING_PARAM, CDD_EDMA_UART_RX_RING_RELOAD_PARAM);
+
+    /* Set event trigger to start UART RX transfer */
+    if ((boolean)FALSE == Cdd_Dma_EnableTransferRegion(hUart->dmaRxHandleId, CDD_EDMA_TRIG_MODE_EVENT))
+    {
+        status = MCAL_SystemP_FAILURE;
+    }
+
+    return status;
+}
+
+void Uart_Cdd_dmaRxRingStop(CddUart_Handle hUart)
+{
+    (void)Cdd_Dma_DisableTransferRegion(hUart->dmaRxHandleId, CDD_EDMA_TRIG_MODE_EVENT);
+
+    return;
+}
+
+boolean Uart_Cdd_dmaRxRingWrapPending(CddUart_Handle hUart)
+{
+    const Cdd_Dma_Handler *hEdma   = Cdd_Dma_Config.CddDmaDriverHandler[hUart->dmaRxHandleId];
+    boolean                pending = FALSE;
+
+    /* The IPR bit stays set from the end of a lap until the ISR has counted it */
+    if (CDD_EDMA_lld_readIntrStatusRegion(hEdma->baseAddr, hEdma->edmaConfig.regionId, hEdma->edmaConfig.tcc) != 0U)
+    {
+        pending = TRUE;
+    }
+
+    return pending;
+}
+
+uint32 Uart_Cdd_dmaRxRingHead(CddUart_Handle hUart)
+{
+    uint32                     head;
+    CDD_EDMACCEDMACCPaRAMEntry activeParam;
+
+    Cdd_Dma_GetParam(hUart->dmaRxHandleId, 0U, CDD_EDMA_UART_RX_RING_PARAM, &activeParam);
+
+    /* BCNT counts down the bytes left before the wrap */
+    head = hUart->rxRingSize - (uint32)activeParam.bCnt;
+    if (head >= hUart->rxRingSize)
+    {
+        head = 0U;
+    }
+
+    return head;
+}
+
+void Uart_Cdd_dmaRxRingFlush(CddUart_Handle hUart)
+{
+    uint32 baseAddr = Cdd_Dma_Config.CddDmaDriverHandler[hUart->dmaRxHandleId]->baseAddr;
+    uint32 regionId = Cdd_Dma_Config.CddDmaDriverHandler[hUart->dmaRxHandleId]->edmaConfig.regionId;
+    uint32 channel =
+        Cdd_Dma_Config.CddDmaDriverHandler[hUart->dmaRxHandleId]->edmaConfig.ownResource.channelGroup[0]->channelId;
+    uint32 fifoLvl = HW_RD_FIELD32(hUart->baseAddr + UART_RXFIFO_LVL, UART_RXFIFO_LVL_RXFIFO_LVL);
+    uint32 newLvl;
+    uint32 waitCnt;
+
+    /* Bytes below the trigger level raise no UART DMA event. Each manual
+     * trigger moves one byte from RHR, the same as a UART event would. */
+    while (0U != fifoLvl)
+    {
+        CDD_EDMA_lld_setEvtRegion(baseAddr, regionId, channel);
+
+        waitCnt = 0U;
+        do
+        {
+            newLvl = HW_RD_FIELD32(hUart->baseAddr + UART_RXFIFO_LVL, UART_RXFIFO_LVL_RXFIFO_LVL);
+            waitCnt++;
+        } while ((newLvl >= fifoLvl) && (waitCnt < CDD_EDMA_UART_RX_RING_FLUSH_WAIT));
+
+        if (newLvl >= fifoLvl)
+        {
+            /* EDMA did not service the trigger, leave the rest for the next event */
+            break;
+        }
+        fifoLvl = newLvl;
+    }
+
+    return;
+}
+#endif
+
 void UART_edmaIsrTx(void *args)
 {
     CddUart_Handle hUart;
@@ -304,11 +423,21 @@ void UART_edmaIsrRx(void *args)
     /* Check parameters */
     if (NULL_PTR != args)
     {
-        hUart                    = (CddUart_Handle)args;
-        hUart->readTrans->status = UART_TRANSFER_STATUS_SUCCESS;
-        hUart->readTrans         = (CddUart_Transaction *)NULL_PTR;
-        hUart->readSizeRemaining = 0;
-        Uart_Cdd_readCompleteCallback(hUart);
+        hUart = (CddUart_Handle)args;
+#if (STD_ON == CDD_UART_RX_RING_API)
+        if ((uint32)TRUE == hUart->rxRingActive)
+        {
+            /* Ring wrapped, the reload set already restarted the transfer */
+            hUart->rxRingWrapCnt++;
+        }
+        else
+#endif
+        {
+            hUart->readTrans->status = UART_TRANSFER_STATUS_SUCCESS;
+            hUart->readTrans         = (CddUart_Transaction *)NULL_PTR;
+            hUart->readSizeRemaining = 0;
+            Uart_Cdd_readCompleteCallback(hUart);
+        }
     }
 
     return;
@@ -202,6 +202,14 @@ extern "C" {
 #define CDD_UART_DEINIT_SERVICE_ID 0x0BU
 /** \brief API Service ID for ISR */
 #define CDD_UART_INTERNAL_ISR_ID 0x0CU
+/** \brief API Service ID for circular receive start API */
+#define CDD_UART_RXRINGSTART_SERVICE_ID 0x0EU
+/** \brief API Service ID for circular receive stop API */
+#define CDD_UART_RXRINGSTOP_SERVICE_ID 0x0FU
+/** \brief API Service ID for circular receive acquire API */
+#define CDD_UART_RXACQUIRE_SERVICE_ID 0x10U
+/** \brief API Service ID for circular receive release API */
+#define CDD_UART_RXRELEASE_SERVICE_ID 0x11U
 /** @} */
 
 /**
@@ -240,6 +248,9 @@ extern "C" {
 
 /** \brief Error code indicating invalid UART configuration */
 #define CDD_UART_E_INVALID_CONFIG 0x0AU
+
+/** \brief Error code indicating the Rx DMA overwrote data not yet released */
+#define CDD_UART_E_RX_OVERRUN 0x0BU
 /** @} */
 /**
  *  UART_TXFIFO
@@ -364,7 +375,16 @@ typedef uint8_least CddUartDataDirectionType;
 /*                         Structures and Enums                     */
 /* ================================================================ */
 
-/** None */
+#if (STD_ON == CDD_UART_RX_RING_API)
+/** \brief Contiguous span of received data inside the circular receive buffer */
+typedef struct
+{
+    CddUartDataBufferType *DataPtr;
+    /**< Start of the received data, valid until released */
+    uint32                 Length;
+    /**< Number of contiguous bytes available at DataPtr */
+} Cdd_Uart_RxSpanType;
+#endif
 
 /* ========================================================================== */
 /*                          Function Declarations                             */
@@ -567,6 +587,87 @@ FUNC(uint32, CDD_UART_CODE)
 Cdd_Uart_GetRemainingWords(uint8 ChannelID, CddUartDataDirectionType TransferType);
 #endif
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+/** \brief Service to start continuous reception into a circular buffer.
+ * The Rx EDMA channel of a DMA mode channel fills RingBufferPtr forever, wrapping
+ * at RingSize through a self linked PaRAM set. Every Rx timeout (idle line) moves
+ * the bytes left below the FIFO trigger level into the ring and invokes the read
+ * notification. The buffer must be visible to the DMA (non-cached or coherent).
+ * The Rx DMA handle must own at least two PaRAM sets.
+ *
+ * Service ID[hex]   : 0x0E
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non-Reentrant
+ *
+ * \param[in] ChannelID - Channel number configured in DMA mode
+ * \param[in] RingBufferPtr - Pointer to the circular receive buffer
+ * \param[in] RingSize - Size of the buffer in bytes, 1 to 65535
+ * \return Std_ReturnType
+ * \retval E_OK: Reception started
+ *         E_NOT_OK: Channel busy, Rx DMA handle with fewer than two PaRAM
+ *         sets or the DMA could not be started
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, CDD_UART_CODE)
+Cdd_Uart_RxRingStart(uint8 ChannelID, P2VAR(CddUartDataBufferType, AUTOMATIC, CDD_UART_APPL_DATA) RingBufferPtr,
+                     uint32 RingSize);
+
+/** \brief Service to stop the continuous reception of a channel.
+ *
+ * Service ID[hex]   : 0x0F
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non-Reentrant
+ *
+ * \param[in] ChannelID - Channel number
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, CDD_UART_CODE) Cdd_Uart_RxRingStop(uint8 ChannelID);
+
+/** \brief Service to get the oldest contiguous span of received data.
+ * Lock free: the DMA is the only writer of the ring and the caller the only
+ * reader, so the service can run concurrently with reception. At the end of
+ * the buffer the span stops and the next acquire returns the data from the
+ * start of the ring.
+ *
+ * Service ID[hex]   : 0x10
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non-Reentrant
+ *
+ * \param[in] ChannelID - Channel number with a running circular reception
+ * \param[out] SpanPtr - Span of received data, Length is 0 when nothing is pending
+ * \return Std_ReturnType
+ * \retval E_OK: Span returned
+ *         E_NOT_OK: The DMA overwrote unreleased data, the ring was resynchronized
+ *
+ *****************************************************************************/
+FUNC(Std_ReturnType, CDD_UART_CODE)
+Cdd_Uart_RxAcquire(uint8 ChannelID, P2VAR(Cdd_Uart_RxSpanType, AUTOMATIC, CDD_UART_APPL_DATA) SpanPtr);
+
+/** \brief Service to give consumed bytes of the last acquired span back to the DMA.
+ *
+ * Service ID[hex]   : 0x11
+ *
+ * Sync/Async        : Synchronous
+ *
+ * Reentrancy        : Non-Reentrant
+ *
+ * \param[in] ChannelID - Channel number with a running circular reception
+ * \param[in] Length - Number of bytes consumed, not more than the acquired length
+ * \return None
+ * \retval None
+ *
+ *****************************************************************************/
+FUNC(void, CDD_UART_CODE) Cdd_Uart_RxRelease(uint8 ChannelID, uint32 Length);
+#endif
+
 /** \brief This API Initializes the UART instance
  *
  * \param[in] hUart - Handle to the UART instance used
@@ -691,6 +792,44 @@ sint32 Uart_Cdd_readCancel(CddUart_Handle hUart, CddUart_Transaction *trans);
  *****************************************************************************/
 sint32 Uart_Cdd_readCancelDma(CddUart_Handle hUart, CddUart_Transaction *trans);
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+/** \brief This API starts the circular DMA reception of the UART instance
+ *
+ * \param[in] hUart - Handle to the UART instance used
+ * \param[in] ringBuf - Pointer to the circular receive buffer
+ * \param[in] ringSize - Size of the circular receive buffer in bytes
+ * \return sint32
+ * \retval MCAL_SystemP_SUCCESS if successful else error on failure
+ *
+ *****************************************************************************/
+sint32 Uart_Cdd_rxRingStart(CddUart_Handle hUart, uint8 *ringBuf, uint32 ringSize);
+
+/** \brief This API stops the circular DMA reception of the UART instance
+ *
+ * \param[in] hUart - Handle to the UART instance used
+ *
+ *****************************************************************************/
+void Uart_Cdd_rxRingStop(CddUart_Handle hUart);
+
+/** \brief This API returns the oldest contiguous span of the circular receive buffer
+ *
+ * \param[in] hUart - Handle to the UART instance used
+ * \param[out] span - Received data span
+ * \return sint32
+ * \retval MCAL_SystemP_SUCCESS if successful, MCAL_SystemP_FAILURE on overrun
+ *
+ *****************************************************************************/
+sint32 Uart_Cdd_rxRingAcquire(CddUart_Handle hUart, Cdd_Uart_RxSpanType *span);
+
+/** \brief This API releases consumed bytes of the circular receive buffer
+ *
+ * \param[in] hUart - Handle to the UART instance used
+ * \param[in] length - Number of bytes consumed
+ *
+ *****************************************************************************/
+void Uart_Cdd_rxRingRelease(CddUart_Handle hUart, uint32 length);
+#endif
+
 /**
  * @}
  */
@@ -96,6 +96,12 @@
 #error "CDD UART: Software Version Numbers are inconsistent!!"
 #endif
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+/* PaRAM sets of the receive DMA handle used by the circular receive:
+ * the receive set and its self linked reload copy */
+#define CDD_UART_RX_RING_NUM_PARAMS (2U)
+#endif
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -561,6 +567,125 @@ Cdd_Uart_GetRemainingWords(uint8 ChannelID, CddUartDataDirectionType TransferTyp
 }
 #endif /* (STD_ON == CDD_UART_GETREMAININGWORDS_API) */
 
+#if (STD_ON == CDD_UART_RX_RING_API)
+FUNC(Std_ReturnType, CDD_UART_CODE)
+Cdd_Uart_RxRingStart(uint8 ChannelID, P2VAR(CddUartDataBufferType, AUTOMATIC, CDD_UART_APPL_DATA) RingBufferPtr,
+                     uint32 RingSize)
+{
+    Std_ReturnType startStatus = (Std_ReturnType)E_NOT_OK;
+
+#if (STD_ON == CDD_UART_DEV_ERROR_DETECT)
+    if (Cdd_Uart_TransferParamsDetCheck(CDD_UART_RXRINGSTART_SERVICE_ID, ChannelID, RingBufferPtr, RingSize) !=
+        (Std_ReturnType)E_OK)
+    {
+        /* DET already reported */
+    }
+    else if ((RingSize > (uint32)0xFFFFU) ||
+             (CddUart_ChannelObjects[ChannelID].hUartInit->transferMode != CDD_UART_MODE_DMA))
+    {
+        CddUart_ReportDetError(CDD_UART_RXRINGSTART_SERVICE_ID, CDD_UART_E_PARAM_VALUE);
+    }
+    else if (Cdd_Dma_Config.CddDmaDriverHandler[CddUart_ChannelObjects[ChannelID].dmaRxHandleId]
+                 ->edmaConfig.ownResource.channelGroup[0]
+                 ->maxParam < CDD_UART_RX_RING_NUM_PARAMS)
+    {
+        /* Receive DMA handle without the reload PaRAM set */
+        CddUart_ReportDetError(CDD_UART_RXRINGSTART_SERVICE_ID, CDD_UART_E_PARAM_VALUE);
+    }
+    else
+#endif
+    {
+        if (Uart_Cdd_rxRingStart(&CddUart_ChannelObjects[ChannelID], RingBufferPtr, RingSize) ==
+            MCAL_SystemP_SUCCESS)
+        {
+            startStatus = (Std_ReturnType)E_OK;
+        }
+    }
+
+    return startStatus;
+}
+
+FUNC(void, CDD_UART_CODE) Cdd_Uart_RxRingStop(uint8 ChannelID)
+{
+#if (STD_ON == CDD_UART_DEV_ERROR_DETECT)
+    if (CDD_UART_UNINIT == CddUart_DriverStatus)
+    {
+        CddUart_ReportDetError(CDD_UART_RXRINGSTOP_SERVICE_ID, CDD_UART_E_UNINIT);
+    }
+    else if (ChannelID >= CDD_UART_NUM_CHANNELS)
+    {
+        CddUart_ReportDetError(CDD_UART_RXRINGSTOP_SERVICE_ID, CDD_UART_E_INVALID_CHANNEL);
+    }
+    else
+#endif
+    {
+        Uart_Cdd_rxRingStop(&CddUart_ChannelObjects[ChannelID]);
+    }
+}
+
+FUNC(Std_ReturnType, CDD_UART_CODE)
+Cdd_Uart_RxAcquire(uint8 ChannelID, P2VAR(Cdd_Uart_RxSpanType, AUTOMATIC, CDD_UART_APPL_DATA) SpanPtr)
+{
+    Std_ReturnType acquireStatus = (Std_ReturnType)E_NOT_OK;
+
+#if (STD_ON == CDD_UART_DEV_ERROR_DETECT)
+    if (CDD_UART_UNINIT == CddUart_DriverStatus)
+    {
+        CddUart_ReportDetError(CDD_UART_RXACQUIRE_SERVICE_ID, CDD_UART_E_UNINIT);
+    }
+    else if (ChannelID >= CDD_UART_NUM_CHANNELS)
+    {
+        CddUart_ReportDetError(CDD_UART_RXACQUIRE_SERVICE_ID, CDD_UART_E_INVALID_CHANNEL);
+    }
+    else if (NULL_PTR == SpanPtr)
+    {
+        CddUart_ReportDetError(CDD_UART_RXACQUIRE_SERVICE_ID, CDD_UART_E_PARAM_POINTER);
+    }
+    else if ((uint32)TRUE != CddUart_ChannelObjects[ChannelID].rxRingActive)
+    {
+        CddUart_ReportDetError(CDD_UART_RXACQUIRE_SERVICE_ID, CDD_UART_E_INVALID_EVENT);
+    }
+    else
+#endif
+    {
+        if (Uart_Cdd_rxRingAcquire(&CddUart_ChannelObjects[ChannelID], SpanPtr) == MCAL_SystemP_SUCCESS)
+        {
+            acquireStatus = (Std_ReturnType)E_OK;
+        }
+        else
+        {
+            /* Runtime error, the reader did not keep up with the line */
+            (void)Det_ReportRuntimeError(CDD_UART_MODULE_ID, CDD_UART_INSTANCE_ID, CDD_UART_RXACQUIRE_SERVICE_ID,
+                                         CDD_UART_E_RX_OVERRUN);
+        }
+    }
+
+    return acquireStatus;
+}
+
+FUNC(void, CDD_UART_CODE) Cdd_Uart_RxRelease(uint8 ChannelID, uint32 Length)
+{
+#if (STD_ON == CDD_UART_DEV_ERROR_DETECT)
+    if (CDD_UART_UNINIT == CddUart_DriverStatus)
+    {
+        CddUart_ReportDetError(CDD_UART_RXRELEASE_SERVICE_ID, CDD_UART_E_UNINIT);
+    }
+    else if (ChannelID >= CDD_UART_NUM_CHANNELS)
+    {
+        CddUart_ReportDetError(CDD_UART_RXRELEASE_SERVICE_ID, CDD_UART_E_INVALID_CHANNEL);
+    }
+    else if (Length > CddUart_ChannelObjects[ChannelID].rxRingSpanLen)
+    {
+        CddUart_ReportDetError(CDD_UART_RXRELEASE_SERVICE_ID, CDD_UART_E_PARAM_VALUE);
+    }
+    else
+#endif
+    {
+        Uart_Cdd_rxRingRelease(&CddUart_ChannelObjects[ChannelID], Length);
+    }
+}
+#endif /* (STD_ON == CDD_UART_RX_RING_API) */
+
 /* Invoke Callback functions */
 __attribute__((weak)) void Uart_Cdd_readCompleteCallback(CddUart_Handle hUart)
 {
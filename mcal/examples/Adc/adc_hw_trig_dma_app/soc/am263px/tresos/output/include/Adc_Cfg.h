@@ -239,6 +239,18 @@ extern "C" {
 /** \brief Enable/disable ADC polling main function API */
 #define ADC_POLLING_MAINFUNCTION_API        (STD_ON)
 
+/** \brief Enable/disable ADC lock-free stream acquire/release API */
+#define ADC_STREAM_ACQUIRE_API              (STD_OFF)
+
+/** \brief Enable/disable ADC DMA ping-pong streaming API */
+#define ADC_DMA_PING_PONG_API               (STD_OFF)
+
+/** \brief Enable/disable ADC post-processing block (PPB) and oversampled read API */
+#define ADC_PPB_API                         (STD_OFF)
+
+/** \brief Enable/disable ADC result post-processing kernels (Adc_PostProc.h) */
+#define ADC_POST_PROC_API                   (STD_OFF)
+
 /**
  *  \name Adc Group Id names
  *
@@ -124,6 +124,7 @@ extern "C" {
 /** \brief Enable/Disable CDD DMA get version info API */
 #define CDD_DMA_VERSION_INFO_API                                          (STD_ON)
 #define CDD_DMA_DEINIT_API                                                (STD_ON)
+#define CDD_DMA_STATISTICS_API                                            (STD_OFF)
 
 #define CDD_DMA_MAX_HANDLER                                               5
 #define CDD_DMA_MAX_CHANNEL                                               1
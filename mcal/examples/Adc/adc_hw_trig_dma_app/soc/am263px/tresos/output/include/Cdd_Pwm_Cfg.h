@@ -146,6 +146,9 @@ extern "C" {
 /** \brief Enable/Disable CDD_PWM Cdd_Pwm_SetOutputToIdle API. */
 #define CDD_PWM_SET_OUTPUT_TO_IDLE_API        (STD_ON)
 
+/** \brief Enable/Disable CDD_PWM synchronized multi channel global load update APIs. */
+#define CDD_PWM_GLOBAL_LOAD_UPDATE_API        (STD_OFF)
+
 /** \brief Enable/Disable CDD_PWM Cdd_Pwm_GetCounterStatus API. */
 #define CDD_PWM_COUNTER_STATUS_MODE        (STD_ON)
 
@@ -0,0 +1,327 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     AdcPostProcBench.c
+ *
+ *  \brief    Host benchmark of the Adc post-processing kernels against the naive loops they
+ *            replace. Each kernel is run on the same 12-bit test signal as a straightforward
+ *            reference loop, the outputs are compared and the host time per sample of both is
+ *            reported. The statistics are also fed from odd addresses and lengths and in
+ *            several calls, to cover the pair loop and its tails.
+ *
+ *            Built a second time with dsp_emul/arm_acle.h, the ARM DSP path of Adc_PostProc.c
+ *            runs with C models of the intrinsics: that build checks the results of the DSP
+ *            path, its timing has no meaning. Cycle counts for the R5F have to be measured on
+ *            the target.
+ */
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Adc_PostProc.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define ADC_BENCH_NUM_SAMPLES (4096U)
+#define ADC_BENCH_REPEAT      (2000U)
+#define ADC_BENCH_DECIMATION  (8U)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+static Adc_ValueGroupType AdcBench_Src[ADC_BENCH_NUM_SAMPLES + 1U];
+static sint16             AdcBench_Q15[ADC_BENCH_NUM_SAMPLES];
+static sint16             AdcBench_Q15Ref[ADC_BENCH_NUM_SAMPLES];
+static sint32             AdcBench_Q31[ADC_BENCH_NUM_SAMPLES];
+static sint32             AdcBench_Q31Ref[ADC_BENCH_NUM_SAMPLES];
+static Adc_ValueGroupType AdcBench_Dec[ADC_BENCH_NUM_SAMPLES];
+static Adc_ValueGroupType AdcBench_DecRef[ADC_BENCH_NUM_SAMPLES];
+static uint32             AdcBench_Errors;
+
+/* Kernel parameters, volatile so that neither side is compiled for constants */
+static volatile sint16 AdcBench_OffsetQ15 = 2048;
+static volatile sint16 AdcBench_GainQ15   = 0x6CCD; /* 0.85 */
+static volatile uint8  AdcBench_ShiftQ15  = 3U;
+static volatile sint32 AdcBench_OffsetQ31 = 2048;
+static volatile sint32 AdcBench_GainQ31   = 0x6CCCCCCD; /* 0.85 */
+static volatile uint8  AdcBench_ShiftQ31  = 19U;
+static volatile uint32 AdcBench_Factor = ADC_BENCH_DECIMATION;
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+static double AdcBench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void AdcBench_Report(const char *name, double kernelNs, double naiveNs, boolean match)
+{
+    double perSample = 1.0 / ((double)ADC_BENCH_NUM_SAMPLES * (double)ADC_BENCH_REPEAT);
+
+    printf("%-10s kernel %6.3f ns/sample  naive %6.3f ns/sample  speedup %5.2f  %s\n", name, kernelNs * perSample,
+           naiveNs * perSample, naiveNs / kernelNs, (match == TRUE) ? "match" : "MISMATCH");
+    if (match == FALSE)
+    {
+        AdcBench_Errors++;
+    }
+}
+
+/* Naive reference loops, written the way a consumer of Adc_ReadGroup results would. They
+ * take the same run-time parameters as the kernels and are kept out of line, so that the
+ * host compiler does not specialize them for the constants of this bench. */
+__attribute__((noinline)) static void AdcBench_NaiveScaleQ15(const Adc_ValueGroupType *src, sint16 *dst, uint32 n,
+                                                             sint16 offset, sint16 gain, uint8 shift)
+{
+    uint32 i;
+    sint64 v;
+
+    for (i = 0U; i < n; i++)
+    {
+        v = (sint64)src[i] - offset;
+        v = (v > 32767) ? 32767 : ((v < -32768) ? -32768 : v);
+        v = ((v * gain) + ((sint64)1 << (14 - shift))) >> (15 - shift);
+        dst[i] = (sint16)((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+    }
+}
+
+__attribute__((noinline)) static void AdcBench_NaiveScaleQ31(const Adc_ValueGroupType *src, sint32 *dst, uint32 n,
+                                                             sint32 offset, sint32 gain, uint8 shift)
+{
+    uint32 i;
+    sint64 v;
+
+    for (i = 0U; i < n; i++)
+    {
+        v = ((((sint64)src[i] - offset) * gain) + ((sint64)1 << (30 - shift))) >> (31 - shift);
+        dst[i] = (sint32)((v > 0x7FFFFFFF) ? 0x7FFFFFFF : ((v < -(sint64)0x80000000) ? -(sint64)0x80000000 : v));
+    }
+}
+
+__attribute__((noinline)) static void AdcBench_NaiveStats(const Adc_ValueGroupType *src, uint32 n, Adc_PostProcStatsType *stats)
+{
+    uint32 i;
+    double sum = 0.0, sumSq = 0.0;
+
+    stats->min = 0xFFFFU;
+    stats->max = 0U;
+    for (i = 0U; i < n; i++)
+    {
+        stats->min = (src[i] < stats->min) ? src[i] : stats->min;
+        stats->max = (src[i] > stats->max) ? src[i] : stats->max;
+        sum       += (double)src[i];
+        sumSq     += (double)src[i] * (double)src[i];
+    }
+    stats->mean = (Adc_ValueGroupType)lround(sum / (double)n);
+    stats->rms  = (Adc_ValueGroupType)lround(sqrt(sumSq / (double)n));
+}
+
+__attribute__((noinline)) static uint32 AdcBench_NaiveDecimate(const Adc_ValueGroupType *src,
+                                                                Adc_ValueGroupType *dst, uint32 n, uint32 factor)
+{
+    uint32 i, k, sum;
+
+    for (i = 0U; i < (n / factor); i++)
+    {
+        sum = 0U;
+        for (k = 0U; k < factor; k++)
+        {
+            sum += src[(i * factor) + k];
+        }
+        dst[i] = (Adc_ValueGroupType)((sum + (factor / 2U)) / factor);
+    }
+    return n / factor;
+}
+
+/* The kernel accumulator in up to three calls, from odd addresses and with odd lengths */
+static boolean AdcBench_StatsSplit(const Adc_ValueGroupType *src, uint32 n, uint32 cut1, uint32 cut2)
+{
+    Adc_PostProcAccType   acc;
+    Adc_PostProcStatsType stats, ref;
+
+    Adc_PostProcStatsInit(&acc);
+    Adc_PostProcStatsUpdate(&acc, src, cut1);
+    Adc_PostProcStatsUpdate(&acc, &src[cut1], cut2 - cut1);
+    Adc_PostProcStatsUpdate(&acc, &src[cut2], n - cut2);
+    AdcBench_NaiveStats(src, n, &ref);
+
+    return (boolean)((Adc_PostProcStatsGet(&acc, &stats) == E_OK) && (stats.min == ref.min) &&
+                     (stats.max == ref.max) && (stats.mean == ref.mean) && (abs((int)stats.rms - (int)ref.rms) <= 1));
+}
+
+/**********************************************************************************************************************
+ *  MAIN
+ *********************************************************************************************************************/
+int main(void)
+{
+    Adc_PostProcAccType   acc;
+    Adc_PostProcStatsType stats, ref;
+    volatile uint32       sink = 0U;
+    double                start, kernelNs, naiveNs;
+    uint32                i, rep, numOut = 0U, numRef = 0U;
+    boolean               match;
+
+    /* 12-bit sine with noise, a few samples at the rails */
+    srand(1U);
+    for (i = 0U; i < (ADC_BENCH_NUM_SAMPLES + 1U); i++)
+    {
+        AdcBench_Src[i] = (Adc_ValueGroupType)lround(2048.0 + (1900.0 * sin((double)i * 0.01)) + (double)(rand() % 64) - 32.0);
+    }
+    AdcBench_Src[100] = 0U;
+    AdcBench_Src[200] = 4095U;
+
+    start = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        Adc_PostProcScaleQ15(AdcBench_Src, AdcBench_Q15, ADC_BENCH_NUM_SAMPLES, AdcBench_OffsetQ15, AdcBench_GainQ15,
+                             AdcBench_ShiftQ15);
+    }
+    kernelNs = AdcBench_NowNs() - start;
+    start    = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        AdcBench_NaiveScaleQ15(AdcBench_Src, AdcBench_Q15Ref, ADC_BENCH_NUM_SAMPLES, AdcBench_OffsetQ15,
+                               AdcBench_GainQ15, AdcBench_ShiftQ15);
+    }
+    naiveNs = AdcBench_NowNs() - start;
+    AdcBench_Report("scale Q15", kernelNs, naiveNs,
+                    (boolean)(memcmp(AdcBench_Q15, AdcBench_Q15Ref, sizeof(AdcBench_Q15)) == 0));
+
+    start = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        Adc_PostProcScaleQ31(AdcBench_Src, AdcBench_Q31, ADC_BENCH_NUM_SAMPLES, AdcBench_OffsetQ31, AdcBench_GainQ31,
+                             AdcBench_ShiftQ31);
+    }
+    kernelNs = AdcBench_NowNs() - start;
+    start    = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        AdcBench_NaiveScaleQ31(AdcBench_Src, AdcBench_Q31Ref, ADC_BENCH_NUM_SAMPLES, AdcBench_OffsetQ31,
+                               AdcBench_GainQ31, AdcBench_ShiftQ31);
+    }
+    naiveNs = AdcBench_NowNs() - start;
+    AdcBench_Report("scale Q31", kernelNs, naiveNs,
+                    (boolean)(memcmp(AdcBench_Q31, AdcBench_Q31Ref, sizeof(AdcBench_Q31)) == 0));
+
+    start = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        Adc_PostProcStatsInit(&acc);
+        Adc_PostProcStatsUpdate(&acc, AdcBench_Src, ADC_BENCH_NUM_SAMPLES);
+        (void)Adc_PostProcStatsGet(&acc, &stats);
+        sink += stats.rms;
+    }
+    kernelNs = AdcBench_NowNs() - start;
+    start    = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        AdcBench_NaiveStats(AdcBench_Src, ADC_BENCH_NUM_SAMPLES, &ref);
+        sink += ref.rms;
+    }
+    naiveNs = AdcBench_NowNs() - start;
+    /* The kernel rounds the mean square before the square root, allow one LSB on the RMS */
+    match = (boolean)((stats.min == ref.min) && (stats.max == ref.max) && (stats.mean == ref.mean) &&
+                      (abs((int)stats.rms - (int)ref.rms) <= 1));
+    AdcBench_Report("stats", kernelNs, naiveNs, match);
+    printf("           min %u max %u mean %u rms %u (naive rms %u)\n", stats.min, stats.max, stats.mean, stats.rms,
+           ref.rms);
+
+    match = TRUE;
+    for (i = 0U; i < 64U; i++)
+    {
+        if ((AdcBench_StatsSplit(&AdcBench_Src[1], ADC_BENCH_NUM_SAMPLES, i, 1000U + (i * 7U)) == FALSE) ||
+            (AdcBench_StatsSplit(AdcBench_Src, i + 1U, i / 2U, i) == FALSE))
+        {
+            match = FALSE;
+        }
+    }
+    printf("stats split/unaligned: %s\n", (match == TRUE) ? "match" : "MISMATCH");
+    if (match == FALSE)
+    {
+        AdcBench_Errors++;
+    }
+
+    start = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        numOut = Adc_PostProcDecimate(AdcBench_Src, AdcBench_Dec, ADC_BENCH_NUM_SAMPLES, AdcBench_Factor);
+    }
+    kernelNs = AdcBench_NowNs() - start;
+    start    = AdcBench_NowNs();
+    for (rep = 0U; rep < ADC_BENCH_REPEAT; rep++)
+    {
+        numRef = AdcBench_NaiveDecimate(AdcBench_Src, AdcBench_DecRef, ADC_BENCH_NUM_SAMPLES, AdcBench_Factor);
+    }
+    naiveNs = AdcBench_NowNs() - start;
+    AdcBench_Report("decimate", kernelNs, naiveNs,
+                    (boolean)((numOut == numRef) &&
+                              (memcmp(AdcBench_Dec, AdcBench_DecRef, numOut * sizeof(Adc_ValueGroupType)) == 0)));
+
+    (void)sink;
+    printf("%s\n", (AdcBench_Errors == 0U) ? "PASS" : "FAIL");
+
+    return (AdcBench_Errors == 0U) ? 0 : 1;
+}
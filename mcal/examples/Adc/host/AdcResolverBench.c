@@ -0,0 +1,303 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     AdcResolverBench.c
+ *
+ *  \brief    Host test bench of the resolver pipeline of Adc_PostProc.c. Synthetic 12-bit
+ *            resolver waveforms, an amplitude modulated excitation on the sin and cos channel,
+ *            are fed through Adc_PostProcResolverProcess in DMA half-buffer sized batches that
+ *            do not align with the excitation period. The bench checks the CORDIC atan2 over a
+ *            full revolution and the tracked angle and velocity at several constant speeds,
+ *            and reports the host time per sample pair.
+ *
+ *            Host time only shows the relative cost of the stages; the cycle cost on the R5F
+ *            has to be measured on the target with the PMU cycle counter.
+ */
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Adc_PostProc.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* ADC samples per excitation period */
+#define ADC_BENCH_SAMPLES_PER_PERIOD (16U)
+/* Samples per channel of one DMA half-buffer, deliberately not a multiple of the period */
+#define ADC_BENCH_HALF_SAMPLES       (40U)
+/* Excitation periods simulated per speed */
+#define ADC_BENCH_NUM_PERIODS        (4000U)
+/* Periods allowed for the tracking loop to settle */
+#define ADC_BENCH_SETTLE_PERIODS     (1000U)
+/* Zero signal code and amplitude of the 12-bit resolver channels */
+#define ADC_BENCH_OFFSET             (2048)
+#define ADC_BENCH_AMPLITUDE          (1800.0)
+/* Phase of the resolver outputs behind the excitation, compensated in the carrier table */
+#define ADC_BENCH_DELAY_RAD          (0.3)
+/* Peak noise in LSB added to each sample */
+#define ADC_BENCH_NOISE_LSB          (2)
+/* Limits in degrees */
+#define ADC_BENCH_ATAN2_MAX_ERR_DEG  (0.001)
+#define ADC_BENCH_TRACK_MAX_ERR_DEG  (0.1)
+
+#define ADC_BENCH_PI        (3.14159265358979323846)
+#define ADC_BENCH_Q32_TO_DEG(a) ((double)(a) * (360.0 / 4294967296.0))
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+static sint16             AdcBench_Carrier[ADC_BENCH_SAMPLES_PER_PERIOD];
+static Adc_ValueGroupType AdcBench_Sin[ADC_BENCH_NUM_PERIODS * ADC_BENCH_SAMPLES_PER_PERIOD];
+static Adc_ValueGroupType AdcBench_Cos[ADC_BENCH_NUM_PERIODS * ADC_BENCH_SAMPLES_PER_PERIOD];
+static double             AdcBench_TrueAngle[ADC_BENCH_NUM_PERIODS];
+static uint32             AdcBench_Angle[ADC_BENCH_NUM_PERIODS + 1U];
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+static double AdcBench_WrapDeg(double deg)
+{
+    while (deg > 180.0)
+    {
+        deg -= 360.0;
+    }
+    while (deg < -180.0)
+    {
+        deg += 360.0;
+    }
+    return deg;
+}
+
+static double AdcBench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* Maximum error of Adc_PostProcAtan2 over a revolution for inputs of the given magnitude */
+static double AdcBench_Atan2MaxErr(double magnitude)
+{
+    double maxErr = 0.0;
+    double err, theta;
+    uint32 i;
+
+    for (i = 0U; i < 36000U; i++)
+    {
+        theta = (double)i * (2.0 * ADC_BENCH_PI / 36000.0);
+        err   = ADC_BENCH_Q32_TO_DEG(Adc_PostProcAtan2((sint32)lround(magnitude * sin(theta)),
+                                                       (sint32)lround(magnitude * cos(theta))));
+        err   = fabs(AdcBench_WrapDeg(err - (theta * 180.0 / ADC_BENCH_PI)));
+        if (err > maxErr)
+        {
+            maxErr = err;
+        }
+    }
+    return maxErr;
+}
+
+/* Host time of one Adc_PostProcAtan2 call in ns */
+static double AdcBench_Atan2TimeNs(void)
+{
+    volatile uint32 sink = 0U;
+    double          start;
+    uint32          i;
+
+    start = AdcBench_NowNs();
+    for (i = 0U; i < 1000000U; i++)
+    {
+        sink += Adc_PostProcAtan2((sint32)(i * 2654435761U) >> 8U, (sint32)(i * 40503U) - 0x100000);
+    }
+    (void)sink;
+    return (AdcBench_NowNs() - start) / 1e6;
+}
+
+/* Generates the resolver channels for a rotor at constant speed, in revolutions per period */
+static void AdcBench_Generate(double speed)
+{
+    uint32 p, s, idx;
+    double theta, carrier, noise;
+    double weight, weightSum = 0.0, centre = 0.0;
+
+    /* Demodulation weights each sample with the squared carrier, the measured angle is the
+     * one at the weighted centre of the period */
+    for (s = 0U; s < ADC_BENCH_SAMPLES_PER_PERIOD; s++)
+    {
+        weight     = (double)AdcBench_Carrier[s] * (double)AdcBench_Carrier[s];
+        weightSum += weight;
+        centre    += weight * (double)s;
+    }
+    centre /= weightSum;
+
+    for (p = 0U; p < ADC_BENCH_NUM_PERIODS; p++)
+    {
+        for (s = 0U; s < ADC_BENCH_SAMPLES_PER_PERIOD; s++)
+        {
+            idx     = (p * ADC_BENCH_SAMPLES_PER_PERIOD) + s;
+            theta   = 2.0 * ADC_BENCH_PI * speed * ((double)idx / (double)ADC_BENCH_SAMPLES_PER_PERIOD);
+            carrier = sin((2.0 * ADC_BENCH_PI * (double)s / (double)ADC_BENCH_SAMPLES_PER_PERIOD) -
+                          ADC_BENCH_DELAY_RAD);
+            noise   = (double)((rand() % ((2 * ADC_BENCH_NOISE_LSB) + 1)) - ADC_BENCH_NOISE_LSB);
+            AdcBench_Sin[idx] =
+                (Adc_ValueGroupType)lround(ADC_BENCH_OFFSET + (ADC_BENCH_AMPLITUDE * sin(theta) * carrier) + noise);
+            noise = (double)((rand() % ((2 * ADC_BENCH_NOISE_LSB) + 1)) - ADC_BENCH_NOISE_LSB);
+            AdcBench_Cos[idx] =
+                (Adc_ValueGroupType)lround(ADC_BENCH_OFFSET + (ADC_BENCH_AMPLITUDE * cos(theta) * carrier) + noise);
+        }
+        AdcBench_TrueAngle[p] = 360.0 * speed * ((double)p + (centre / (double)ADC_BENCH_SAMPLES_PER_PERIOD));
+    }
+}
+
+/* Runs the pipeline over the generated samples in half-buffer batches. Returns the number of
+ * periods and the time spent in ns. */
+static uint32 AdcBench_Run(const Adc_PostProcResolverConfigType *cfgPtr, Adc_PostProcResolverType *objPtr,
+                           double *timeNsPtr)
+{
+    uint32 total = ADC_BENCH_NUM_PERIODS * ADC_BENCH_SAMPLES_PER_PERIOD;
+    uint32 pos, batch, numPeriods = 0U;
+    double start;
+
+    Adc_PostProcResolverInit(objPtr, cfgPtr);
+    start = AdcBench_NowNs();
+    for (pos = 0U; pos < total; pos += batch)
+    {
+        batch = ((total - pos) < ADC_BENCH_HALF_SAMPLES) ? (total - pos) : ADC_BENCH_HALF_SAMPLES;
+        numPeriods += Adc_PostProcResolverProcess(objPtr, &AdcBench_Sin[pos], &AdcBench_Cos[pos], batch,
+                                                  &AdcBench_Angle[numPeriods]);
+    }
+    *timeNsPtr = AdcBench_NowNs() - start;
+    return numPeriods;
+}
+
+/**********************************************************************************************************************
+ *  MAIN
+ *********************************************************************************************************************/
+int main(void)
+{
+    static const double speeds[] = {0.0, 0.001, -0.004, 0.02, 0.05};
+    Adc_PostProcResolverConfigType cfg;
+    Adc_PostProcResolverType       obj;
+    uint32                         i, p, numPeriods;
+    double                         err, maxErr, velErr, timeNs, bestNs;
+    uint32                         errors = 0U;
+    uint32                         rep;
+
+    for (i = 0U; i < ADC_BENCH_SAMPLES_PER_PERIOD; i++)
+    {
+        AdcBench_Carrier[i] = (sint16)lround(
+            32767.0 * sin((2.0 * ADC_BENCH_PI * (double)i / (double)ADC_BENCH_SAMPLES_PER_PERIOD) - ADC_BENCH_DELAY_RAD));
+    }
+    cfg.carrierPtr       = AdcBench_Carrier;
+    cfg.samplesPerPeriod = ADC_BENCH_SAMPLES_PER_PERIOD;
+    cfg.offset           = (sint16)ADC_BENCH_OFFSET;
+    cfg.kpQ15            = (sint16)(0.5 * 32768.0);
+    cfg.kiQ15            = (sint16)(0.0625 * 32768.0);
+
+    for (i = 12U; i <= 28U; i += 4U)
+    {
+        maxErr = AdcBench_Atan2MaxErr((double)((uint32)1U << i));
+        printf("atan2 %2u-bit inputs: max error %.6f deg\n", i + 1U, maxErr);
+        if ((i >= 16U) && (maxErr > ADC_BENCH_ATAN2_MAX_ERR_DEG))
+        {
+            errors++;
+        }
+    }
+
+    printf("atan2: %.2f ns per call\n", AdcBench_Atan2TimeNs());
+
+    srand(1U);
+    for (i = 0U; i < (sizeof(speeds) / sizeof(speeds[0])); i++)
+    {
+        AdcBench_Generate(speeds[i]);
+        bestNs = 0.0;
+        for (rep = 0U; rep < 20U; rep++)
+        {
+            numPeriods = AdcBench_Run(&cfg, &obj, &timeNs);
+            if ((rep == 0U) || (timeNs < bestNs))
+            {
+                bestNs = timeNs;
+            }
+        }
+        maxErr = 0.0;
+        for (p = ADC_BENCH_SETTLE_PERIODS; p < numPeriods; p++)
+        {
+            err = fabs(AdcBench_WrapDeg(ADC_BENCH_Q32_TO_DEG(AdcBench_Angle[p]) - AdcBench_TrueAngle[p]));
+            if (err > maxErr)
+            {
+                maxErr = err;
+            }
+        }
+        velErr = ADC_BENCH_Q32_TO_DEG((double)obj.velocity) - (360.0 * speeds[i]);
+        printf("speed %+.3f rev/period: periods %u, max angle error %.4f deg, velocity error %.5f deg/period, "
+               "%.2f ns per sample pair\n",
+               speeds[i], numPeriods, maxErr, velErr,
+               bestNs / (double)(ADC_BENCH_NUM_PERIODS * ADC_BENCH_SAMPLES_PER_PERIOD));
+        if ((numPeriods != ADC_BENCH_NUM_PERIODS) || (maxErr > ADC_BENCH_TRACK_MAX_ERR_DEG) ||
+            (fabs(velErr) > ADC_BENCH_TRACK_MAX_ERR_DEG))
+        {
+            errors++;
+        }
+    }
+    printf("%s\n", (errors == 0U) ? "PASS" : "FAIL");
+
+    return (errors == 0U) ? 0 : 1;
+}
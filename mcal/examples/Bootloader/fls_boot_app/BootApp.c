@@ -81,6 +81,10 @@
 #include "trace.h"
 #include "FlsApp_Startup.h"
 #include "CacheP.h"
+#include "sys_pmu.h"
+#if (STD_ON == FLS_DMA_ENABLE)
+#include "Fls_Ospi_Edma.h"
+#endif
 
 /* Starterware Includes */
 #include "sys_vim.h"
@@ -133,6 +137,13 @@
  */
 #define HSM_CLIENT_MSG_QUEUE_SIZE (64U)
 
+/* This macro should be (1) to load the application with the pipelined loader */
+#define BOOTAPP_PIPELINED_LOAD (1)
+/* EDMA copies whole blocks of this size, the tail of a segment is copied by the CPU */
+#define BOOTAPP_EDMA_BLOCK_SIZE (1024U)
+/* Segments smaller than this are copied by the CPU */
+#define BOOTAPP_EDMA_MIN_LENGTH (4U * BOOTAPP_EDMA_BLOCK_SIZE)
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -368,6 +379,115 @@ void HsmClient_unRegister(void)
     HsmClient_unregister(&gHSMClient, HSM_BOOT_NOTIFY_CLIENT_ID);
 }
 
+#if (BOOTAPP_PIPELINED_LOAD == 1)
+#if (STD_ON == FLS_DMA_ENABLE)
+/*
+    The pipelined loader borrows the Fls EDMA handler. Fls is idle while segments are copied from the flash window,
+    the Fls callback is restored once the load is done.
+*/
+static volatile uint32 gBootAppEdmaCopyDone = FALSE;
+
+static void BootApp_edmaCopyDoneCallback(void *args)
+{
+    gBootAppEdmaCopyDone = TRUE;
+}
+
+static int32_t BootApp_edmaCopyStart(void *dstAddr, const void *srcAddr, uint32_t length, void *args)
+{
+    int32_t            status     = SystemP_SUCCESS;
+    uint32             numBlocks  = length / BOOTAPP_EDMA_BLOCK_SIZE;
+    uint32             bulkLength = 0U;
+    Cdd_Dma_ParamEntry edmaParam0, edmaParam1;
+
+    /* Same chained layout as the Fls read, the last block is moved by the second channel which raises completion */
+    if ((numBlocks < 2U) || (numBlocks > 0xFFFFU))
+    {
+        status = SystemP_FAILURE;
+    }
+    else
+    {
+        bulkLength           = (numBlocks - 1U) * BOOTAPP_EDMA_BLOCK_SIZE;
+        gBootAppEdmaCopyDone = FALSE;
+        (void)Cdd_Dma_CbkRegister(FLS_UNIT_EDMA_HANDLER, NULL_PTR, &BootApp_edmaCopyDoneCallback);
+
+        edmaParam0.srcPtr     = (void *)srcAddr;
+        edmaParam0.destPtr    = dstAddr;
+        edmaParam0.aCnt       = (uint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam0.bCnt       = (uint16)(numBlocks - 1U);
+        edmaParam0.cCnt       = (uint16)1U;
+        edmaParam0.bCntReload = (uint16)(numBlocks - 1U);
+        edmaParam0.srcBIdx    = (sint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam0.destBIdx   = (sint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam0.srcCIdx    = (sint16)0;
+        edmaParam0.destCIdx   = (sint16)0;
+        edmaParam0.opt        = (CDD_EDMA_OPT_SYNCDIM_MASK);
+
+        edmaParam1.srcPtr     = (void *)((uint32)srcAddr + bulkLength);
+        edmaParam1.destPtr    = (void *)((uint32)dstAddr + bulkLength);
+        edmaParam1.aCnt       = (uint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam1.bCnt       = (uint16)1U;
+        edmaParam1.cCnt       = (uint16)1U;
+        edmaParam1.bCntReload = (uint16)1U;
+        edmaParam1.srcBIdx    = (sint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam1.destBIdx   = (sint16)BOOTAPP_EDMA_BLOCK_SIZE;
+        edmaParam1.srcCIdx    = (sint16)0;
+        edmaParam1.destCIdx   = (sint16)0;
+        edmaParam1.opt        = (CDD_EDMA_OPT_TCINTEN_MASK | CDD_EDMA_OPT_ITCINTEN_MASK | CDD_EDMA_OPT_SYNCDIM_MASK);
+
+        Cdd_Dma_ParamSet(FLS_UNIT_EDMA_HANDLER, 0, 0, edmaParam0);
+        Cdd_Dma_ParamSet(FLS_UNIT_EDMA_HANDLER, 1, 0, edmaParam1);
+        Cdd_Dma_ChainChannel(FLS_UNIT_EDMA_HANDLER, 0, 0, 1, (CDD_EDMA_OPT_ITCCHEN_MASK | CDD_EDMA_OPT_TCCHEN_MASK));
+        Cdd_Dma_EnableTransferRegion(FLS_UNIT_EDMA_HANDLER, CDD_EDMA_TRIG_MODE_MANUAL);
+    }
+
+    return status;
+}
+
+static uint32_t BootApp_edmaCopyIsDone(void *args)
+{
+    return gBootAppEdmaCopyDone;
+}
+
+static void BootApp_edmaCopyClose(void *args)
+{
+    /* Hand the EDMA handler back to Fls */
+    (void)Fls_Ospi_dmaChInit(&Fls_DrvObj);
+}
+
+static const Bootloader_CopyEngine gBootAppEdmaCopyEngine = {
+    .startFxn  = BootApp_edmaCopyStart,
+    .isDoneFxn = BootApp_edmaCopyIsDone,
+    .closeFxn  = BootApp_edmaCopyClose,
+    .args      = NULL_PTR,
+    .blockSize = BOOTAPP_EDMA_BLOCK_SIZE,
+    .minLength = BOOTAPP_EDMA_MIN_LENGTH,
+};
+#endif /* #if (STD_ON == FLS_DMA_ENABLE) */
+
+static void BootApp_printBootTime(void)
+{
+    Bootloader_BootTimeInfo bootTimeInfo;
+    uint32_t cpuMHz = (uint32_t)(Bootloader_socCpuGetClock(MCAL_CSL_CORE_ID_R5FSS0_0) / 1000000U);
+
+    Bootloader_getBootTimeInfo(&bootTimeInfo);
+    if (cpuMHz == 0U)
+    {
+        cpuMHz = 1U;
+    }
+
+    AppUtils_printf(APP_NAME ": Boot time breakdown (us) for %d segments\n\r", bootTimeInfo.numSegments);
+    AppUtils_printf(APP_NAME ":   Header parse  : %d\n\r", bootTimeInfo.headerParseCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":   Note parse    : %d\n\r", bootTimeInfo.noteParseCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":   Segment load  : %d\n\r", bootTimeInfo.segmentLoadCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":     Copy wait   : %d\n\r", bootTimeInfo.copyWaitCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":     CPU init    : %d\n\r", bootTimeInfo.cpuInitCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":     CPU release : %d\n\r", bootTimeInfo.cpuReleaseCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":   First release : %d\n\r", bootTimeInfo.firstReleaseCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":   Total         : %d\n\r", bootTimeInfo.totalCycles / cpuMHz);
+    AppUtils_printf(APP_NAME ":   Bytes by EDMA : %d, by CPU : %d\n\r", bootTimeInfo.engineBytes, bootTimeInfo.cpuBytes);
+}
+#endif /* #if (BOOTAPP_PIPELINED_LOAD == 1) */
+
 void crypto_aes_cbc_128_main(void)
 {
     DTHE_AES_Return_t status;
@@ -625,7 +745,16 @@ int main(void)
 
     if (bootHandle != NULL_PTR)
     {
+#if (BOOTAPP_PIPELINED_LOAD == 1)
+#if (STD_ON == FLS_DMA_ENABLE)
+        status = Bootloader_parseAndLoadMultiCoreELFPipelined(bootHandle, &bootImageInfo, &gBootAppEdmaCopyEngine);
+#else
+        status = Bootloader_parseAndLoadMultiCoreELFPipelined(bootHandle, &bootImageInfo, NULL_PTR);
+#endif
+        BootApp_printBootTime();
+#else
         status = Bootloader_parseAndLoadMultiCoreELF(bootHandle, &bootImageInfo);
+#endif
         if (status == SystemP_SUCCESS)
         {
             AppUtils_printf(APP_NAME ": Parsing OK!!\n\r");
@@ -637,15 +766,18 @@ int main(void)
         }
 
         /* Run CPUs */
-        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_1)))
+        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_1)) &&
+            (FALSE == Bootloader_isCoreReleased(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_1)))
         {
             status = Bootloader_runCpu(bootHandle, &bootImageInfo.cpuInfo[MCAL_CSL_CORE_ID_R5FSS1_1]);
         }
-        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_0)))
+        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_0)) &&
+            (FALSE == Bootloader_isCoreReleased(bootHandle, MCAL_CSL_CORE_ID_R5FSS1_0)))
         {
             status = Bootloader_runCpu(bootHandle, &bootImageInfo.cpuInfo[MCAL_CSL_CORE_ID_R5FSS1_0]);
         }
-        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS0_1)))
+        if (status == SystemP_SUCCESS && (TRUE == Bootloader_isCorePresent(bootHandle, MCAL_CSL_CORE_ID_R5FSS0_1)) &&
+            (FALSE == Bootloader_isCoreReleased(bootHandle, MCAL_CSL_CORE_ID_R5FSS0_1)))
         {
             status = Bootloader_runCpu(bootHandle, &bootImageInfo.cpuInfo[MCAL_CSL_CORE_ID_R5FSS0_1]);
         }
@@ -81,6 +81,7 @@
 /*LDRA_ANALYSIS*/
 #include "trace.h"
 #include "FlsApp_Startup.h"
+#include "sys_pmu.h"
 
 /* Starterware Includes */
 #include "sys_vim.h"
@@ -164,6 +165,7 @@ void FlsApp_Startup()
     AppUtils_sectionInit();
     FlsApp_PlatformInit();
     AppUtils_TimerInit();
+    Mcal_pmuInit();
     FlsApp_InterruptConfig();
 #if (STD_ON == FLS_DMA_ENABLE)
     FlashAppDma_interruptConfig();
@@ -255,6 +255,16 @@ static void CddFlc_appDeInit(void)
     CddFlcApp_PlatformDeInit();
 }
 
+void SchM_Enter_Cdd_Flc_FLC_EXCLUSIVE_AREA_0(void)
+{
+    AppUtils_SchM_Enter_EXCLUSIVE_AREA_0();
+}
+
+void SchM_Exit_Cdd_Flc_FLC_EXCLUSIVE_AREA_0(void)
+{
+    AppUtils_SchM_Exit_EXCLUSIVE_AREA_0();
+}
+
 void SchM_Enter_Mcu_MCU_EXCLUSIVE_AREA_0(void)
 {
     AppUtils_SchM_Enter_EXCLUSIVE_AREA_0();
@@ -70,6 +70,7 @@
 #include <string.h>
 #include <Det.h>
 #include <Cdd_Flc.h>
+#include <SchM_Cdd_Flc.h>
 #include <Mcu.h>
 #include <SchM_Mcu.h>
 #include <Port.h>
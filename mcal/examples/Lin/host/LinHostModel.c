@@ -0,0 +1,477 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2025 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file     LinHostModel.c
+ *
+ *  \brief    Host LIN controller model. The LIN register block of cslr_lin.h is emulated in
+ *            memory: the hw_types.h accessors are provided here (MCAL_DYNAMIC_BUILD) so that
+ *            Lin.c and Lin_Priv.c run unmodified on Linux. A write to LINID starts a frame on
+ *            the modelled bus; its completion flags are raised in SCIFLR after the 19200 baud
+ *            frame time and the LIN ISR is called when the flag is enabled in SETINT.
+ *
+ *            The program runs a 6-slot schedule table with injected GPT tick jitter, checks
+ *            the notified status and data, and compares Lin_GetStatistics() with the frames
+ *            seen by the model. The first argument is the maximum injected jitter in cycles.
+ */
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Lin.h"
+#include "Lin_Priv.h"
+#include "cslr_lin.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* 19200 baud at a 400 MHz cycle counter */
+#define LIN_HOST_BIT_CYCLES    (20833U)
+/* Break, sync and PID field */
+#define LIN_HOST_HEADER_CYCLES (34U * LIN_HOST_BIT_CYCLES)
+/* Time after which a missing slave response is flagged */
+#define LIN_HOST_NRE_CYCLES    (4000000U)
+/* 1 ms schedule tick */
+#define LIN_HOST_TICK_CYCLES   (400000U)
+/* Interrupt entry time added before Lin_ProcessISR */
+#define LIN_HOST_ISR_CYCLES    (300U)
+/* Schedule ticks of one table cycle: sum of the slot delays */
+#define LIN_HOST_TICKS_PER_CYCLE (47U)
+#define LIN_HOST_NUM_SLOTS       (6U)
+#define LIN_HOST_NUM_CYCLES      (100U)
+
+#define LIN_HOST_REG(off) (LinHost_Regs[(off) / 4U])
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+extern const Lin_ConfigType Lin_Config;
+
+static uint32 LinHost_Regs[0x100U / 4U];
+static uint32 LinHost_Base;
+static uint32 LinHost_IntEnable;
+static uint64 LinHost_Now;
+static uint32 LinHost_RegAccesses;
+
+/* Pending bus event */
+static boolean LinHost_EvPending;
+static uint64  LinHost_EvTime;
+static uint32  LinHost_EvFlags;
+static uint32  LinHost_EvRd0;
+static uint32  LinHost_EvRd1;
+
+/* Model observations */
+static uint32 LinHost_LastTd0;
+static uint32 LinHost_LastTd1;
+static uint32 LinHost_Headers;
+static uint32 LinHost_DetCount;
+static uint32 LinHost_NotifyCount[16];
+static uint32 LinHost_Errors;
+
+/* Response of the modelled slaves */
+static const uint8 LinHost_SlaveData[8] = {0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U};
+static uint8       LinHost_MasterData[8] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+/* A LINID write sends the header and schedules the completion of the frame. ID 0x20 gets a
+ * slave response, 0x22 a response with a checksum error and any other receive ID no response. */
+static void LinHost_IdWrite(uint32 pid)
+{
+    uint32 txMask = LIN_HOST_REG(CSL_LIN_LINMASK) & 0xFFU;
+    uint32 rxMask = (LIN_HOST_REG(CSL_LIN_LINMASK) >> 16U) & 0xFFU;
+    uint32 length = ((LIN_HOST_REG(CSL_LIN_SCIFORMAT) >> 16U) & 7U) + 1U;
+
+    LinHost_Headers++;
+    LIN_HOST_REG(CSL_LIN_SCIFLR) &= ~CSL_LIN_SCIFLR_TXEMPTY_MASK;
+    LinHost_EvPending = TRUE;
+    LinHost_EvRd0     = 0U;
+    LinHost_EvRd1     = 0U;
+    if (txMask == pid)
+    {
+        LinHost_LastTd0 = LIN_HOST_REG(CSL_LIN_LINTD0);
+        LinHost_LastTd1 = LIN_HOST_REG(CSL_LIN_LINTD1);
+        LinHost_EvTime  = LinHost_Now + LIN_HOST_HEADER_CYCLES + ((length + 1U) * 10U * LIN_HOST_BIT_CYCLES);
+        LinHost_EvFlags = CSL_LIN_SCIFLR_TXEMPTY_MASK;
+    }
+    else if ((rxMask == pid) && ((pid == 0x20U) || (pid == 0x22U)))
+    {
+        LinHost_EvTime  = LinHost_Now + LIN_HOST_HEADER_CYCLES + ((length + 1U) * 10U * LIN_HOST_BIT_CYCLES);
+        LinHost_EvFlags = (pid == 0x22U) ? CSL_LIN_SCIFLR_CE_MASK : CSL_LIN_SCIFLR_RXRDY_MASK;
+        LinHost_EvRd0   = ((uint32)LinHost_SlaveData[0] << 24U) | ((uint32)LinHost_SlaveData[1] << 16U) |
+                        ((uint32)LinHost_SlaveData[2] << 8U) | (uint32)LinHost_SlaveData[3];
+        LinHost_EvRd1 = ((uint32)LinHost_SlaveData[4] << 24U) | ((uint32)LinHost_SlaveData[5] << 16U) |
+                        ((uint32)LinHost_SlaveData[6] << 8U) | (uint32)LinHost_SlaveData[7];
+    }
+    else if (rxMask == pid)
+    {
+        LinHost_EvTime  = LinHost_Now + LIN_HOST_HEADER_CYCLES + LIN_HOST_NRE_CYCLES;
+        LinHost_EvFlags = CSL_LIN_SCIFLR_NRE_MASK;
+    }
+    else
+    {
+        /* Header only */
+        LinHost_EvTime  = LinHost_Now + LIN_HOST_HEADER_CYCLES;
+        LinHost_EvFlags = CSL_LIN_SCIFLR_TXEMPTY_MASK;
+    }
+}
+
+/* Advances model time to t, delivering the pending bus event and its interrupt */
+static void LinHost_RunUntil(uint64 t)
+{
+    while ((LinHost_EvPending == TRUE) && (LinHost_EvTime <= t))
+    {
+        LinHost_Now        = LinHost_EvTime;
+        LinHost_EvPending  = FALSE;
+        LIN_HOST_REG(CSL_LIN_SCIFLR) |= LinHost_EvFlags;
+        if ((LinHost_EvRd0 | LinHost_EvRd1) != 0U)
+        {
+            LIN_HOST_REG(CSL_LIN_LINRD0) = LinHost_EvRd0;
+            LIN_HOST_REG(CSL_LIN_LINRD1) = LinHost_EvRd1;
+        }
+        if ((LinHost_IntEnable & LinHost_EvFlags & ~CSL_LIN_SCIFLR_TXEMPTY_MASK) != 0U)
+        {
+            LinHost_Now += LIN_HOST_ISR_CYCLES;
+            Lin_ProcessISR(0U);
+        }
+    }
+    LinHost_Now = t;
+}
+
+static void LinHost_Notify(uint8 Channel, uint8 EntryIndex, Lin_StatusType Status, const uint8 *SduPtr)
+{
+    boolean ok;
+
+    (void)Channel;
+    LinHost_NotifyCount[Status]++;
+    switch (EntryIndex)
+    {
+        case 0U:
+            ok = (boolean)((Status == LIN_TX_OK) && (LinHost_LastTd0 == 0x01020304U) &&
+                           (LinHost_LastTd1 == 0x05060708U));
+            break;
+        case 1U:
+            ok = (boolean)((Status == LIN_RX_OK) && (SduPtr != NULL_PTR) &&
+                           (memcmp(SduPtr, LinHost_SlaveData, 4U) == 0));
+            break;
+        case 2U:
+            ok = (boolean)(Status == LIN_RX_NO_RESPONSE);
+            break;
+        case 3U:
+            ok = (boolean)(Status == LIN_RX_ERROR);
+            break;
+        case 5U:
+            ok = (boolean)((Status == LIN_TX_OK) && (LinHost_LastTd0 == 0x01020300U));
+            break;
+        default:
+            ok = FALSE;
+            break;
+    }
+    if (ok == FALSE)
+    {
+        LinHost_Errors++;
+        printf("unexpected notification: entry %u status %d\n", EntryIndex, (int)Status);
+    }
+}
+
+static void LinHost_PrintHist(const char *name, const uint32 *hist)
+{
+    uint32 i;
+
+    printf("%s:", name);
+    for (i = 0U; i < LIN_STATS_HIST_BINS; i++)
+    {
+        if (hist[i] != 0U)
+        {
+            printf(" [%u]=%u", i, hist[i]);
+        }
+    }
+    printf("\n");
+}
+
+/**********************************************************************************************************************
+ *  hw_types.h, Mcal_Lib, SchM, Det and EcuM stubs
+ *********************************************************************************************************************/
+uint32 HW_RD_REG32_RAW(uint32 addr)
+{
+    LinHost_RegAccesses++;
+    return LIN_HOST_REG(addr - LinHost_Base);
+}
+
+void HW_WR_REG32_RAW(uint32 addr, uint32 value)
+{
+    uint32 off = addr - LinHost_Base;
+
+    LinHost_RegAccesses++;
+    switch (off)
+    {
+        case CSL_LIN_SCIFLR:
+            /* Write 1 to clear, TXEMPTY is owned by the model */
+            LIN_HOST_REG(off) &= ~(value & ~CSL_LIN_SCIFLR_TXEMPTY_MASK);
+            break;
+        case CSL_LIN_SCISETINT:
+            LinHost_IntEnable                 |= value;
+            LIN_HOST_REG(off)                  = LinHost_IntEnable;
+            LIN_HOST_REG(CSL_LIN_SCICLEARINT)  = LinHost_IntEnable;
+            break;
+        case CSL_LIN_SCICLEARINT:
+            LinHost_IntEnable               &= ~value;
+            LIN_HOST_REG(off)                = LinHost_IntEnable;
+            LIN_HOST_REG(CSL_LIN_SCISETINT)  = LinHost_IntEnable;
+            break;
+        case CSL_LIN_LINID:
+            LIN_HOST_REG(off) = value;
+            LinHost_IdWrite(value & 0xFFU);
+            break;
+        default:
+            LIN_HOST_REG(off) = value;
+            break;
+    }
+}
+
+uint8 HW_RD_REG8_RAW(uint32 addr)
+{
+    uint32 off = addr - LinHost_Base;
+
+    return (uint8)(LIN_HOST_REG(off & ~3U) >> (8U * (off & 3U)));
+}
+
+void HW_WR_REG8_RAW(uint32 addr, uint8 value)
+{
+    uint32 off   = (addr - LinHost_Base) & ~3U;
+    uint32 shift = 8U * ((addr - LinHost_Base) & 3U);
+
+    HW_WR_REG32_RAW(LinHost_Base + off, (LIN_HOST_REG(off) & ~(0xFFU << shift)) | ((uint32)value << shift));
+}
+
+void HW_WR_FIELD32_RAW(uint32 addr, uint32 mask, uint32 shift, uint32 value)
+{
+    HW_WR_REG32_RAW(addr, (HW_RD_REG32_RAW(addr) & ~mask) | ((value << shift) & mask));
+}
+
+uint32 HW_RD_FIELD32_RAW(uint32 addr, uint32 mask, uint32 shift)
+{
+    return (HW_RD_REG32_RAW(addr) & mask) >> shift;
+}
+
+void Mcal_GetCycleCounterValue(uint32 *value)
+{
+    *value = (uint32)LinHost_Now;
+}
+
+void Mcal_pmuDelay(uint32 cycles)
+{
+    LinHost_Now                  += cycles;
+    LIN_HOST_REG(CSL_LIN_SCIFLR) |= CSL_LIN_SCIFLR_TXEMPTY_MASK;
+}
+
+void SchM_Enter_Lin_LIN_EXCLUSIVE_AREA_0(void)
+{
+}
+
+void SchM_Exit_Lin_LIN_EXCLUSIVE_AREA_0(void)
+{
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    LinHost_DetCount++;
+    printf("DET sid 0x%x error 0x%x\n", ApiId, ErrorId);
+    return E_OK;
+}
+
+void EcuM_CheckWakeup(EcuM_WakeupSourceType wakeupSource)
+{
+    (void)wakeupSource;
+}
+
+void EcuM_SetWakeupEvent(EcuM_WakeupSourceType wakeupSource)
+{
+    (void)wakeupSource;
+}
+
+/**********************************************************************************************************************
+ *  MAIN
+ *********************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    static const Lin_ScheduleEntryType table[LIN_HOST_NUM_SLOTS] = {
+        {{0x10U, LIN_ENHANCED_CS, LIN_MASTER_RESPONSE, 8U, LinHost_MasterData}, 10U},
+        {{0x20U, LIN_ENHANCED_CS, LIN_SLAVE_RESPONSE, 4U, NULL_PTR}, 10U},
+        {{0x21U, LIN_CLASSIC_CS, LIN_SLAVE_RESPONSE, 2U, NULL_PTR}, 5U},
+        {{0x22U, LIN_ENHANCED_CS, LIN_SLAVE_RESPONSE, 8U, NULL_PTR}, 10U},
+        {{0x30U, LIN_ENHANCED_CS, LIN_SLAVE_TO_SLAVE, 1U, NULL_PTR}, 2U},
+        {{0x11U, LIN_CLASSIC_CS, LIN_MASTER_RESPONSE, 3U, LinHost_MasterData}, 10U},
+    };
+    Lin_PduType        slavePdu  = {0x20U, LIN_ENHANCED_CS, LIN_SLAVE_RESPONSE, 4U, NULL_PTR};
+    Lin_PduType        masterPdu = {0x10U, LIN_ENHANCED_CS, LIN_MASTER_RESPONSE, 8U, LinHost_MasterData};
+    Lin_StatisticsType stats;
+    uint32             jitter = (argc > 1) ? (uint32)atoi(argv[1]) : 2000U;
+    uint32             i, accesses;
+    uint64             t;
+    uint8             *sdu;
+
+    LinHost_Base                 = Lin_Config.linChannelCfg[0].linControllerConfig.CntrAddr;
+    LIN_HOST_REG(CSL_LIN_SCIFLR) = CSL_LIN_SCIFLR_TXEMPTY_MASK;
+    srand(1U);
+    Lin_Init(&Lin_Config);
+    if (Lin_WakeupInternal(0U) != E_OK)
+    {
+        printf("wakeup failed\n");
+        return 1;
+    }
+    if (Lin_ScheduleStart(0U, table, LIN_HOST_NUM_SLOTS, &LinHost_Notify) != E_OK)
+    {
+        printf("schedule start failed\n");
+        return 1;
+    }
+    /* Frame by frame transmission is rejected (with a DET) while a schedule runs */
+    if (Lin_SendFrame(0U, &slavePdu) != E_NOT_OK)
+    {
+        printf("Lin_SendFrame not rejected\n");
+        LinHost_Errors++;
+    }
+    LinHost_DetCount = 0U;
+
+    for (i = 0U, t = 0U; i < (LIN_HOST_TICKS_PER_CYCLE * LIN_HOST_NUM_CYCLES); i++)
+    {
+        t += LIN_HOST_TICK_CYCLES;
+        LinHost_RunUntil(t + (uint64)((uint32)rand() % (jitter + 1U)));
+        Lin_ScheduleTick(0U);
+    }
+    /* The last slot is still open and is dropped by the stop */
+    Lin_ScheduleStop(0U);
+    LinHost_RunUntil(LinHost_Now + (10U * LIN_HOST_TICK_CYCLES));
+
+    /* Frame by frame path after the schedule: one RX_OK */
+    if (Lin_SendFrame(0U, &slavePdu) != E_OK)
+    {
+        LinHost_Errors++;
+    }
+    LinHost_RunUntil(LinHost_Now + (20U * LIN_HOST_TICK_CYCLES));
+    if ((Lin_GetStatus(0U, &sdu) != LIN_RX_OK) || (memcmp(sdu, LinHost_SlaveData, 4U) != 0))
+    {
+        printf("frame path failed\n");
+        LinHost_Errors++;
+    }
+
+    /* Register accesses of a master frame: one TX_OK via Lin_SendFrame, one slot that is
+     * dropped by the stop */
+    accesses = LinHost_RegAccesses;
+    (void)Lin_SendFrame(0U, &masterPdu);
+    printf("register accesses Lin_SendFrame(master, 8 bytes): %u\n", LinHost_RegAccesses - accesses);
+    LinHost_RunUntil(LinHost_Now + (20U * LIN_HOST_TICK_CYCLES));
+    (void)Lin_GetStatus(0U, &sdu);
+    (void)Lin_ScheduleStart(0U, table, 1U, NULL_PTR);
+    accesses = LinHost_RegAccesses;
+    Lin_ScheduleTick(0U);
+    printf("register accesses schedule slot(master, 8 bytes): %u\n", LinHost_RegAccesses - accesses);
+    Lin_ScheduleStop(0U);
+    LinHost_RunUntil(LinHost_Now + (20U * LIN_HOST_TICK_CYCLES));
+
+    (void)Lin_GetStatistics(0U, &stats);
+    printf("headers %u notifications tx ok %u rx ok %u rx error %u no response %u\n", LinHost_Headers,
+           LinHost_NotifyCount[LIN_TX_OK], LinHost_NotifyCount[LIN_RX_OK], LinHost_NotifyCount[LIN_RX_ERROR],
+           LinHost_NotifyCount[LIN_RX_NO_RESPONSE]);
+    printf("stats tx ok %u tx header error %u tx error %u rx ok %u rx error %u no response %u\n", stats.txOkCount,
+           stats.txHeaderErrorCount, stats.txErrorCount, stats.rxOkCount, stats.rxErrorCount,
+           stats.rxNoResponseCount);
+    printf("latency n %u min %u max %u last %u mean %llu\n", stats.latencyCount, stats.minLatencyCycles,
+           stats.maxLatencyCycles, stats.lastLatencyCycles,
+           (stats.latencyCount != 0U) ? (unsigned long long)(stats.totalLatencyCycles / stats.latencyCount) : 0ULL);
+    printf("polled n %u max %u last %u mean %llu\n", stats.polledLatencyCount, stats.maxPolledLatencyCycles,
+           stats.lastPolledLatencyCycles,
+           (stats.polledLatencyCount != 0U)
+               ? (unsigned long long)(stats.totalPolledLatencyCycles / stats.polledLatencyCount)
+               : 0ULL);
+    printf("slots %u jitter last %u max %u (injected 0..%u)\n", stats.slotCount, stats.lastJitterCycles,
+           stats.maxJitterCycles, jitter);
+    LinHost_PrintHist("latency hist", stats.latencyHist);
+    LinHost_PrintHist("jitter hist", stats.jitterHist);
+
+    /* Schedule: two master slots per cycle less the one dropped by the stop, plus the
+     * Lin_SendFrame master frame. One slave response per cycle plus the frame path one. The
+     * one-slot schedule adds a slot. */
+    if ((stats.txOkCount != (2U * LIN_HOST_NUM_CYCLES)) || (stats.rxOkCount != (LIN_HOST_NUM_CYCLES + 1U)) ||
+        (stats.rxErrorCount != LIN_HOST_NUM_CYCLES) || (stats.rxNoResponseCount != LIN_HOST_NUM_CYCLES) ||
+        (stats.txOkCount != (LinHost_NotifyCount[LIN_TX_OK] + 1U)) ||
+        (stats.rxOkCount != (LinHost_NotifyCount[LIN_RX_OK] + 1U)) ||
+        (stats.slotCount != ((LIN_HOST_NUM_SLOTS * LIN_HOST_NUM_CYCLES) + 1U)) || (LinHost_DetCount != 0U))
+    {
+        printf("count mismatch\n");
+        LinHost_Errors++;
+    }
+    if ((jitter != 0U) && (stats.maxJitterCycles > jitter))
+    {
+        printf("jitter above the injected range\n");
+        LinHost_Errors++;
+    }
+    (void)Lin_ResetStatistics(0U);
+    (void)Lin_GetStatistics(0U, &stats);
+    if ((stats.txOkCount != 0U) || (stats.slotCount != 0U) || (stats.maxJitterCycles != 0U))
+    {
+        printf("reset failed\n");
+        LinHost_Errors++;
+    }
+    printf("%s\n", (LinHost_Errors == 0U) ? "PASS" : "FAIL");
+
+    return (LinHost_Errors == 0U) ? 0 : 1;
+}
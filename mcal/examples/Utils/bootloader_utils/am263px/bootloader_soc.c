@@ -100,6 +100,14 @@ uint32_t gBootloaderSelfCpuList[] = {
     BOOTLOADER_INVALID_ID,
 };
 
+/* list the non-self cores in the order they are released, second core of a cluster goes first */
+uint32_t gBootloaderEarlyReleaseCpuList[] = {
+    MCAL_CSL_CORE_ID_R5FSS1_1,
+    MCAL_CSL_CORE_ID_R5FSS1_0,
+    MCAL_CSL_CORE_ID_R5FSS0_1,
+    BOOTLOADER_INVALID_ID,
+};
+
 Bootloader_CoreAddrTranslateInfo gAddrTranslateInfo[] = {
     /* MCAL_CSL_CORE_ID_R5FSS0_0 */
     {
@@ -430,6 +438,11 @@ uint32_t *Bootloader_socGetSelfCpuList(void)
     return &gBootloaderSelfCpuList[0];
 }
 
+uint32_t *Bootloader_socGetEarlyReleaseCpuList(void)
+{
+    return &gBootloaderEarlyReleaseCpuList[0];
+}
+
 uint32_t Bootloader_socTranslateSectionAddr(uint32_t cslCoreId, uint32_t addr)
 {
     uint32_t outputAddr = addr;
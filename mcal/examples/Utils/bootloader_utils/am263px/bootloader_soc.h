@@ -255,6 +255,13 @@ uint32_t Bootloader_socRprcToCslCoreId(uint32_t rprcCoreId);
  */
 uint32_t* Bootloader_socGetSelfCpuList(void);
 
+/**
+ * \brief Get the list of cpus that can be released as soon as their image is loaded, in release order.
+ *
+ * \return List of cpus ending with an invalid core id
+ */
+uint32_t* Bootloader_socGetEarlyReleaseCpuList(void);
+
 /**
  * \brief Get the name of a core
  *
@@ -66,6 +66,7 @@
 #include "bootloader.h"
 #include "bootloader_soc.h"
 #include "bootloader_priv.h"
+#include "sys_pmu.h"
 #include <string.h>
 
 /* ========================================================================== */
@@ -132,6 +133,9 @@ uint8_t vec_addrs[GET_CACHE_ALIGNED_SIZE(BOOTLOADER_MAX_SBL_SIZE_IN_TCM_KB)]
     __attribute__((aligned((uint32_t)CacheP_CACHELINE_ALIGNMENT)));
 volatile uint32_t vec_size = 0U;
 
+/** Boot time breakdown of the last pipelined load. */
+static Bootloader_BootTimeInfo gBootloaderBootTimeInfo;
+
 /** Buffer to store the Application X509 cert if present. */
 uint8_t gX509Cert[MAX_APP_CERT_LENGTH];
 
@@ -445,6 +449,23 @@ uint32_t Bootloader_getMulticoreImageSize(Bootloader_Handle handle)
     return size;
 }
 
+/* This API should only be called after the bootimage is loaded */
+uint32_t Bootloader_isCoreReleased(Bootloader_Handle handle, uint32_t cslCoreId)
+{
+    uint32_t retVal = FALSE;
+
+    if (handle != NULL_PTR)
+    {
+        Bootloader_Config *config = (Bootloader_Config *)handle;
+        if ((config->coresReleasedMap & (1U << (uint32_t)cslCoreId)) != 0U)
+        {
+            retVal = TRUE;
+        }
+    }
+
+    return retVal;
+}
+
 /* This API should only be called after the bootimage is parsed */
 uint32_t Bootloader_isCorePresent(Bootloader_Handle handle, uint32_t cslCoreId)
 {
@@ -582,6 +603,38 @@ static int32_t Bootloader_verifySegmentAddr(uint32_t addr)
     return status;
 }
 
+static int32_t Bootloader_copyVectorTable(void)
+{
+    int32_t status = SystemP_SUCCESS;
+
+    /* Bounds check to ensure vec_size does not exceed buffer capacity */
+    if (vec_size <= BOOTLOADER_MAX_SBL_SIZE_IN_TCM_KB)
+    {
+        /*
+            Invalidate the local cache so as to read the value of the vectors from the Shared memory.
+            This is required in the case of decryption where the HSM core has decrypted the contents
+            but the modified contents do not show up in the cache.
+        */
+        Mcal_CacheP_inv(vec_addrs, vec_size, Mcal_CacheP_TYPE_ALLD);
+
+        /* MISRA-C:2012 AMD1 Rule 21.16 - Cast away volatile for memcpy */
+        uint8_t *pDest = (uint8_t *)(uintptr_t)vector_table_loc;
+        (void)memcpy((void *)pDest, (const void *)vec_addrs, vec_size);
+
+        /*
+            Write the contents of the vector address in shared memory so that these are used by the CPU after reset.
+        */
+        Mcal_CacheP_wbInv((void *)vector_table_loc, vec_size, Mcal_CacheP_TYPE_ALLD);
+    }
+    else
+    {
+        /* vec_size exceeds buffer capacity - this should not happen if code flow is correct */
+        status = SystemP_FAILURE;
+    }
+
+    return status;
+}
+
 int32_t Bootloader_parseAndLoadMultiCoreELF(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo)
 {
     int32_t  status          = SystemP_SUCCESS;
@@ -1031,36 +1084,431 @@ int32_t Bootloader_parseAndLoadMultiCoreELF(Bootloader_Handle handle, Bootloader
     {
         /* Since authentication is complete now replace the vector table with the one from the application image if
          * required. */
+        status = Bootloader_copyVectorTable();
+    }
+
+    return status;
+}
+
+static uint32_t Bootloader_getCycleCount(void)
+{
+    uint32 cycles = 0U;
+
+    Mcal_GetCycleCounterValue(&cycles);
+
+    return (uint32_t)cycles;
+}
+
+/* Read the ELF header and the program header table, the PHT is only read for ELF32 images */
+static int32_t Bootloader_pipelineReadHeaders(Bootloader_Config *config, uint32_t *elfClass, uint32_t *numSegments)
+{
+    int32_t            status   = SystemP_SUCCESS;
+    uint32_t           rdSz     = ELFCLASS_IDX + 1U;
+    uint32_t           phtSize  = 0U;
+    Bootloader_ELFH32 *elfPtr32 = (Bootloader_ELFH32 *)gElfHBuffer;
+    uint8_t            ELFSTR[] = {0x7FU, (uint8_t)'E', (uint8_t)'L', (uint8_t)'F'};
+
+    config->fxns->imgSeekFxn(0U, config->args);
+    status = config->fxns->imgReadFxn(gElfHBuffer, rdSz, config->args);
+
+    /* MISRA-C:2012 AMD1 Rule 21.16 - Compare byte arrays without memcmp */
+    if ((gElfHBuffer[0] != ELFSTR[0]) || (gElfHBuffer[1] != ELFSTR[1]) || (gElfHBuffer[2] != ELFSTR[2]) ||
+        (gElfHBuffer[3] != ELFSTR[3]))
+    {
+        status = SystemP_FAILURE;
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        *elfClass = gElfHBuffer[ELFCLASS_IDX];
+    }
+
+    if ((status == SystemP_SUCCESS) && (*elfClass == ELFCLASS_32))
+    {
+        config->fxns->imgSeekFxn(rdSz, config->args);
+        status = config->fxns->imgReadFxn((gElfHBuffer + rdSz), (ELF_HEADER_32_SIZE - rdSz), config->args);
+    }
+
+    if ((status == SystemP_SUCCESS) && (*elfClass == ELFCLASS_32))
+    {
+        phtSize      = ((uint32_t)elfPtr32->e_phnum * (uint32_t)elfPtr32->e_phentsize);
+        *numSegments = elfPtr32->e_phnum;
 
-        /* Bounds check to ensure vec_size does not exceed buffer capacity */
-        if (vec_size <= BOOTLOADER_MAX_SBL_SIZE_IN_TCM_KB)
+        /* The note segment is always present at index 0 */
+        if ((*numSegments == 0U) || (*numSegments > ELF_MAX_SEGMENTS))
         {
-            /*
-                Invalidate the local cache so as to read the value of the vectors from the Shared memory.
-                This is required in the case of decryption where the HSM core has decrypted the contents
-                but the modified contents do not show up in the cache.
-            */
-            Mcal_CacheP_inv(vec_addrs, vec_size, Mcal_CacheP_TYPE_ALLD);
-
-            /* MISRA-C:2012 AMD1 Rule 21.16 - Cast away volatile for memcpy */
-            uint8_t *pDest = (uint8_t *)(uintptr_t)vector_table_loc;
-            (void)memcpy((void *)pDest, (const void *)vec_addrs, vec_size);
-
-            /*
-                Write the contents of the vector address in shared memory so that these are used by the CPU after reset.
-            */
-            Mcal_CacheP_wbInv((void *)vector_table_loc, vec_size, Mcal_CacheP_TYPE_ALLD);
+            status = SystemP_FAILURE;
         }
         else
         {
-            /* vec_size exceeds buffer capacity - this should not happen if code flow is correct */
+            config->fxns->imgSeekFxn(elfPtr32->e_phoff, config->args);
+            status = config->fxns->imgReadFxn((void *)(gPHTBuffer), phtSize, config->args);
+        }
+    }
+
+    return status;
+}
+
+/* Find the next loadable segment starting at PHT index idx, returns numSegments if there is none */
+static uint32_t Bootloader_pipelineNextSegment(uint32_t idx, uint32_t numSegments, uint32_t segmentMapIdx,
+                                               Bootloader_SegmentInfo *seg)
+{
+    Bootloader_ELFPH32 *elfPhdrPtr32 = (Bootloader_ELFPH32 *)gPHTBuffer;
+    uint32_t            i;
+
+    for (i = idx; i < numSegments; i++)
+    {
+        if ((elfPhdrPtr32[i].type == PT_LOAD) && (elfPhdrPtr32[i].filesz != 0U))
+        {
+            seg->offset = elfPhdrPtr32[i].offset;
+            seg->vaddr  = elfPhdrPtr32[i].vaddr;
+            seg->size   = elfPhdrPtr32[i].filesz;
+            seg->cpuId  = gNoteSegBuffer[segmentMapIdx + (i - 1U)];
+            seg->addr   = 0U;
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* Initialize the core owning the segment and translate and validate its load address */
+static int32_t Bootloader_pipelinePrepareSegment(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo,
+                                                 Bootloader_SegmentInfo *seg, uint8_t *initCpuDone)
+{
+    int32_t  status = SystemP_SUCCESS;
+    uint32_t startCycles;
+
+    if (initCpuDone[seg->cpuId] == 0U)
+    {
+        startCycles                              = Bootloader_getCycleCount();
+        status                                   = Bootloader_initCpu(handle, &bootImageInfo->cpuInfo[seg->cpuId]);
+        initCpuDone[seg->cpuId]                  = 1U;
+        gBootloaderBootTimeInfo.cpuInitCycles += (Bootloader_getCycleCount() - startCycles);
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        seg->addr = Bootloader_socTranslateSectionAddr(seg->cpuId, seg->vaddr);
+
+        /* The vector table at address 0 is staged in vec_addrs, every other segment is checked against SBL memory */
+        if (seg->addr != 0U)
+        {
+            status = Bootloader_verifySegmentAddr(seg->addr);
+        }
+    }
+
+    return status;
+}
+
+/* Copy with the CPU, straight from the media window when it is memory mapped */
+static int32_t Bootloader_pipelineCpuCopy(Bootloader_Config *config, void *dst, uint32_t offset, uint32_t length)
+{
+    int32_t     status = SystemP_SUCCESS;
+    const void *src    = NULL_PTR;
+
+    if (config->fxns->imgMapFxn != NULL_PTR)
+    {
+        src = config->fxns->imgMapFxn(offset, config->args);
+    }
+
+    if (src != NULL_PTR)
+    {
+        (void)memcpy(dst, src, length);
+        Mcal_CacheP_wb(dst, length, Mcal_CacheP_TYPE_ALL);
+    }
+    else
+    {
+        config->fxns->imgSeekFxn(offset, config->args);
+        status = config->fxns->imgReadFxn(dst, length, config->args);
+    }
+    gBootloaderBootTimeInfo.cpuBytes += length;
+
+    return status;
+}
+
+/*
+    Start the copy of one segment. The block aligned head goes to the copy engine and the tail is copied by the CPU
+    while the engine runs. engineBusy is set when the caller has to wait for the engine.
+*/
+static int32_t Bootloader_pipelineCopySegment(Bootloader_Config *config, const Bootloader_SegmentInfo *seg,
+                                              const Bootloader_CopyEngine *copyEngine, uint32_t *engineBusy)
+{
+    int32_t     status    = SystemP_SUCCESS;
+    uint8_t    *dst       = (uint8_t *)(uintptr_t)seg->addr;
+    const void *src       = NULL_PTR;
+    uint32_t    engineLen = 0U;
+    uint32_t    cpuOffset = 0U;
+    uint32_t    splitPad;
+
+    *engineBusy = FALSE;
+
+    if (seg->addr == 0U)
+    {
+        /* Same staging as Bootloader_parseAndLoadMultiCoreELF, the part overlapping the SBL goes to vec_addrs */
+        vec_size = seg->size;
+        if (vec_size > BOOTLOADER_MAX_SBL_SIZE_IN_TCM_KB)
+        {
+            vec_size = BOOTLOADER_MAX_SBL_SIZE_IN_TCM_KB;
+        }
+        status = Bootloader_pipelineCpuCopy(config, (void *)&vec_addrs[0U], seg->offset, vec_size);
+        if ((status == SystemP_SUCCESS) && (seg->size > vec_size))
+        {
+            status = Bootloader_pipelineCpuCopy(config, (void *)(uintptr_t)vec_size, seg->offset + vec_size,
+                                                seg->size - vec_size);
+        }
+    }
+    else
+    {
+        if ((copyEngine != NULL_PTR) && (config->fxns->imgMapFxn != NULL_PTR) && (copyEngine->blockSize != 0U) &&
+            (seg->size >= copyEngine->minLength))
+        {
+            src = config->fxns->imgMapFxn(seg->offset, config->args);
+        }
+
+        if (src != NULL_PTR)
+        {
+            engineLen = seg->size - (seg->size % copyEngine->blockSize);
+        }
+
+        if (engineLen != 0U)
+        {
+            /* Drop any line the engine is about to overwrite so that it is not evicted on top of the new data */
+            Mcal_CacheP_wbInv(dst, engineLen, Mcal_CacheP_TYPE_ALLD);
+            status = copyEngine->startFxn(dst, src, engineLen, copyEngine->args);
+            if (status == SystemP_SUCCESS)
+            {
+                *engineBusy                          = TRUE;
+                gBootloaderBootTimeInfo.engineBytes += engineLen;
+            }
+
+            /* The CPU starts at the cache line holding the split point. A line it writes back is then fully
+             * written by the CPU, the engine bytes in it are copied twice with the same data instead of being
+             * overwritten by stale cache contents. */
+            splitPad  = (uint32_t)(((uintptr_t)dst + engineLen) & ((uint32_t)CacheP_CACHELINE_ALIGNMENT - 1U));
+            cpuOffset = (splitPad < engineLen) ? (engineLen - splitPad) : 0U;
+        }
+
+        if ((status == SystemP_SUCCESS) && (engineLen < seg->size))
+        {
+            status = Bootloader_pipelineCpuCopy(config, &dst[cpuOffset], seg->offset + cpuOffset,
+                                                seg->size - cpuOffset);
+        }
+    }
+
+    config->bootImageSize += seg->size;
+
+    return status;
+}
+
+/* Release, in list order, the cores whose segments are all loaded */
+static int32_t Bootloader_pipelineReleaseCpus(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo,
+                                              uint32_t loadedMap, uint32_t loadStartCycles)
+{
+    int32_t            status      = SystemP_SUCCESS;
+    Bootloader_Config *config      = (Bootloader_Config *)handle;
+    uint32_t          *releaseList = Bootloader_socGetEarlyReleaseCpuList();
+    uint32_t           startCycles;
+    uint32_t           cpuMask;
+    uint32_t           i;
+
+    for (i = 0U; releaseList[i] != BOOTLOADER_INVALID_ID; i++)
+    {
+        cpuMask = (1U << releaseList[i]);
+        if (((config->coresPresentMap & cpuMask) != 0U) && ((config->coresReleasedMap & cpuMask) == 0U))
+        {
+            if ((loadedMap & cpuMask) == 0U)
+            {
+                /* Keep the release order, a later core waits for this one */
+                break;
+            }
+
+            startCycles = Bootloader_getCycleCount();
+            status      = Bootloader_runCpu(handle, &bootImageInfo->cpuInfo[releaseList[i]]);
+            if (status != SystemP_SUCCESS)
+            {
+                break;
+            }
+            config->coresReleasedMap                 |= cpuMask;
+            gBootloaderBootTimeInfo.cpuReleaseCycles += (Bootloader_getCycleCount() - startCycles);
+            if (gBootloaderBootTimeInfo.firstReleaseCycles == 0U)
+            {
+                gBootloaderBootTimeInfo.firstReleaseCycles = Bootloader_getCycleCount() - loadStartCycles;
+            }
+        }
+    }
+
+    return status;
+}
+
+int32_t Bootloader_parseAndLoadMultiCoreELFPipelined(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo,
+                                                     const Bootloader_CopyEngine *copyEngine)
+{
+    int32_t                status        = SystemP_SUCCESS;
+    Bootloader_Config     *config        = (Bootloader_Config *)handle;
+    uint32_t               elfClass      = ELFCLASS_32;
+    uint32_t               numSegments   = 0U;
+    uint32_t               segmentMapIdx = 0U;
+    uint32_t               noteSegmentSz = 0U;
+    uint32_t               loadedMap     = 0U;
+    uint32_t               engineBusy    = FALSE;
+    uint32_t               vecPresent    = FALSE;
+    uint32_t               pipelined     = FALSE;
+    uint32_t               startCycles   = Bootloader_getCycleCount();
+    uint32_t               phaseCycles   = startCycles;
+    uint32_t               waitCycles;
+    uint32_t               idx;
+    uint32_t               nextIdx;
+    Bootloader_SegmentInfo curSeg        = {0U};
+    Bootloader_SegmentInfo nextSeg       = {0U};
+    Bootloader_ELFPH32    *elfPhdrPtr32 = (Bootloader_ELFPH32 *)gPHTBuffer;
+
+    uint8_t  initCpuDone[MCAL_CSL_CORE_ID_MAX] = {0};
+    uint16_t segmentsLeft[MCAL_CSL_CORE_ID_MAX] = {0};
+
+    (void)memset(&gBootloaderBootTimeInfo, 0, sizeof(gBootloaderBootTimeInfo));
+
+    if ((config->fxns->imgReadFxn == NULL) || (config->fxns->imgSeekFxn == NULL_PTR))
+    {
+        status = SystemP_FAILURE;
+    }
+    else if ((Bootloader_socIsAuthRequired() == TRUE) && (config->isAppimageSigned == TRUE))
+    {
+        /* Streaming authentication needs the segments in image order through the read callback */
+        status = Bootloader_parseAndLoadMultiCoreELF(handle, bootImageInfo);
+    }
+    else
+    {
+        config->coresReleasedMap = 0U;
+        status                   = Bootloader_pipelineReadHeaders(config, &elfClass, &numSegments);
+        if ((status == SystemP_SUCCESS) && (elfClass == ELFCLASS_32))
+        {
+            pipelined = TRUE;
+        }
+        else if (status == SystemP_SUCCESS)
+        {
+            status = Bootloader_parseAndLoadMultiCoreELF(handle, bootImageInfo);
+        }
+        else
+        {
+            /* Not a valid MCELF image */
+        }
+        gBootloaderBootTimeInfo.headerParseCycles = Bootloader_getCycleCount() - phaseCycles;
+    }
+
+    if ((status == SystemP_SUCCESS) && (pipelined == TRUE))
+    {
+        /* Note segment is always the first segment at index 0. */
+        phaseCycles   = Bootloader_getCycleCount();
+        noteSegmentSz = elfPhdrPtr32[0].filesz;
+        if (noteSegmentSz > ELF_NOTE_SEGMENT_MAX_SIZE)
+        {
             status = SystemP_FAILURE;
         }
+        else
+        {
+            config->fxns->imgSeekFxn(elfPhdrPtr32[0].offset, config->args);
+            status = config->fxns->imgReadFxn((void *)(gNoteSegBuffer), noteSegmentSz, config->args);
+        }
+
+        if (status == SystemP_SUCCESS)
+        {
+            status = Bootloader_parseNoteSegment(handle, noteSegmentSz, &segmentMapIdx);
+        }
+
+        /* Count the segments of each core once, so that a core can be released right after its last segment */
+        idx = Bootloader_pipelineNextSegment(1U, numSegments, segmentMapIdx, &curSeg);
+        while ((status == SystemP_SUCCESS) && (idx < numSegments))
+        {
+            if (curSeg.cpuId >= MCAL_CSL_CORE_ID_MAX)
+            {
+                status = SystemP_FAILURE;
+            }
+            else
+            {
+                segmentsLeft[curSeg.cpuId]++;
+                config->coresPresentMap |= (1U << curSeg.cpuId);
+                gBootloaderBootTimeInfo.numSegments++;
+                idx = Bootloader_pipelineNextSegment(idx + 1U, numSegments, segmentMapIdx, &curSeg);
+            }
+        }
+        gBootloaderBootTimeInfo.noteParseCycles = Bootloader_getCycleCount() - phaseCycles;
+
+        phaseCycles = Bootloader_getCycleCount();
+        idx         = numSegments;
+        if (status == SystemP_SUCCESS)
+        {
+            idx = Bootloader_pipelineNextSegment(1U, numSegments, segmentMapIdx, &curSeg);
+        }
+        if (idx < numSegments)
+        {
+            status = Bootloader_pipelinePrepareSegment(handle, bootImageInfo, &curSeg, initCpuDone);
+        }
+
+        while ((status == SystemP_SUCCESS) && (idx < numSegments))
+        {
+            status = Bootloader_pipelineCopySegment(config, &curSeg, copyEngine, &engineBusy);
+            if (curSeg.addr == 0U)
+            {
+                vecPresent = TRUE;
+            }
+
+            /* Prepare the next segment while the engine is copying this one */
+            nextIdx = Bootloader_pipelineNextSegment(idx + 1U, numSegments, segmentMapIdx, &nextSeg);
+            if ((status == SystemP_SUCCESS) && (nextIdx < numSegments))
+            {
+                status = Bootloader_pipelinePrepareSegment(handle, bootImageInfo, &nextSeg, initCpuDone);
+            }
+
+            if (engineBusy == TRUE)
+            {
+                waitCycles = Bootloader_getCycleCount();
+                while (copyEngine->isDoneFxn(copyEngine->args) == FALSE)
+                {
+                    /* Wait for the engine */
+                }
+                gBootloaderBootTimeInfo.copyWaitCycles += (Bootloader_getCycleCount() - waitCycles);
+            }
+
+            if (status == SystemP_SUCCESS)
+            {
+                segmentsLeft[curSeg.cpuId]--;
+                if (segmentsLeft[curSeg.cpuId] == 0U)
+                {
+                    loadedMap |= (1U << curSeg.cpuId);
+                    status     = Bootloader_pipelineReleaseCpus(handle, bootImageInfo, loadedMap, startCycles);
+                }
+            }
+
+            idx    = nextIdx;
+            curSeg = nextSeg;
+        }
+        gBootloaderBootTimeInfo.segmentLoadCycles = Bootloader_getCycleCount() - phaseCycles;
+
+        if ((copyEngine != NULL_PTR) && (copyEngine->closeFxn != NULL_PTR))
+        {
+            copyEngine->closeFxn(copyEngine->args);
+        }
+    }
+
+    if ((status == SystemP_SUCCESS) && (vecPresent == TRUE))
+    {
+        status = Bootloader_copyVectorTable();
     }
 
+    gBootloaderBootTimeInfo.totalCycles = Bootloader_getCycleCount() - startCycles;
+
     return status;
 }
 
+void Bootloader_getBootTimeInfo(Bootloader_BootTimeInfo *bootTimeInfo)
+{
+    if (bootTimeInfo != NULL_PTR)
+    {
+        *bootTimeInfo = gBootloaderBootTimeInfo;
+    }
+}
+
 void Bootloader_Params_init(Bootloader_Params *params)
 {
     params->memArgsAppImageBaseAddr = BOOTLOADER_INVALID_ID;
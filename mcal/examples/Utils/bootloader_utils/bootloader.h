@@ -221,8 +221,103 @@ typedef void (*Bootloader_imgCloseFxn)(void *handle, void *args);
  */
 typedef int32_t (*Bootloader_imgCustomFxn)(void *args);
 
+/**
+ * \brief Driver implementation to get the CPU address of a location in the boot media
+ *
+ * Only boot media which are memory mapped, like OSPI flash in DAC mode, implement this callback. It lets the
+ * pipelined loader copy segments straight from the media window to their load address.
+ *
+ * \param location  [in] Offset of the data within the boot image
+ * \param args      [in] Boot media specific arguments, obtained from the config
+ *
+ * \return CPU address of the data, NULL if the location is not memory mapped
+ */
+typedef const void *(*Bootloader_imgMapFxn)(uint32_t location, void *args);
+
+/** @} */
+
+/**
+ * \anchor Bootloader_CopyEngineFxns
+ * \name Bootloader copy engine callbacks
+ *
+ * Used by \ref Bootloader_parseAndLoadMultiCoreELFPipelined to offload segment copies, typically to an EDMA channel.
+ *
+ * @{
+ */
+
+/**
+ * \brief Start an asynchronous copy of \p length bytes from \p srcAddr to \p dstAddr
+ *
+ * \param dstAddr [in] Destination address
+ * \param srcAddr [in] Source address
+ * \param length  [in] Length in bytes, always a multiple of the engine block size
+ * \param args    [in] Copy engine specific arguments
+ *
+ * \return SystemP_SUCCESS on success, else failure
+ */
+typedef int32_t (*Bootloader_copyStartFxn)(void *dstAddr, const void *srcAddr, uint32_t length, void *args);
+
+/**
+ * \brief Poll for completion of the copy started with \ref Bootloader_copyStartFxn
+ *
+ * \param args    [in] Copy engine specific arguments
+ *
+ * \return TRUE once the copy is complete, else FALSE
+ */
+typedef uint32_t (*Bootloader_copyIsDoneFxn)(void *args);
+
+/**
+ * \brief Release the copy engine once the load is complete
+ *
+ * \param args    [in] Copy engine specific arguments
+ */
+typedef void (*Bootloader_copyCloseFxn)(void *args);
+
 /** @} */
 
+/**
+ * \brief Copy engine description passed to \ref Bootloader_parseAndLoadMultiCoreELFPipelined
+ */
+typedef struct Bootloader_CopyEngine_s
+{
+    Bootloader_copyStartFxn  startFxn;
+    Bootloader_copyIsDoneFxn isDoneFxn;
+    Bootloader_copyCloseFxn  closeFxn;
+    void                    *args;
+    /* The engine copies whole multiples of this size, the CPU copies the tail of a segment */
+    uint32_t                 blockSize;
+    /* Segments smaller than this are copied by the CPU */
+    uint32_t                 minLength;
+
+} Bootloader_CopyEngine;
+
+/**
+ * \brief Boot time breakdown recorded by \ref Bootloader_parseAndLoadMultiCoreELFPipelined, in CPU cycles
+ */
+typedef struct Bootloader_BootTimeInfo_s
+{
+    /* ELF header and program header table read */
+    uint32_t headerParseCycles;
+    /* Note segment read and parse */
+    uint32_t noteParseCycles;
+    /* First segment copy start to last segment copy done */
+    uint32_t segmentLoadCycles;
+    /* Time spent waiting on the copy engine after the next segment was prepared */
+    uint32_t copyWaitCycles;
+    /* Time spent in Bootloader_initCpu */
+    uint32_t cpuInitCycles;
+    /* Time spent in Bootloader_runCpu for early released CPUs */
+    uint32_t cpuReleaseCycles;
+    /* Start of the load to the first CPU release, 0 if no CPU was released */
+    uint32_t firstReleaseCycles;
+    /* Start to end of the load */
+    uint32_t totalCycles;
+    uint32_t numSegments;
+    uint32_t engineBytes;
+    uint32_t cpuBytes;
+
+} Bootloader_BootTimeInfo;
+
 /**
  * \brief Driver implementation callbacks
  */
@@ -247,6 +342,8 @@ typedef struct Bootloader_Config_s
     /* Whether to initialize ICSS cores or not */
     uint32_t         initICSSCores;
     uint32_t         enableScratchMem;
+    /* CPUs already released by Bootloader_parseAndLoadMultiCoreELFPipelined */
+    uint32_t         coresReleasedMap;
 
 } Bootloader_Config;
 
@@ -533,6 +630,42 @@ uint32_t Bootloader_getBootMedia(Bootloader_Handle handle);
  */
 int32_t Bootloader_parseAndLoadMultiCoreELF(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo);
 
+/**
+ * \brief API to parse and load MCELF image with overlapped segment copies
+ *
+ * The program header table and the note segment are parsed once up front. Each loadable segment is then copied
+ * straight from the memory mapped boot media to its load address, by \p copyEngine when one is given. While a copy
+ * is in flight the CPU translates and validates the next segment and initializes its core. The cores returned by
+ * Bootloader_socGetEarlyReleaseCpuList are released as soon as all of their segments are loaded.
+ *
+ * Falls back to \ref Bootloader_parseAndLoadMultiCoreELF for signed images and ELF64 images.
+ *
+ * \param handle        [in] Bootloader driver handle from \ref Bootloader_open
+ * \param bootImageInfo [in] Data structure of type Bootloader_BootImageInfo which will be filled
+ * \param copyEngine    [in] Copy engine to offload segment copies, NULL to copy with the CPU
+ *
+ * \return SystemP_SUCCESS on success, else failure
+ */
+int32_t Bootloader_parseAndLoadMultiCoreELFPipelined(Bootloader_Handle handle, Bootloader_BootImageInfo *bootImageInfo,
+                                                     const Bootloader_CopyEngine *copyEngine);
+
+/**
+ * \brief API to check if a core was released by \ref Bootloader_parseAndLoadMultiCoreELFPipelined
+ *
+ * \param handle    Bootloader driver handle from \ref Bootloader_open
+ * \param cslCoreId CSL core ID of the interested core
+ *
+ * \return TRUE if the core is already running
+ */
+uint32_t Bootloader_isCoreReleased(Bootloader_Handle handle, uint32_t cslCoreId);
+
+/**
+ * \brief API to get the boot time breakdown of the last \ref Bootloader_parseAndLoadMultiCoreELFPipelined call
+ *
+ * \param bootTimeInfo [out] Pointer to a \ref Bootloader_BootTimeInfo structure
+ */
+void Bootloader_getBootTimeInfo(Bootloader_BootTimeInfo *bootTimeInfo);
+
 /**
  * \brief API to get the length of an x509 certificate
  *
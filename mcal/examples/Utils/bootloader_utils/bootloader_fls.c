@@ -64,6 +64,7 @@ static uint32_t Flash_imgGetCurOffset(void *args);
 static void     Flash_imgSeek(uint32_t location, void *args);
 static void     Flash_imgClose(void *handle, void *args);
 static int32_t  Flash_imgDacModeToggle(void *args);
+static const void *Flash_imgMap(uint32_t location, void *args);
 
 extern Fls_ConfigSfdp *fls_config_sfdp;
 
@@ -74,6 +75,7 @@ Bootloader_Fxns gBootloaderFlashFxns = {
     .imgSeekFxn   = Flash_imgSeek,
     .imgCloseFxn  = Flash_imgClose,
     .imgCustomFxn = Flash_imgDacModeToggle,
+    .imgMapFxn    = Flash_imgMap,
 };
 
 volatile uint32 Fls_JobDoneSuccess;
@@ -231,3 +233,20 @@ static int32_t Flash_imgDacModeToggle(void *args)
 
     return status;
 }
+
+static const void *Flash_imgMap(uint32_t location, void *args)
+{
+    const void *addr = NULL_PTR;
+
+#if (STD_ON == FLS_OSPI_DAC_ENABLE)
+    Bootloader_FlashArgs *flashArgs = (Bootloader_FlashArgs *)args;
+
+    /* The whole flash is visible through the FSS data window when direct access mode is enabled */
+    if ((flashArgs->appImageOffset + location) < Fls_Config_SFDP_Ptr->flashSize)
+    {
+        addr = (const void *)(uintptr_t)(FLS_BASE_ADDRESS + flashArgs->appImageOffset + location);
+    }
+#endif
+
+    return addr;
+}
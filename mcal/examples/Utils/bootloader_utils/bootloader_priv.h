@@ -153,8 +153,22 @@ struct Bootloader_Fxns_s
     Bootloader_imgSeekFxn   imgSeekFxn;
     Bootloader_imgCloseFxn  imgCloseFxn;
     Bootloader_imgCustomFxn imgCustomFxn;
+    Bootloader_imgMapFxn    imgMapFxn;
 };
 
+/**
+ * \brief Loadable segment descriptor used by the pipelined ELF loader
+ */
+typedef struct
+{
+    uint32_t offset;
+    uint32_t vaddr;
+    uint32_t size;
+    uint32_t cpuId;
+    /* Load address after translation, filled in when the segment is prepared */
+    uint32_t addr;
+} Bootloader_SegmentInfo;
+
 typedef struct
 {
     uint32_t              numSections;
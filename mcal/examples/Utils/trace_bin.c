@@ -0,0 +1,253 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2026 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file       trace_bin.c
+ *
+ *  \brief      Binary trace implementation.
+ *
+ *              The ring is written lock free by any number of tasks and ISRs
+ *              of one core: a record slot is reserved with a compare and swap
+ *              on the write index, filled and then committed by writing its
+ *              sequence number. TraceBin_MainFunction is the only reader and
+ *              sends the committed records in place, no formatting or copy
+ *              is done on the target. Every core links its own ring.
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+/*LDRA_NOANALYSIS*/
+#include "Std_Types.h"
+/*LDRA_ANALYSIS*/
+#include "trace_bin.h"
+#include "sys_pmu.h"
+#include "CacheP.h"
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Index mask of the ring */
+#define TRACEBIN_RING_MASK (TRACEBIN_NUM_RECORDS - 1U)
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+typedef struct
+{
+    TraceBin_TxFxn  txFxn;
+    /**< Transmit function draining the ring */
+    uint32          coreInfo;
+    /**< Magic and core ID part of the record info word */
+    volatile uint32 writeIdx;
+    /**< Next record to reserve, free running */
+    volatile uint32 readIdx;
+    /**< Oldest record not yet sent, free running */
+    volatile uint32 txCount;
+    /**< Records of the transfer in progress, 0 when idle */
+    volatile uint32 dropCnt;
+    /**< Records dropped because the ring was full */
+} TraceBin_Object;
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+/* None */
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+/** \brief Record ring, cache line aligned so it can be written back per record */
+static TraceBin_Record TraceBin_ring[TRACEBIN_NUM_RECORDS] __attribute__((aligned(32)));
+
+/** \brief Binary trace state */
+static TraceBin_Object TraceBin_obj;
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+/**
+ *  \brief      Function to initialize the binary trace ring.
+ *  \param      cfgPtr  Transmit function and core ID.
+ */
+void TraceBin_Init(const TraceBin_ConfigType *cfgPtr)
+{
+    uint32 idx;
+
+    for (idx = 0U; idx < TRACEBIN_NUM_RECORDS; idx++)
+    {
+        /* Sequence 0 is never committed */
+        TraceBin_ring[idx].seq = 0U;
+    }
+
+    TraceBin_obj.txFxn    = cfgPtr->txFxn;
+    TraceBin_obj.coreInfo = (TRACEBIN_RECORD_MAGIC << 16U) | ((uint32)cfgPtr->coreId << 8U);
+    TraceBin_obj.writeIdx = 0U;
+    TraceBin_obj.readIdx  = 0U;
+    TraceBin_obj.txCount  = 0U;
+    TraceBin_obj.dropCnt  = 0U;
+}
+
+/**
+ *  \brief      Function to store one trace record. Takes a few tens of cycles
+ *              and never blocks, the record is dropped when the ring is full.
+ *  \param      fmt      Format string placed in .trace_fmt by TB_xtrace.
+ *  \param      numArgs  Number of valid arguments.
+ *  \param      param0   The first parameter which needs to be logged.
+ *  \param      param1   The second parameter which needs to be logged.
+ *  \param      param2   The third parameter which needs to be logged.
+ *  \param      param3   The fourth parameter which needs to be logged.
+ */
+void TraceBin_log(const char *fmt, uint32 numArgs, uint32 param0, uint32 param1, uint32 param2, uint32 param3)
+{
+    uint32           timestamp;
+    uint32           idx;
+    boolean          reserved = FALSE;
+    TraceBin_Record *record;
+
+    Mcal_GetCycleCounterValue(&timestamp);
+
+    /* Reserve a slot, retried only when preempted by another writer */
+    idx = TraceBin_obj.writeIdx;
+    while ((FALSE == reserved) && ((idx - TraceBin_obj.readIdx) < TRACEBIN_NUM_RECORDS))
+    {
+        if (__atomic_compare_exchange_n(&TraceBin_obj.writeIdx, &idx, idx + 1U, 0, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_RELAXED))
+        {
+            reserved = TRUE;
+        }
+    }
+
+    if (TRUE == reserved)
+    {
+        record            = &TraceBin_ring[idx & TRACEBIN_RING_MASK];
+        record->fmt       = (uint32)fmt;
+        record->timestamp = timestamp;
+        record->info      = TraceBin_obj.coreInfo | numArgs;
+        record->arg[0]    = param0;
+        record->arg[1]    = param1;
+        record->arg[2]    = param2;
+        record->arg[3]    = param3;
+
+        /* Commit, the reader sends the record once it sees its sequence */
+        __atomic_store_n(&record->seq, idx + 1U, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        (void)__atomic_fetch_add(&TraceBin_obj.dropCnt, 1U, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ *  \brief      Function to send committed records. Starts one transfer of the
+ *              contiguous committed records, up to the end of the ring, when
+ *              no transfer is in progress.
+ */
+void TraceBin_MainFunction(void)
+{
+    uint32 readIdx = TraceBin_obj.readIdx;
+    uint32 first   = readIdx & TRACEBIN_RING_MASK;
+    uint32 count   = 0U;
+
+    if ((0U == TraceBin_obj.txCount) && (NULL_PTR != TraceBin_obj.txFxn))
+    {
+        /* Stop at the first record still being written */
+        while (((first + count) < TRACEBIN_NUM_RECORDS) &&
+               (__atomic_load_n(&TraceBin_ring[first + count].seq, __ATOMIC_ACQUIRE) == (readIdx + count + 1U)))
+        {
+            count++;
+        }
+
+        if (0U != count)
+        {
+            Mcal_CacheP_wb((void *)&TraceBin_ring[first], count * (uint32)sizeof(TraceBin_Record),
+                           Mcal_CacheP_TYPE_ALLD);
+
+            TraceBin_obj.txCount = count;
+            if ((Std_ReturnType)E_OK != TraceBin_obj.txFxn((const uint8 *)&TraceBin_ring[first],
+                                                           count * (uint32)sizeof(TraceBin_Record)))
+            {
+                /* Transmitter busy, retry in the next call */
+                TraceBin_obj.txCount = 0U;
+            }
+        }
+    }
+}
+
+/**
+ *  \brief      Function to be called from the transmit complete notification.
+ *              Gives the sent records back to the writers.
+ */
+void TraceBin_TxDone(void)
+{
+    TraceBin_obj.readIdx += TraceBin_obj.txCount;
+    TraceBin_obj.txCount  = 0U;
+}
+
+/**
+ *  \brief      Function to get the number of records dropped because the ring
+ *              was full.
+ *  \return     Number of dropped records since TraceBin_Init.
+ */
+uint32 TraceBin_getDropCount(void)
+{
+    return TraceBin_obj.dropCnt;
+}
@@ -0,0 +1,198 @@
+/*
+ * TEXAS INSTRUMENTS TEXT FILE LICENSE
+ *
+ * Copyright (c) 2026 Texas Instruments Incorporated
+ *
+ * All rights reserved not granted herein.
+ *
+ * Limited License.
+ *
+ * Texas Instruments Incorporated grants a world-wide, royalty-free, non-exclusive
+ * license under copyrights and patents it now or hereafter owns or controls to
+ * make, have made, use, import, offer to sell and sell ("Utilize") this software
+ * subject to the terms herein. With respect to the foregoing patent license,
+ * such license is granted solely to the extent that any such patent is necessary
+ * to Utilize the software alone. The patent license shall not apply to any
+ * combinations which include this software, other than combinations with devices
+ * manufactured by or for TI ("TI Devices"). No hardware patent is licensed hereunder.
+ *
+ * Redistributions must preserve existing copyright notices and reproduce this license
+ * (including the above copyright notice and the disclaimer and (if applicable) source
+ * code license limitations below) in the documentation and/or other materials provided
+ * with the distribution.
+ *
+ * Redistribution and use in binary form, without modification, are permitted provided
+ * that the following conditions are met:
+ * No reverse engineering, decompilation, or disassembly of this software is
+ * permitted with respect to any software provided in binary form.
+ * Any redistribution and use are licensed by TI for use only with TI Devices.
+ * Nothing shall obligate TI to provide you with source code for the software
+ * licensed and provided to you in object code.
+ *
+ * If software source code is provided to you, modification and redistribution of the
+ * source code are permitted provided that the following conditions are met:
+ * Any redistribution and use of the source code, including any resulting derivative
+ * works, are licensed by TI for use only with TI Devices.
+ * Any redistribution and use of any object code compiled from the source code
+ * and any resulting derivative works, are licensed by TI for use only with TI Devices.
+ *
+ * Neither the name of Texas Instruments Incorporated nor the names of its suppliers
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * DISCLAIMER.
+ *
+ * THIS SOFTWARE IS PROVIDED BY TI AND TI'S LICENSORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL TI AND TI'S
+ * LICENSORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file       trace_bin.h
+ *
+ *  \brief      Binary trace interface.
+ *
+ *              Call sites store only the address of the format string, a
+ *              cycle counter timestamp and up to TRACEBIN_MAX_ARGS 32-bit
+ *              arguments into a RAM ring. TraceBin_MainFunction sends the
+ *              raw records through the transmit function given at init
+ *              (typically a Cdd_Uart channel in DMA mode). The host tool
+ *              tracebin_decode.py formats the text from the .trace_fmt
+ *              section of the ELF.
+ *
+ *              Format strings are placed in the .trace_fmt section. Map it
+ *              as a COPY section in the linker command file so that it is
+ *              kept in the ELF without using target memory:
+ *                  .trace_fmt : {} (COPY)
+ */
+
+#ifndef TRACE_BIN_H_
+#define TRACE_BIN_H_
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include "Std_Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Maximum number of 32-bit arguments of one record */
+#define TRACEBIN_MAX_ARGS (4U)
+
+/** \brief Number of records in the ring, must be a power of two */
+#ifndef TRACEBIN_NUM_RECORDS
+#define TRACEBIN_NUM_RECORDS (128U)
+#endif
+#if ((TRACEBIN_NUM_RECORDS) == 0U) || (((TRACEBIN_NUM_RECORDS) & ((TRACEBIN_NUM_RECORDS) - 1U)) != 0U)
+#error "TRACEBIN_NUM_RECORDS must be a power of two"
+#endif
+
+/** \brief Marker in the upper half of the info word, used by the host to find record boundaries */
+#define TRACEBIN_RECORD_MAGIC (0x5442U)
+
+/**
+ *  \brief  Transmit function used by TraceBin_MainFunction.
+ *          Must start an asynchronous transfer of the buffer and return E_OK,
+ *          TraceBin_TxDone is called once the transfer completed.
+ */
+typedef Std_ReturnType (*TraceBin_TxFxn)(const uint8 *buf, uint32 length);
+
+/* ========================================================================== */
+/*                         Structures and Enums                               */
+/* ========================================================================== */
+
+/**
+ *  \brief  One trace record as stored in the ring and sent on the wire.
+ *          32 bytes, one cache line.
+ */
+typedef struct
+{
+    uint32 seq;
+    /**< Record sequence number + 1, written last to commit the record */
+    uint32 fmt;
+    /**< Address of the format string in the .trace_fmt section */
+    uint32 timestamp;
+    /**< CPU cycle counter when the record was taken */
+    uint32 info;
+    /**< [31:16] TRACEBIN_RECORD_MAGIC, [15:8] core ID, [7:0] number of arguments */
+    uint32 arg[TRACEBIN_MAX_ARGS];
+    /**< Arguments, unused entries are 0 */
+} TraceBin_Record;
+
+/** \brief Binary trace configuration */
+typedef struct
+{
+    TraceBin_TxFxn txFxn;
+    /**< Transmit function draining the ring */
+    uint8          coreId;
+    /**< Core ID recorded in every record, lets the host merge several cores */
+} TraceBin_ConfigType;
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+/* Function to initialize the binary trace ring. */
+void TraceBin_Init(const TraceBin_ConfigType *cfgPtr);
+
+/* Function to store one trace record, callable from tasks and ISRs. */
+void TraceBin_log(const char *fmt, uint32 numArgs, uint32 param0, uint32 param1, uint32 param2, uint32 param3);
+
+/* Function to send committed records, called from a background task. */
+void TraceBin_MainFunction(void);
+
+/* Function to be called from the transmit complete notification. */
+void TraceBin_TxDone(void);
+
+/* Function to get the number of records dropped because the ring was full. */
+uint32 TraceBin_getDropCount(void);
+
+#if defined(TRACEBIN_ENABLE)
+
+/* Place the format string in .trace_fmt, only its address is recorded */
+#define TRACEBIN_LOG(infoString, numArgs, param0, param1, param2, param3)                              \
+    do                                                                                                 \
+    {                                                                                                  \
+        static const char TraceBin_fmt[] __attribute__((section(".trace_fmt"), used)) = infoString;   \
+        TraceBin_log(TraceBin_fmt, (numArgs), (uint32)(param0), (uint32)(param1), (uint32)(param2),   \
+                     (uint32)(param3));                                                                \
+    } while (0)
+
+/* infoString is passed unparenthesized: it initializes a char array, which a
+ * parenthesized string literal may not do */
+#define TB_0trace(infoString)                                 TRACEBIN_LOG(infoString, 0U, 0U, 0U, 0U, 0U)
+#define TB_1trace(infoString, param0)                         TRACEBIN_LOG(infoString, 1U, (param0), 0U, 0U, 0U)
+#define TB_2trace(infoString, param0, param1)                 TRACEBIN_LOG(infoString, 2U, (param0), (param1), 0U, 0U)
+#define TB_3trace(infoString, param0, param1, param2) \
+    TRACEBIN_LOG(infoString, 3U, (param0), (param1), (param2), 0U)
+#define TB_4trace(infoString, param0, param1, param2, param3) \
+    TRACEBIN_LOG(infoString, 4U, (param0), (param1), (param2), (param3))
+
+#else /* if defined (TRACEBIN_ENABLE) */
+
+#define TB_0trace(infoString)
+#define TB_1trace(infoString, param0)
+#define TB_2trace(infoString, param0, param1)
+#define TB_3trace(infoString, param0, param1, param2)
+#define TB_4trace(infoString, param0, param1, param2, param3)
+
+#endif /* if defined (TRACEBIN_ENABLE) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef TRACE_BIN_H_ */
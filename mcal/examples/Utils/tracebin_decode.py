@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Texas Instruments Incorporated
+#
+# Decoder for the binary trace records sent by trace_bin.c.
+#
+# The format strings are read from the .trace_fmt section of the application
+# ELF, the records are read from a capture of the UART stream (file or '-' for
+# stdin) and printed as text:
+#
+#   tracebin_decode.py app.out capture.bin [--clock 400000000]
+#
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_SIZE = 32
+RECORD_MAGIC = 0x5442
+MAX_ARGS = 4
+FMT_SECTION = ".trace_fmt"
+
+SPEC_RE = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|t)?([diouxXcsp%])")
+
+
+def read_fmt_table(elf_path):
+    """Return {address: format string} from the .trace_fmt section."""
+    with open(elf_path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 1:
+        raise ValueError("%s is not an ELF32 file" % elf_path)
+    endian = "<" if elf[5] == 1 else ">"
+
+    shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2E)
+
+    sections = []
+    for idx in range(shnum):
+        sections.append(struct.unpack_from(endian + "IIIIIIIIII", elf, shoff + idx * shentsize))
+    strtab_off = sections[shstrndx][4]
+
+    table = {}
+    for name_off, sh_type, _, addr, offset, size, _, _, _, _ in sections:
+        name = elf[strtab_off + name_off:elf.index(b"\0", strtab_off + name_off)].decode()
+        if name != FMT_SECTION or sh_type == 8:  # SHT_NOBITS carries no data
+            continue
+        data = elf[offset:offset + size]
+        pos = 0
+        while pos < len(data):
+            end = data.index(b"\0", pos)
+            table[addr + pos] = data[pos:end].decode("latin-1")
+            # Each format string is its own object, skip the alignment padding
+            pos = end + 1
+            while pos < len(data) and data[pos] == 0:
+                pos += 1
+    return table
+
+
+def format_record(fmt, args):
+    """printf subset for 32-bit arguments."""
+    args = list(args)
+
+    def repl(m):
+        flags, width, prec, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        val = args.pop(0) if args else 0
+        if conv in "di":
+            val = val - (1 << 32) if val & 0x80000000 else val
+        elif conv == "c":
+            val = val & 0xFF
+        elif conv in "sp":
+            return "0x%08x" % val
+        spec = "%" + flags + width + ("." + prec if prec else "") + conv.replace("i", "d")
+        return spec % val
+
+    return SPEC_RE.sub(repl, fmt)
+
+
+def decode(stream, table, clock):
+    buf = b""
+    next_seq = {}
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while len(buf) >= RECORD_SIZE:
+            seq, fmt_addr, ts, info = struct.unpack_from("<IIII", buf, 0)
+            if (info >> 16) != RECORD_MAGIC or (info & 0xFF) > MAX_ARGS:
+                # Not aligned to a record, resynchronize byte by byte
+                buf = buf[1:]
+                continue
+            args = struct.unpack_from("<%dI" % MAX_ARGS, buf, 16)[:info & 0xFF]
+            buf = buf[RECORD_SIZE:]
+
+            core = (info >> 8) & 0xFF
+            expected = next_seq.get(core)
+            if expected is not None and seq != expected:
+                print("core%d: %d record(s) lost" % (core, (seq - expected) & 0xFFFFFFFF))
+            next_seq[core] = (seq + 1) & 0xFFFFFFFF
+
+            fmt = table.get(fmt_addr)
+            text = format_record(fmt, args) if fmt is not None else \
+                "<unknown format 0x%08x> %s" % (fmt_addr, " ".join("0x%08x" % a for a in args))
+            stamp = "%12.6f" % (ts / float(clock)) if clock else "%10u" % ts
+            sys.stdout.write("[core%d %s] %s" % (core, stamp, text))
+            if not text.endswith("\n"):
+                sys.stdout.write("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode trace_bin.c binary records")
+    parser.add_argument("elf", help="application ELF with the .trace_fmt section")
+    parser.add_argument("capture", help="raw UART capture, '-' for stdin")
+    parser.add_argument("--clock", type=int, default=0, help="CPU clock in Hz to print seconds instead of cycles")
+    opts = parser.parse_args()
+
+    table = read_fmt_table(opts.elf)
+    if opts.capture == "-":
+        decode(sys.stdin.buffer, table, opts.clock)
+    else:
+        with open(opts.capture, "rb") as stream:
+            decode(stream, table, opts.clock)
+
+
+if __name__ == "__main__":
+    main()
@@ -109,6 +109,9 @@ extern "C" {
 /** \brief Version info Api macro */
 #define CDD_CMPSS_VERSION_INFO_API      (STD_ON)
 
+/** \brief Enable/Disable the EDMA waveform table API */
+#define CDD_CMPSS_WAVEFORM_DMA_API      (STD_OFF)
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
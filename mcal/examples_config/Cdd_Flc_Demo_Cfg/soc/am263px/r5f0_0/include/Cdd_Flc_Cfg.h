@@ -109,6 +109,9 @@ extern "C" {
 /** \brief Version info Api macro */
 #define CDD_FLC_VERSION_INFO_API        (STD_ON)
 
+/** \brief Enable/Disable the FLC overlay manager (Cdd_Flc_Overlay* APIs) */
+#define CDD_FLC_OVERLAY_API             (STD_OFF)
+
 /* ========================================================================== */
 /*                         Structures and Enums                               */
 /* ========================================================================== */
@@ -124,6 +124,7 @@ extern "C" {
 #define CDD_DMA_VERSION_INFO_API                                          (STD_ON)
 #define CDD_DMA_DEINIT_API                                                (STD_ON)
 #define CDD_DMA_REGISTER_READBACK_API                                     (STD_ON)
+#define CDD_DMA_STATISTICS_API                                            (STD_OFF)
 
 #define CDD_DMA_MAX_HANDLER                                               38U
 #define CDD_DMA_MAX_CHANNEL                                               2U
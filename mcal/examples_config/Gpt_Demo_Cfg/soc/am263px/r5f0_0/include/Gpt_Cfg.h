@@ -155,6 +155,10 @@ extern "C" {
 #define GPT_ENABLE_DISABLE_NOTIFICATION_API            (STD_ON)
 /** \brief Enable/disable GPT wakeup functionality API */
 #define GPT_WAKEUP_FUNCTIONALITY_API                   (STD_OFF)
+/** \brief Enable/disable GPT timer wheel API */
+#define GPT_TIMER_WHEEL_API                            (STD_OFF)
+/** \brief Enable/disable GPT monotonic time base API */
+#define GPT_MONOTONIC_TIME_API                         (STD_OFF)
 /* @} */
 
 /** \brief No. of channels configured for GPT driver */
@@ -326,6 +330,18 @@ extern "C" {
  */
 #define GPT_TIMEOUT_DURATION            (32000U)
 
+/** \brief GPT channel reserved for the timer wheel */
+#define GPT_TIMER_WHEEL_CHANNEL         (31U)
+/** \brief Number of logical timers of the timer wheel */
+#define GPT_TIMER_WHEEL_NUM_TIMERS      (32U)
+/** \brief Timer wheel time unit in channel ticks */
+#define GPT_TIMER_WHEEL_RESOLUTION      (1U)
+
+/** \brief GPT channel reserved for the monotonic time base */
+#define GPT_MONOTONIC_CHANNEL           (30U)
+/** \brief RTI input clock of the monotonic time base in Hz */
+#define GPT_MONOTONIC_CLOCK_HZ          (25000000U)
+
 /** \brief Enable/disable GPT register read back API */
 #define GPT_REGISTER_READBACK_API               (STD_OFF)
 
@@ -145,6 +145,15 @@ extern "C" {
 /** \brief Enable/Disable Timestamp  API */
 #define ICU_TIMESTAMP_API                 (STD_ON)
 
+/** \brief Enable/Disable batched 4-capture Timestamp mode */
+#define ICU_TIMESTAMP_BATCH_API           (STD_OFF)
+
+/** \brief Enable/Disable EDMA driven Timestamp mode */
+#define ICU_TIMESTAMP_DMA_API             (STD_OFF)
+
+/** \brief Enable/Disable averaged Signal measurement */
+#define ICU_SIGNAL_AVERAGING_API          (STD_OFF)
+
 /** \brief Enable/Disable Development error detet */
 #define ICU_DEV_ERROR_DETECT              (STD_ON)
 
@@ -62,6 +62,9 @@
 #include "Std_Types.h"
 #include "Icu_Irq.h"
 #include "Icu.h"
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+#include "Cdd_Dma_Cfg.h"
+#endif
 
 #ifdef __cplusplus
 
@@ -112,6 +115,9 @@ extern "C" {
             .signalMeasurementProperty = ICU_PERIOD_TIME,
             .instanceClkMHz = 200U,
             .prescaler = 0, /* prescale */
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            .dmaHandleId = 0xFFU, /* DMA handler */
+#endif
         }
     },
 };
@@ -61,6 +61,9 @@
  ******************************************************************************/
 #include "Std_Types.h"
 #include "Icu_Irq.h"
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+#include "Cdd_Dma_Cfg.h"
+#endif
 #ifdef __cplusplus
 
 extern "C" {
@@ -98,6 +101,9 @@ extern "C" {
             .signalMeasurementProperty = ICU_PERIOD_TIME,
             .instanceClkMHz = 200U,
             .prescaler = 0, /* prescale */
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            .dmaHandleId = 0xFFU, /* DMA handler */
+#endif
         }
     },
 };
@@ -149,6 +149,23 @@ extern "C" {
 //
 //*****************************************************************************
 #define LIN_REGISTER_READBACK_API         (STD_ON)
+
+//*****************************************************************************
+//
+//! \brief Enable/Disable the in-driver master schedule table.
+//
+//*****************************************************************************
+#define LIN_SCHEDULE_TABLE_API            (STD_OFF)
+
+/** \brief Maximum number of entries of a LIN schedule table */
+#define LIN_SCHEDULE_MAX_ENTRIES          (16U)
+
+//*****************************************************************************
+//
+//! \brief Enable/Disable LIN frame, latency and slot jitter statistics.
+//
+//*****************************************************************************
+#define LIN_STATISTICS_API                (STD_OFF)
 /* @} */
 
 //*****************************************************************************
@@ -181,6 +181,9 @@ extern "C" {
 /** \brief Enable/Disable PWM SFO Support for HRPWM */
 #define PWM_SFO_SUPPORT_ENABLE             (STD_OFF)
 
+/** \brief Enable/Disable background SFO calibration (Pwm_SfoMainFunction) */
+#define PWM_SFO_BACKGROUND_CAL_API         (STD_OFF)
+
 /** \brief OS counter ID - used for timeout in case of error */
 #define PWM_OS_COUNTER_ID           ((CounterType)OsCounter_0)
 
@@ -174,6 +174,9 @@ extern "C" {
 
 /** \brief Enable/Disable PWM SFO Support for HRPWM */
 #define PWM_SFO_SUPPORT_ENABLE             (STD_OFF)
+
+/** \brief Enable/Disable background SFO calibration (Pwm_SfoMainFunction) */
+#define PWM_SFO_BACKGROUND_CAL_API         (STD_OFF)
 /* @} */
 /** \brief Instance ID for driver module. */
 #define PWM_INDEX       (0U)
@@ -235,6 +235,10 @@ extern "C" {
 #define CDD_UART_CANCEL_API                        STD_ON
 /** \brief Enable/disable CDD UART GetRemainingWords API */
 #define CDD_UART_GETREMAININGWORDS_API             STD_ON
+/** \brief Enable/disable CDD UART TX FIFO refill on trigger level */
+#define CDD_UART_TX_FIFO_REFILL                    STD_OFF
+/** \brief Enable/disable CDD UART circular DMA receive API */
+#define CDD_UART_RX_RING_API                       STD_OFF
 /* @} */
 
 /** \brief total number of UART channels allocated */
@@ -71,6 +71,9 @@ extern "C"
 #if defined(CDD_CMPSS_START_SEC_CONST_UNSPECIFIED)
 #undef CDD_CMPSS_START_SEC_CONST_UNSPECIFIED
 #define START_SEC_COMMON_CONST_UNSPECIFIED
+#elif defined(CDD_CMPSS_START_SEC_VAR_INIT_UNSPECIFIED)
+#undef CDD_CMPSS_START_SEC_VAR_INIT_UNSPECIFIED
+#define START_SEC_COMMON_VAR_INIT_UNSPECIFIED
 #elif defined(CDD_CMPSS_START_SEC_CODE)
 #undef CDD_CMPSS_START_SEC_CODE
 #define START_SEC_COMMON_CODE
@@ -80,6 +83,9 @@ extern "C"
 #if defined(CDD_CMPSS_STOP_SEC_CONST_UNSPECIFIED)
 #undef CDD_CMPSS_STOP_SEC_CONST_UNSPECIFIED
 #define STOP_SEC_COMMON_CONST_UNSPECIFIED
+#elif defined(CDD_CMPSS_STOP_SEC_VAR_INIT_UNSPECIFIED)
+#undef CDD_CMPSS_STOP_SEC_VAR_INIT_UNSPECIFIED
+#define STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED
 #elif defined(CDD_CMPSS_STOP_SEC_CODE)
 #undef CDD_CMPSS_STOP_SEC_CODE
 #define STOP_SEC_COMMON_CODE
@@ -98,6 +104,18 @@ extern "C"
 #error "SECTION start keyword not matching"
 #endif
 #define MEMMAP_ACTIVE_CONST_SECTION (CONST_UNSPECIFIED)
+#elif defined(START_SEC_COMMON_VAR_INIT_UNSPECIFIED)
+#if (defined CLANG) || (defined DIAB)
+#pragma clang section data=".data.CDD_CMPSS_DATA_INIT_UNSPECIFIED_SECTION"
+#else
+#pragma SET_DATA_SECTION("CDD_CMPSS_DATA_INIT_UNSPECIFIED_SECTION")
+#endif
+#undef START_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#undef MEMMAP_ERROR
+#ifdef MEMMAP_ACTIVE_DATA_SECTION
+#error "SECTION start keyword not matching"
+#endif
+#define MEMMAP_ACTIVE_DATA_SECTION (VAR_INIT_UNSPECIFIED)
 #elif defined(START_SEC_COMMON_CODE)
 #if (defined CLANG) || (defined DIAB)
 #pragma clang section text=".text.CDD_CMPSS_TEXT_SECTION"
@@ -126,6 +144,19 @@ extern "C"
 #error "STOP keyword not matching start"
 #endif
 #undef MEMMAP_ACTIVE_CONST_SECTION
+#elif defined(STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED)
+#if (defined CLANG) || (defined DIAB)
+#pragma clang section data=".data"
+#else
+#pragma SET_DATA_SECTION()
+#endif
+#undef STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#undef MEMMAP_ERROR
+#if (!defined(MEMMAP_ACTIVE_DATA_SECTION) || \
+    (MEMMAP_ACTIVE_DATA_SECTION != VAR_INIT_UNSPECIFIED))
+#error "STOP keyword not matching start"
+#endif
+#undef MEMMAP_ACTIVE_DATA_SECTION
 #elif defined(STOP_SEC_COMMON_CODE)
 #if (defined CLANG) || (defined DIAB)
 #pragma clang section text=".text"
@@ -68,7 +68,10 @@ extern "C"
 #define MEMMAP_ERROR
 
 /* Start sections */
-#if defined(CDD_FLC_START_SEC_CONST_UNSPECIFIED)
+#if defined(CDD_FLC_START_SEC_VAR_INIT_UNSPECIFIED)
+#undef CDD_FLC_START_SEC_VAR_INIT_UNSPECIFIED
+#define START_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#elif defined(CDD_FLC_START_SEC_CONST_UNSPECIFIED)
 #undef CDD_FLC_START_SEC_CONST_UNSPECIFIED
 #define START_SEC_COMMON_CONST_UNSPECIFIED
 #elif defined(CDD_FLC_START_SEC_CODE)
@@ -77,7 +80,10 @@ extern "C"
 #endif
 
 /* Stop sections */
-#if defined(CDD_FLC_STOP_SEC_CONST_UNSPECIFIED)
+#if defined(CDD_FLC_STOP_SEC_VAR_INIT_UNSPECIFIED)
+#undef CDD_FLC_STOP_SEC_VAR_INIT_UNSPECIFIED
+#define STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#elif defined(CDD_FLC_STOP_SEC_CONST_UNSPECIFIED)
 #undef CDD_FLC_STOP_SEC_CONST_UNSPECIFIED
 #define STOP_SEC_COMMON_CONST_UNSPECIFIED
 #elif defined(CDD_FLC_STOP_SEC_CODE)
@@ -86,7 +92,19 @@ extern "C"
 #endif
 
 /* Start sections - mapping */
-#if defined(START_SEC_COMMON_CONST_UNSPECIFIED)
+#if defined(START_SEC_COMMON_VAR_INIT_UNSPECIFIED)
+#if (defined CLANG) || (defined DIAB)
+#pragma clang section data=".data.CDD_FLC_DATA_INIT_UNSPECIFIED_SECTION"
+#else
+#pragma SET_DATA_SECTION("CDD_FLC_DATA_INIT_UNSPECIFIED_SECTION")
+#endif
+#undef START_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#undef MEMMAP_ERROR
+#ifdef MEMMAP_ACTIVE_DATA_SECTION
+#error "SECTION start keyword not matching"
+#endif
+#define MEMMAP_ACTIVE_DATA_SECTION (VAR_INIT_UNSPECIFIED)
+#elif defined(START_SEC_COMMON_CONST_UNSPECIFIED)
 #if (defined CLANG) || (defined DIAB)
 #pragma clang section rodata=".rodata.CDD_FLC_CONST_UNSPECIFIED_SECTION"
 #else
@@ -113,7 +131,20 @@ extern "C"
 #endif
 
 /* Stop sections - mapping */
-#if defined(STOP_SEC_COMMON_CONST_UNSPECIFIED)
+#if defined(STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED)
+#if (defined CLANG) || (defined DIAB)
+#pragma clang section data=".data"
+#else
+#pragma SET_DATA_SECTION()
+#endif
+#undef STOP_SEC_COMMON_VAR_INIT_UNSPECIFIED
+#undef MEMMAP_ERROR
+#if (!defined(MEMMAP_ACTIVE_DATA_SECTION) || \
+    (MEMMAP_ACTIVE_DATA_SECTION != VAR_INIT_UNSPECIFIED))
+#error "STOP keyword not matching start"
+#endif
+#undef MEMMAP_ACTIVE_DATA_SECTION
+#elif defined(STOP_SEC_COMMON_CONST_UNSPECIFIED)
 #if (defined CLANG) || (defined DIAB)
 #pragma clang section rodata=".rodata"
 #else
@@ -266,6 +266,18 @@ extern "C" {
 /** \brief Enable/disable ADC polling main function API */
 #define ADC_POLLING_MAINFUNCTION_API       [!IF "as:modconf('Adc')[1]/AdcGeneral/AdcPollingMainFunctionApi   = 'true'"!] (STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
 
+/** \brief Enable/disable ADC lock-free stream acquire/release API */
+#define ADC_STREAM_ACQUIRE_API             [!IF "as:modconf('Adc')[1]/AdcGeneral/AdcStreamAcquireApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
+/** \brief Enable/disable ADC DMA ping-pong streaming API */
+#define ADC_DMA_PING_PONG_API              [!IF "as:modconf('Adc')[1]/AdcGeneral/AdcDmaPingPongApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
+/** \brief Enable/disable ADC post-processing block (PPB) and oversampled read API */
+#define ADC_PPB_API                        [!IF "as:modconf('Adc')[1]/AdcGeneral/AdcPpbApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
+/** \brief Enable/disable ADC result post-processing kernels (Adc_PostProc.h) */
+#define ADC_POST_PROC_API                  [!IF "as:modconf('Adc')[1]/AdcGeneral/AdcPostProcApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
 /**
  *  \name Adc Group Id names
  *
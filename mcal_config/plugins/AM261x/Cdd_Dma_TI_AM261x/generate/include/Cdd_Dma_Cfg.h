@@ -125,6 +125,7 @@ extern "C" {
 #define CDD_DMA_VERSION_INFO_API                                          [!IF "as:modconf('Cdd_Dma')[1]/CddDmaGeneral/CddDmaVersionInfoApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
 #define CDD_DMA_DEINIT_API                                                [!IF "as:modconf('Cdd_Dma')[1]/CddDmaGeneral/CddDmaDeinitApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
 #define CDD_DMA_REGISTER_READBACK_API                                     [!IF "as:modconf('Cdd_Dma')[1]/CddDmaGeneral/CddDmaRegisterReadBackApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+#define CDD_DMA_STATISTICS_API                                            [!IF "as:modconf('Cdd_Dma')[1]/CddDmaGeneral/CddDmaStatisticsApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
 
 [!VAR "maxHandler"= "0"!][!//
 [!VAR "maxChannel"= "0"!][!//
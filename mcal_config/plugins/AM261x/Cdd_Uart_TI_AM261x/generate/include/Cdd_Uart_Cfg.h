@@ -233,6 +233,10 @@ extern "C" {
 #define CDD_UART_CANCEL_API                        [!IF "as:modconf('Cdd_Uart')[1]/CddUartGeneral/CddUartCancelApi = 'true'"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!]
 /** \brief Enable/disable CDD UART GetRemainingWords API */
 #define CDD_UART_GETREMAININGWORDS_API             [!IF "as:modconf('Cdd_Uart')[1]/CddUartGeneral/CddUartGetRemainingWordsApi = 'true'"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!]
+/** \brief Enable/disable CDD UART TX FIFO refill on trigger level */
+#define CDD_UART_TX_FIFO_REFILL                    [!IF "as:modconf('Cdd_Uart')[1]/CddUartGeneral/CddUartTxFifoRefill = 'true'"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!]
+/** \brief Enable/disable CDD UART circular DMA receive API */
+#define CDD_UART_RX_RING_API                       [!IF "as:modconf('Cdd_Uart')[1]/CddUartGeneral/CddUartRxRingApi = 'true' and $DMA_ENABLE = 'STD_ON'"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!]
 
 /** \brief total number of UART channels allocated */
 #define CDD_UART_NUM_CHANNELS                      [!"num:i(count(as:modconf('Cdd_Uart')[1]/CddUartDriver/*/CddUartChannel/*))"!]U
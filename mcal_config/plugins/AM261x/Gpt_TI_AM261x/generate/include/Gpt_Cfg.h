@@ -158,6 +158,10 @@ extern "C" {
 #define GPT_ENABLE_DISABLE_NOTIFICATION_API    [!CALL "True2STDON","ref" = "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptEnableDisableNotificationApi"!]
 /** \brief Enable/disable GPT wakeup functionality API */
 #define GPT_WAKEUP_FUNCTIONALITY_API           [!CALL "True2STDON","ref" = "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptWakeupFunctionalityApi"!]
+/** \brief Enable/disable GPT timer wheel API */
+#define GPT_TIMER_WHEEL_API                    [!CALL "True2STDON","ref" = "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptTimerWheelApi"!]
+/** \brief Enable/disable GPT monotonic time base API */
+#define GPT_MONOTONIC_TIME_API                 [!CALL "True2STDON","ref" = "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptMonotonicTimeApi"!]
 /** \brief Enable/disable GPT register read back API */
 #define GPT_REGISTER_READBACK_API       [!CALL "True2STDON","ref" = "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptRegisterReadback"!]
 /** \brief Enable/disable wakeup source in wakeup related APIs */
@@ -270,6 +274,22 @@ extern "C" {
  *   below value
  */
 #define GPT_TIMEOUT_DURATION            ([!" as:modconf('Gpt')[1]/GptDriverConfiguration/GptTimeoutDuration"!]U)
+[!IF "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptTimerWheelApi = 'true'"!]
+
+/** \brief GPT channel reserved for the timer wheel */
+#define GPT_TIMER_WHEEL_CHANNEL         ([!"node:value(node:ref(as:modconf('Gpt')[1]/GptDriverConfiguration/GptTimerWheelChannelRef)/GptChannelId)"!]U)
+/** \brief Number of logical timers of the timer wheel */
+#define GPT_TIMER_WHEEL_NUM_TIMERS      ([!"as:modconf('Gpt')[1]/GptDriverConfiguration/GptTimerWheelNumTimers"!]U)
+/** \brief Timer wheel time unit in channel ticks */
+#define GPT_TIMER_WHEEL_RESOLUTION      ([!"as:modconf('Gpt')[1]/GptDriverConfiguration/GptTimerWheelResolution"!]U)
+[!ENDIF!][!//
+[!IF "as:modconf('Gpt')[1]/GptConfigurationOfOptApiServices/GptMonotonicTimeApi = 'true'"!]
+
+/** \brief GPT channel reserved for the monotonic time base */
+#define GPT_MONOTONIC_CHANNEL           ([!"node:value(node:ref(as:modconf('Gpt')[1]/GptDriverConfiguration/GptMonotonicChannelRef)/GptChannelId)"!]U)
+/** \brief RTI input clock of the monotonic time base in Hz */
+#define GPT_MONOTONIC_CLOCK_HZ          ([!"as:modconf('Gpt')[1]/GptDriverConfiguration/GptMonotonicClockFrequency"!]U)
+[!ENDIF!][!//
 
 
 #define SOC_RTI1_REG_BASE       (0x52180000U)
@@ -146,6 +146,15 @@ extern "C" {
 /** \brief Enable/Disable Timestamp  API */
 #define ICU_TIMESTAMP_API                 ([!IF "as:modconf('Icu')[1]/IcuOptionalApis/IcuTimestampApi"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
 
+/** \brief Enable/Disable batched 4-capture Timestamp mode */
+#define ICU_TIMESTAMP_BATCH_API           ([!IF "as:modconf('Icu')[1]/IcuOptionalApis/IcuTimestampBatchApi"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
+
+/** \brief Enable/Disable EDMA driven Timestamp mode */
+#define ICU_TIMESTAMP_DMA_API             ([!IF "as:modconf('Icu')[1]/IcuOptionalApis/IcuTimestampDmaApi"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
+
+/** \brief Enable/Disable averaged Signal measurement */
+#define ICU_SIGNAL_AVERAGING_API          ([!IF "as:modconf('Icu')[1]/IcuOptionalApis/IcuSignalAveragingApi"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
+
 /** \brief Enable/Disable Development error detet */
 #define ICU_DEV_ERROR_DETECT              ([!IF "as:modconf('Icu')[1]/IcuGeneral/IcuDevErrorDetect"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
 
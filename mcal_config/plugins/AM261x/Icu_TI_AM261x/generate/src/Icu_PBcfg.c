@@ -63,6 +63,9 @@
 #include "Std_Types.h"
 #include "Icu_Irq.h"
 #include "Icu.h"
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+#include "Cdd_Dma_Cfg.h"
+#endif
 
 #ifdef __cplusplus
 
@@ -136,6 +139,9 @@ extern "C" {
             [!ENDIF!]
             .instanceClkMHz = [!"IcuFunctionalClock"!]U,
             .prescaler = [!"IcuPrescaler"!], /* prescale */
+#if (STD_ON == ICU_TIMESTAMP_DMA_API)
+            .dmaHandleId = [!IF "(IcuMeasurementMode = 'ICU_MODE_TIMESTAMP') and (node:exists(as:modconf('Cdd_Dma')[1]/CddDmaGeneral)) and (not(node:empty(IcuDmaReference)))"!](CddDmaConf_[!"node:name(node:ref(./IcuDmaReference))"!])[!ELSE!]0xFFU[!ENDIF!], /* DMA handler */
+#endif
         }[!IF "not(node:islast())"!],[!ENDIF!][!CR!][!ENDLOOP!]
     }[!IF "not(node:islast())"!],[!ENDIF!][!CR!]
 };
@@ -154,6 +154,23 @@ extern "C" {
 //
 //*****************************************************************************
 #define LIN_REGISTER_READBACK_API         [!IF "as:modconf('Lin')[1]/LinGeneral/LinEnableRegisterReadbackApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
+//*****************************************************************************
+//
+//! \brief Enable/Disable the in-driver master schedule table.
+//
+//*****************************************************************************
+#define LIN_SCHEDULE_TABLE_API            [!IF "as:modconf('Lin')[1]/LinGeneral/LinScheduleTableApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
+
+/** \brief Maximum number of entries of a LIN schedule table */
+#define LIN_SCHEDULE_MAX_ENTRIES          ([!"as:modconf('Lin')[1]/LinGeneral/LinScheduleMaxEntries"!]U)
+
+//*****************************************************************************
+//
+//! \brief Enable/Disable LIN frame, latency and slot jitter statistics.
+//
+//*****************************************************************************
+#define LIN_STATISTICS_API                [!IF "as:modconf('Lin')[1]/LinGeneral/LinStatisticsApi = 'true'"!](STD_ON)[!ELSE!](STD_OFF)[!ENDIF!]
 /* @} */
 
 //*****************************************************************************
@@ -194,6 +194,9 @@ extern "C" {
 /** \brief Enable/Disable PWM SFO Support for HRPWM */
 #define PWM_SFO_SUPPORT_ENABLE             ([!IF "as:modconf('Pwm')[1]/PwmGeneral/PwmSfoSupportEnable"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
 
+/** \brief Enable/Disable background SFO calibration (Pwm_SfoMainFunction) */
+#define PWM_SFO_BACKGROUND_CAL_API         ([!IF "as:modconf('Pwm')[1]/PwmGeneral/PwmSfoBackgroundCalApi"!]STD_ON[!ELSE!]STD_OFF[!ENDIF!])
+
 /** \brief OS counter ID - used for timeout in case of error */
 #define PWM_OS_COUNTER_ID           ([!IF "node:refexists(as:modconf('Pwm')[1]/PwmGeneral/PwmOsCounterRef)"!](CounterType)[!"node:name(node:ref(as:modconf('Pwm')[1]/PwmGeneral/PwmOsCounterRef))"!][!ELSE!][!"as:modconf('Pwm')[1]/PwmGeneral/PwmDefaultOSCounterId"!]U[!ENDIF!])
 